@@ -72,6 +72,11 @@ FVimModeInfo SUMStatusBarWidget::GetVimModeInfo(EVimMode Mode) const
 				FAppStyle::GetBrush("TextureEditor.RedChannel.Small"),
 				LOCTEXT("Visual_Line_Mode", "V-Line")
 			};
+		case EVimMode::VisualBlock:
+			return {
+				FAppStyle::GetBrush("TextureEditor.RedChannel.Small"),
+				LOCTEXT("Visual_Block_Mode", "V-Block")
+			};
 		case EVimMode::Insert:
 		default:
 			return {
@@ -0,0 +1,193 @@
+#include "SVimGraphActionMenu.h"
+#include "Algo/StableSort.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+#include "UMTabRegistry.h"
+
+#define LOCTEXT_NAMESPACE "VimGraphActionMenu"
+
+void SVimGraphActionMenu::Construct(const FArguments& InArgs)
+{
+	ActionList = InArgs._ActionList;
+	OnActionPicked = InArgs._OnActionPicked;
+	OnDismissed = InArgs._OnDismissed;
+
+	ChildSlot
+		[SNew(SBorder)
+				.BorderImage(FCoreStyle::Get().GetBrush("ToolPanel.GroupBorder"))
+				.Padding(FMargin(4))
+					[SNew(SBox)
+							.WidthOverride(420.f)
+							.HeightOverride(360.f)
+								[SNew(SVerticalBox)
+									+ SVerticalBox::Slot()
+										  .AutoHeight()
+										  .Padding(FMargin(0, 0, 0, 4))
+											  [SAssignNew(SearchBox, SSearchBox)
+													  .HintText(LOCTEXT("SearchHint", "Add Node..."))
+													  .OnTextChanged(this, &SVimGraphActionMenu::OnSearchTextChanged)
+													  .OnTextCommitted(this, &SVimGraphActionMenu::OnSearchTextCommitted)
+													  .OnKeyDownHandler(this, &SVimGraphActionMenu::OnSearchBoxKeyDown)]
+									+ SVerticalBox::Slot()
+										  .FillHeight(1.f)
+											  [SAssignNew(ListView, SListView<TSharedPtr<FVimGraphAction>>)
+													  .ListItemsSource(&FilteredActions)
+													  .SelectionMode(ESelectionMode::Single)
+													  .OnGenerateRow(this, &SVimGraphActionMenu::OnGenerateRow)
+													  .OnMouseButtonDoubleClick_Lambda(
+														  [this](TSharedPtr<FVimGraphAction> InAction) {
+															  ListView->SetSelection(InAction);
+															  PickSelected();
+														  })]]]];
+
+	RefreshFilter(FString());
+}
+
+void SVimGraphActionMenu::OnSearchTextChanged(const FText& InText)
+{
+	RefreshFilter(InText.ToString());
+}
+
+void SVimGraphActionMenu::OnSearchTextCommitted(
+	const FText& InText, ETextCommit::Type CommitType)
+{
+	if (CommitType == ETextCommit::OnEnter)
+		PickSelected();
+}
+
+FReply SVimGraphActionMenu::OnSearchBoxKeyDown(
+	const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
+{
+	const FKey InKey = InKeyEvent.GetKey();
+
+	if (InKey == EKeys::Down || (InKeyEvent.IsControlDown() && InKey == EKeys::J))
+	{
+		MoveSelection(1);
+		return FReply::Handled();
+	}
+	if (InKey == EKeys::Up || (InKeyEvent.IsControlDown() && InKey == EKeys::K))
+	{
+		MoveSelection(-1);
+		return FReply::Handled();
+	}
+	if (InKey == EKeys::Enter)
+	{
+		PickSelected();
+		return FReply::Handled();
+	}
+	if (InKey == EKeys::Escape)
+	{
+		OnDismissed.ExecuteIfBound();
+		return FReply::Handled();
+	}
+	return FReply::Unhandled();
+}
+
+void SVimGraphActionMenu::RefreshFilter(const FString& InQuery)
+{
+	FilteredActions.Reset();
+	if (!ActionList.IsValid())
+		return;
+
+	const FString QueryLower = InQuery.TrimStartAndEnd().ToLower();
+	if (QueryLower.IsEmpty())
+	{
+		FilteredActions = ActionList->Actions;
+	}
+	else
+	{
+		// Names are matched first; category & keyword matches rank below them.
+		TArray<TPair<int32, int32>> Scored; // Score, action index
+		for (int32 i = 0; i < ActionList->Actions.Num(); ++i)
+		{
+			const FVimGraphAction& Action = *ActionList->Actions[i];
+
+			int32 Score = FUMTabRegistry::ScoreFuzzyMatch(QueryLower, Action.NameLower);
+			if (Score == INDEX_NONE)
+			{
+				Score = FUMTabRegistry::ScoreFuzzyMatch(QueryLower, Action.SearchLower);
+				if (Score == INDEX_NONE)
+					continue;
+				Score -= 1000;
+			}
+			Scored.Emplace(Score, i);
+		}
+
+		// Stable, so equal scores keep the menu's own ordering.
+		Algo::StableSort(Scored, [](const TPair<int32, int32>& A, const TPair<int32, int32>& B) {
+			return A.Key > B.Key;
+		});
+
+		const int32 NumShown = FMath::Min(Scored.Num(), MaxFilteredActions);
+		FilteredActions.Reserve(NumShown);
+		for (int32 i = 0; i < NumShown; ++i)
+			FilteredActions.Add(ActionList->Actions[Scored[i].Value]);
+	}
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+		if (!FilteredActions.IsEmpty())
+		{
+			ListView->SetSelection(FilteredActions[0]);
+			ListView->RequestScrollIntoView(FilteredActions[0]);
+		}
+	}
+}
+
+void SVimGraphActionMenu::MoveSelection(const int32 Offset)
+{
+	if (FilteredActions.IsEmpty())
+		return;
+
+	const TArray<TSharedPtr<FVimGraphAction>> Selected = ListView->GetSelectedItems();
+
+	int32 Index = Selected.IsEmpty() ? INDEX_NONE : FilteredActions.Find(Selected[0]);
+	Index = FMath::Clamp(Index + Offset, 0, FilteredActions.Num() - 1);
+
+	ListView->SetSelection(FilteredActions[Index]);
+	ListView->RequestScrollIntoView(FilteredActions[Index]);
+}
+
+void SVimGraphActionMenu::PickSelected()
+{
+	if (bHasPicked)
+		return;
+
+	const TArray<TSharedPtr<FVimGraphAction>> Selected = ListView->GetSelectedItems();
+	if (Selected.IsEmpty() || !Selected[0].IsValid())
+		return;
+
+	bHasPicked = true;
+	OnActionPicked.ExecuteIfBound(Selected[0]);
+}
+
+TSharedRef<ITableRow> SVimGraphActionMenu::OnGenerateRow(
+	TSharedPtr<FVimGraphAction>		  InAction,
+	const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FVimGraphAction>>, OwnerTable)
+		.Padding(FMargin(4, 2))
+			[SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+					  .FillWidth(1.f)
+						  [SNew(STextBlock)
+								  .Text(InAction->DisplayText)
+								  .HighlightText(this, &SVimGraphActionMenu::GetHighlightText)]
+				+ SHorizontalBox::Slot()
+					  .AutoWidth()
+					  .Padding(FMargin(8, 0, 0, 0))
+						  [SNew(STextBlock)
+								  .Text(InAction->CategoryText)
+								  .ColorAndOpacity(FSlateColor::UseSubduedForeground())]];
+}
+
+FText SVimGraphActionMenu::GetHighlightText() const
+{
+	return SearchBox.IsValid() ? SearchBox->GetText() : FText::GetEmpty();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -76,3 +76,43 @@ bool FUMConfig::IsFocuserEnabled()
 
 	return bIsEnabled;
 }
+
+int32 FUMConfig::GetWidgetHistoryDepth()
+{
+	const TCHAR* KeyName = TEXT("WidgetHistoryDepth");
+	int32		 Depth = 256;
+
+	ConfigFile.GetInt(FocuserSection, KeyName, Depth);
+
+	return FMath::Max(1, Depth);
+}
+
+int32 FUMConfig::GetWidgetHistoryPartitionDepth()
+{
+	const TCHAR* KeyName = TEXT("WidgetHistoryPartitionDepth");
+	int32		 Depth = 32;
+
+	ConfigFile.GetInt(FocuserSection, KeyName, Depth);
+
+	return FMath::Max(1, Depth);
+}
+
+bool FUMConfig::IsWidgetHistoryPartitionedByTab()
+{
+	const TCHAR* KeyName = TEXT("bPartitionWidgetHistoryByTab");
+	bool		 bIsEnabled = true;
+
+	ConfigFile.GetBool(FocuserSection, KeyName, bIsEnabled);
+
+	return bIsEnabled;
+}
+
+bool FUMConfig::IsWidgetHistoryPartitionedByWindow()
+{
+	const TCHAR* KeyName = TEXT("bPartitionWidgetHistoryByWindow");
+	bool		 bIsEnabled = true;
+
+	ConfigFile.GetBool(FocuserSection, KeyName, bIsEnabled);
+
+	return bIsEnabled;
+}
@@ -1,5 +1,6 @@
 #include "UMFocusHelpers.h"
 #include "Editor.h"
+#include "Rendering/SlateRenderer.h"
 #include "Input/Events.h"
 #include "Logging/LogVerbosity.h"
 #include "SGraphNode.h"
@@ -21,6 +22,10 @@
 DEFINE_LOG_CATEGORY_STATIC(LogUMFocusHelpers, Log, All); // Dev
 FUMLogger FUMFocusHelpers::Logger(&LogUMFocusHelpers);
 
+FUMFocusHelpers::FPendingWindowRequest FUMFocusHelpers::PendingPopupMenuFocus;
+FUMFocusHelpers::FPendingWindowRequest FUMFocusHelpers::PendingSubMenuFocus;
+FUMFocusHelpers::FPendingWindowRequest FUMFocusHelpers::PendingWidgetExecution;
+
 bool FUMFocusHelpers::FocusNearestInteractableWidget(
 	const TSharedRef<SWidget> StartWidget)
 {
@@ -125,25 +130,44 @@ bool FUMFocusHelpers::HandleWidgetExecution(FSlateApplication& SlateApp, const T
 	return false;
 }
 
-void FUMFocusHelpers::HandleWidgetExecutionWithDelay(FSlateApplication& SlateApp, const TSharedRef<SWidget> InWidget, FTimerHandle* TimerHandle, const float Delay)
+void FUMFocusHelpers::HandleWidgetExecutionWithDelay(FSlateApplication& SlateApp, const TSharedRef<SWidget> InWidget, const float Timeout)
 {
-	TSharedRef<FTimerManager> TimerManager = GEditor->GetTimerManager();
-	FTimerHandle			  LocalTimerHandle;
-	FTimerHandle&			  TimerHandleRef =
-		TimerHandle ? *TimerHandle : LocalTimerHandle;
+	FPendingWindowRequest& Pending = PendingWidgetExecution;
+	CancelPendingRequest(Pending);
+
+	const TWeakPtr<SWidget> WeakWidget = InWidget;
+	const TWeakPtr<SWindow> WeakWindow = SlateApp.FindWidgetWindow(InWidget);
+
+	// The target window was just activated; execution has to wait for the
+	// activation to go through, which is observable after the next Slate tick.
+	Pending.RequestTime = FPlatformTime::Seconds();
+	Pending.DelegateHandle = SlateApp.OnPostTick().AddLambda(
+		[WeakWidget, WeakWindow](float) {
+			const TSharedPtr<SWindow> Window = WeakWindow.Pin();
+			const TSharedPtr<SWindow> ActiveWindow =
+				FSlateApplication::Get().GetActiveTopLevelWindow();
+			if (!Window.IsValid()
+				|| (ActiveWindow.IsValid() && ActiveWindow->GetId() == Window->GetId()))
+				ExecutePendingWidget(TWeakPtr<SWidget>(WeakWidget), false);
+		});
 
-	if (TimerHandle)
-		TimerManager->ClearTimer(TimerHandleRef);
+	GEditor->GetTimerManager()->SetTimer(
+		Pending.TimeoutHandle,
+		[WeakWidget]() {
+			ExecutePendingWidget(TWeakPtr<SWidget>(WeakWidget), true);
+		},
+		Timeout, false);
+}
 
-	TWeakPtr<SWidget> WeakWidget = InWidget;
+void FUMFocusHelpers::ExecutePendingWidget(
+	const TWeakPtr<SWidget> WeakWidget, const bool bTimedOut)
+{
+	// Cancelling unbinds the calling delegate; only rely on our own copies here.
+	LogRequestLatency(PendingWidgetExecution, TEXT("Widget execution"), bTimedOut);
+	CancelPendingRequest(PendingWidgetExecution);
 
-	TimerManager->SetTimer(
-		TimerHandleRef,
-		[&SlateApp, WeakWidget]() {
-			if (const TSharedPtr<SWidget> Widget = WeakWidget.Pin())
-				HandleWidgetExecution(SlateApp, Widget.ToSharedRef());
-		},
-		Delay, false);
+	if (const TSharedPtr<SWidget> Widget = WeakWidget.Pin())
+		HandleWidgetExecution(FSlateApplication::Get(), Widget.ToSharedRef());
 }
 
 void FUMFocusHelpers::ClickSButton(FSlateApplication& SlateApp, const TSharedRef<SWidget> InWidget)
@@ -322,22 +346,33 @@ bool FUMFocusHelpers::TryFocusPopupMenu(FSlateApplication& SlateApp)
 }
 
 void FUMFocusHelpers::TryFocusFuturePopupMenu(FSlateApplication& SlateApp,
-	FTimerHandle* TimerHandle, const float Delay)
+	const float Timeout)
 {
-	TSharedRef<FTimerManager> TimerManager = GEditor->GetTimerManager();
-	FTimerHandle			  LocalTimerHandle;
-	FTimerHandle&			  TimerHandleRef =
-		TimerHandle ? *TimerHandle : LocalTimerHandle;
-
-	if (TimerHandle)
-		TimerManager->ClearTimer(TimerHandleRef);
-
-	TimerManager->SetTimer(
-		TimerHandleRef,
-		[&SlateApp]() {
-			TryFocusPopupMenu(SlateApp);
+	FPendingWindowRequest& Pending = PendingPopupMenuFocus;
+	WaitForRenderedWindow(
+		Pending,
+		Timeout,
+		[&SlateApp, &Pending](SWindow& RenderedWindow) {
+			if (!IsMenuWindow(RenderedWindow))
+				return false;
+
+			const TSharedPtr<SWindow> ParentWin = RenderedWindow.GetParentWindow();
+			const TSharedPtr<SWindow> ActiveWin = SlateApp.GetActiveTopLevelRegularWindow();
+			if (!ParentWin.IsValid() || !ActiveWin.IsValid()
+				|| ParentWin->GetId() != ActiveWin->GetId())
+				return false;
+
+			// The content may still be populating; keep waiting if so.
+			if (!BringFocusToPopupMenu(SlateApp, RenderedWindow.GetContent()))
+				return false;
+
+			LogRequestLatency(Pending, TEXT("Popup menu focus"), false);
+			return true;
 		},
-		Delay, false);
+		[&SlateApp, &Pending]() {
+			LogRequestLatency(Pending, TEXT("Popup menu focus"), true);
+			TryFocusPopupMenu(SlateApp);
+		});
 }
 
 bool FUMFocusHelpers::BringFocusToPopupMenu(FSlateApplication& SlateApp, TSharedRef<SWidget> WinContent)
@@ -382,25 +417,99 @@ bool FUMFocusHelpers::TryFocusSubMenu(FSlateApplication& SlateApp, const TShared
 	return BringFocusToPopupMenu(SlateApp, ChildWins[0]->GetContent());
 }
 
-void FUMFocusHelpers::TryFocusFutureSubMenu(FSlateApplication& SlateApp, const TSharedRef<SWindow> ParentMenuWindow, FTimerHandle* TimerHandle, const float Delay)
+void FUMFocusHelpers::TryFocusFutureSubMenu(FSlateApplication& SlateApp, const TSharedRef<SWindow> ParentMenuWindow, const float Timeout)
 {
-	TSharedRef<FTimerManager> TimerManager = GEditor->GetTimerManager();
-	FTimerHandle			  LocalTimerHandle;
-	FTimerHandle&			  TimerHandleRef =
-		TimerHandle ? *TimerHandle : LocalTimerHandle;
+	FPendingWindowRequest& Pending = PendingSubMenuFocus;
+	const TWeakPtr<SWindow> WeakParentMenuWin = ParentMenuWindow;
+	const uint64			ParentMenuWinId = ParentMenuWindow->GetId();
 
-	if (TimerHandle)
-		TimerManager->ClearTimer(TimerHandleRef);
+	WaitForRenderedWindow(
+		Pending,
+		Timeout,
+		[&SlateApp, &Pending, ParentMenuWinId](SWindow& RenderedWindow) {
+			const TSharedPtr<SWindow> ParentWin = RenderedWindow.GetParentWindow();
+			if (!ParentWin.IsValid() || ParentWin->GetId() != ParentMenuWinId)
+				return false;
 
-	const TWeakPtr<SWindow> WeakParentMenuWin = ParentMenuWindow;
+			if (!BringFocusToPopupMenu(SlateApp, RenderedWindow.GetContent()))
+				return false;
 
-	TimerManager->SetTimer(
-		TimerHandleRef,
-		[&SlateApp, WeakParentMenuWin]() {
+			LogRequestLatency(Pending, TEXT("Sub-menu focus"), false);
+			return true;
+		},
+		[&SlateApp, &Pending, WeakParentMenuWin]() {
+			LogRequestLatency(Pending, TEXT("Sub-menu focus"), true);
 			if (const TSharedPtr<SWindow> ParentWin = WeakParentMenuWin.Pin())
 				TryFocusSubMenu(SlateApp, ParentWin.ToSharedRef());
+		});
+}
+
+void FUMFocusHelpers::WaitForRenderedWindow(FPendingWindowRequest& Pending,
+	const float Timeout, TFunction<bool(SWindow&)> OnWindowRendered,
+	TFunction<void()> OnTimeout)
+{
+	CancelPendingRequest(Pending);
+
+	FSlateRenderer* Renderer = FSlateApplication::Get().GetRenderer();
+	if (!Renderer)
+	{
+		OnTimeout();
+		return;
+	}
+
+	// A new menu window is only worth looking into once it's been rendered, as
+	// that's when its content is populated & arranged. Menu windows that were
+	// already up before the request are rendered again too, so they're caught
+	// on the very next frame.
+	Pending.RequestTime = FPlatformTime::Seconds();
+	Pending.DelegateHandle = Renderer->OnSlateWindowRendered().AddLambda(
+		[&Pending, OnWindowRendered](SWindow& RenderedWindow, void*) {
+			if (OnWindowRendered(RenderedWindow))
+				CancelPendingRequest(Pending);
+		});
+
+	GEditor->GetTimerManager()->SetTimer(
+		Pending.TimeoutHandle,
+		[&Pending, OnTimeout]() {
+			const TFunction<void()> OnTimeoutCopy = OnTimeout;
+			CancelPendingRequest(Pending);
+			OnTimeoutCopy();
 		},
-		Delay, false);
+		Timeout, false);
+}
+
+void FUMFocusHelpers::CancelPendingRequest(FPendingWindowRequest& Pending)
+{
+	if (Pending.DelegateHandle.IsValid())
+	{
+		FSlateApplication& SlateApp = FSlateApplication::Get();
+		if (&Pending == &PendingWidgetExecution)
+			SlateApp.OnPostTick().Remove(Pending.DelegateHandle);
+		else if (FSlateRenderer* Renderer = SlateApp.GetRenderer())
+			Renderer->OnSlateWindowRendered().Remove(Pending.DelegateHandle);
+
+		Pending.DelegateHandle.Reset();
+	}
+
+	if (GEditor)
+		GEditor->GetTimerManager()->ClearTimer(Pending.TimeoutHandle);
+}
+
+bool FUMFocusHelpers::IsMenuWindow(const SWindow& InWindow)
+{
+	FChildren* Children = const_cast<SWindow&>(InWindow).GetChildren();
+	return Children && Children->Num() > 0
+		&& Children->GetChildAt(0)->GetTypeAsString().Equals(
+			"MenuStackInternal::SMenuContentWrapper");
+}
+
+void FUMFocusHelpers::LogRequestLatency(
+	const FPendingWindowRequest& Pending, const TCHAR* What, const bool bTimedOut)
+{
+	const double LatencyMs = (FPlatformTime::Seconds() - Pending.RequestTime) * 1000.0;
+	Logger.Print(FString::Printf(TEXT("%s after %.1f ms (%s)"),
+					 What, LatencyMs, bTimedOut ? TEXT("timeout") : TEXT("event")),
+		bTimedOut ? ELogVerbosity::Warning : ELogVerbosity::Verbose);
 }
 
 void FUMFocusHelpers::LogWidgetType(const TSharedRef<SWidget> InWidget)
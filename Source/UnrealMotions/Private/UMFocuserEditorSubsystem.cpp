@@ -14,6 +14,8 @@
 #include "UMFocusVisualizer.h"
 #include "UMConfig.h"
 #include "UMFocusHelpers.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 // DEFINE_LOG_CATEGORY_STATIC(UMFocuserEditorSubsystem, NoLogging, All); // Prod
 DEFINE_LOG_CATEGORY_STATIC(UMFocuserEditorSubsystem, Log, All); // Dev
@@ -32,6 +34,14 @@ void UUMFocuserEditorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	Logger = FUMLogger(&UMFocuserEditorSubsystem);
 	ListNavigationManager.Logger = &Logger;
 	ListNavigationManager.FocuserSub = this;
+	ListNavigationManager.LoadJumpLists();
+
+	TSharedRef<FUMConfig> Config = FUMConfig::Get();
+	WidgetHistory.Configure(
+		Config->GetWidgetHistoryDepth(),
+		Config->GetWidgetHistoryPartitionDepth(),
+		Config->IsWidgetHistoryPartitionedByTab(),
+		Config->IsWidgetHistoryPartitionedByWindow());
 
 	FCoreDelegates::OnPostEngineInit.AddUObject(
 		this, &UUMFocuserEditorSubsystem::RegisterSlateEvents);
@@ -51,6 +61,8 @@ void UUMFocuserEditorSubsystem::Deinitialize()
 	GTM->OnActiveTabChanged_Unsubscribe(DelegateHandle_OnActiveTabChanged);
 	GTM->OnTabForegrounded_Unsubscribe(DelegateHandle_OnTabForegrounded);
 
+	ListNavigationManager.SaveJumpLists();
+
 	if (GEditor && GEditor->IsTimerManagerValid())
 		GEditor->GetTimerManager()->ClearAllTimersForObject(this);
 
@@ -170,7 +182,7 @@ void UUMFocuserEditorSubsystem::OnFocusChanged(const FFocusEvent& FocusEvent, co
 			return;
 		}
 
-		RecordWidgetUse(NewWidgetRef);
+		RecordWidgetUse(NewWidgetRef, NewWidgetPath);
 
 		// Don't track if in a None-Regular Window (probably Menu Window)
 		if (FUMSlateHelpers::DoesWidgetResidesInRegularWindow(
@@ -248,6 +260,9 @@ void UUMFocuserEditorSubsystem::OnTabForegrounded(
 	if (NewActiveTab->GetVisualTabRole() != ETabRole::MajorTab)
 		return; // Minor Tabs are handled automatically by OnActiveTabChanged
 
+	// Closing a Major Tab foregrounds another; let go of the ones since gone.
+	WidgetHistory.PruneEmptyPartitions();
+
 	const TSharedRef<SDockTab> TabRef = NewActiveTab.ToSharedRef();
 
 	// if Nomad Tab, we need to manually call the TryActivate as it isn't picked
@@ -678,20 +693,20 @@ bool UUMFocuserEditorSubsystem::TryRegisterWidgetWithTab()
 bool UUMFocuserEditorSubsystem::TryRegisterWidgetWithTab(
 	const TSharedRef<SDockTab> InTab)
 {
-	for (const TWeakPtr<SWidget>& WidgetWeakPtr : RecentlyUsedWidgets)
+	// Find the most recent widget that lives in the new tab; starting with the
+	// history of the Major Tab & Window hosting it (if partitioned).
+	const TSharedPtr<SWindow> TabWindow = InTab->GetParentWindow();
+	if (const TSharedPtr<SWidget> WidgetPtr = WidgetHistory.FindMostRecent(
+			GetHistoryPartitionTabId(InTab), TabWindow.IsValid() ? TabWindow->GetId() : 0,
+			[&InTab](const TSharedRef<SWidget>& Widget) {
+				return FUMSlateHelpers::DoesWidgetResideInTab(InTab, Widget);
+			}))
 	{
-		if (const TSharedPtr<SWidget> WidgetPtr = WidgetWeakPtr.Pin())
-		{
-			// if found the most recent widget that lives in the new tab
-			const TSharedRef<SWidget> WidgetRef = WidgetPtr.ToSharedRef();
-			if (FUMSlateHelpers::DoesWidgetResideInTab(InTab, WidgetRef))
-			{
-				LastActiveWidgetByTabId.Add(InTab->GetId(), WidgetWeakPtr);
+		const TSharedRef<SWidget> WidgetRef = WidgetPtr.ToSharedRef();
+		LastActiveWidgetByTabId.Add(InTab->GetId(), WidgetPtr);
 
-				Log_TryRegisterWidgetWithTab(InTab, WidgetRef);
-				return true;
-			}
-		}
+		Log_TryRegisterWidgetWithTab(InTab, WidgetRef);
+		return true;
 	}
 	Log_TryRegisterWidgetWithTab(InTab, nullptr);
 	return false;
@@ -816,41 +831,106 @@ void UUMFocuserEditorSubsystem::ActivateTab(const TSharedRef<SDockTab> InTab)
 	// FGlobalTabmanager::Get()->SetActiveTab(InTab);
 }
 
-void UUMFocuserEditorSubsystem::RecordWidgetUse(TSharedRef<SWidget> InWidget)
+void UUMFocuserEditorSubsystem::RecordWidgetUse(
+	TSharedRef<SWidget> InWidget, const FWidgetPath& InWidgetPath)
 {
-	// Convert to TWeakPtr so we don’t keep it alive after it is destroyed.
-	TWeakPtr<SWidget> WeakWidget = InWidget;
+	FWidgetPath WidgetPath = InWidgetPath;
+	if (!WidgetPath.IsValid())
+		FSlateApplication::Get().FindPathToWidget(InWidget, WidgetPath);
+
+	// File it under the tab that hosts it (which isn't necessarily the
+	// active one, e.g. when focusing into a Nomad Tab); else globally only.
+	uint64 MajorTabId = 0;
+	if (const TSharedPtr<SDockTab> HostTab = FindActiveTabHostingWidget(WidgetPath))
+		MajorTabId = GetHistoryPartitionTabId(HostTab.ToSharedRef());
+
+	WidgetHistory.RecordWidgetUse(
+		InWidget, MajorTabId, WidgetPath.IsValid() ? WidgetPath.GetWindow()->GetId() : 0);
+}
+
+TSharedPtr<SDockTab> UUMFocuserEditorSubsystem::FindActiveTabHostingWidget(
+	const FWidgetPath& InWidgetPath)
+{
+	if (!InWidgetPath.IsValid())
+		return nullptr;
+
+	auto IsHosting = [&InWidgetPath](const TSharedPtr<SDockTab>& Tab) {
+		return Tab.IsValid() && InWidgetPath.ContainsWidget(&Tab->GetContent().Get());
+	};
+
+	// Cheapest first; the de facto Major Tab walks the active window.
+	const TSharedPtr<SDockTab> ActiveTab = FGlobalTabmanager::Get()->GetActiveTab();
+	if (IsHosting(ActiveTab))
+		return ActiveTab;
+
+	const TSharedPtr<SDockTab> OfficialMajorTab = FUMSlateHelpers::GetOfficialMajorTab();
+	if (IsHosting(OfficialMajorTab))
+		return OfficialMajorTab;
+
+	const TSharedPtr<SDockTab> DefactoMajorTab = FUMSlateHelpers::GetDefactoMajorTab();
+	if (IsHosting(DefactoMajorTab))
+		return DefactoMajorTab;
+
+	return nullptr;
+}
 
-	for (int32 i = 0; i < RecentlyUsedWidgets.Num();)
+uint64 UUMFocuserEditorSubsystem::GetHistoryPartitionTabId(
+	const TSharedRef<SDockTab> InTab)
+{
+	if (InTab->GetVisualTabRole() == ETabRole::MajorTab)
+		return InTab->GetId(); // Major & Nomad Tabs are their own partition
+
+	if (const TSharedPtr<FTabManager> TabManager = InTab->GetTabManagerPtr())
 	{
-		if (const TSharedPtr<SWidget>& Widget = RecentlyUsedWidgets[i].Pin())
-		{
-			// Check if this is the widget we want to promote
-			if (InWidget->GetId() == Widget->GetId())
-			{
-				// Remove it from the current position and reinsert at the front
-				RecentlyUsedWidgets.RemoveAt(i);
-				RecentlyUsedWidgets.Insert(WeakWidget, 0);
-				return; // Widget found, return.
-			}
-			++i;
-		}
-		else
-		// Remove invalid widget (stale reference)
-		// Do not increment i because the array has shifted
-		{
-			RecentlyUsedWidgets.RemoveAt(i);
-			Logger.Print("Removed invalid widget from recording.", ELogVerbosity::Warning);
-		}
+		if (const TSharedPtr<SDockTab> ParentMajorTab =
+				FGlobalTabmanager::Get()->GetMajorTabForTabManager(
+					TabManager.ToSharedRef()))
+			return ParentMajorTab->GetId();
+	}
+	return InTab->GetId();
+}
+
+bool UUMFocuserEditorSubsystem::TryFocusPreviousWidget(const bool bInActiveTab)
+{
+	FSlateApplication&		  SlateApp = FSlateApplication::Get();
+	const TSharedPtr<SWidget> FocusedWidget = SlateApp.GetUserFocusedWidget(0);
+	const uint64			  IgnoreWidgetId =
+		 FocusedWidget.IsValid() ? FocusedWidget->GetId() : 0;
+
+	TSharedPtr<SWidget> PrevWidget;
+	if (bInActiveTab)
+	{
+		const TSharedPtr<SDockTab> ActiveMajorTab = FUMSlateHelpers::GetActiveMajorTab();
+		if (!ActiveMajorTab.IsValid())
+			return false;
+
+		const TSharedRef<SDockTab> MajorTabRef = ActiveMajorTab.ToSharedRef();
+		const TSharedPtr<SWindow>  TabWindow = ActiveMajorTab->GetParentWindow();
+		PrevWidget = WidgetHistory.FindMostRecent(
+			GetHistoryPartitionTabId(MajorTabRef), TabWindow.IsValid() ? TabWindow->GetId() : 0,
+			[IgnoreWidgetId, &MajorTabRef](const TSharedRef<SWidget>& Widget) {
+				return Widget->GetId() != IgnoreWidgetId
+					&& FUMSlateHelpers::DoesWidgetResideInTab(MajorTabRef, Widget);
+			});
+	}
+	else
+		PrevWidget = WidgetHistory.GetPreviousWidget(IgnoreWidgetId);
+
+	if (!PrevWidget.IsValid())
+	{
+		Logger.Print("No previous widget to focus.", ELogVerbosity::Warning, true);
+		return false;
 	}
 
-	// If we didn’t find the widget, add it to the front
-	RecentlyUsedWidgets.Insert(WeakWidget, 0);
+	// The widget may live in a different window (when jumping globally)
+	if (const TSharedPtr<SWindow> Win = SlateApp.FindWidgetWindow(PrevWidget.ToSharedRef()))
+	{
+		if (!Win->IsActive())
+			FUMSlateHelpers::ActivateWindow(Win.ToSharedRef());
+	}
 
-	// Enforce size limit
-	const int32 MaxSize = 10;
-	if (RecentlyUsedWidgets.Num() > MaxSize)
-		RecentlyUsedWidgets.SetNum(MaxSize); // Shrink the array if it exceeds Max
+	SlateApp.SetAllUserFocus(PrevWidget, EFocusCause::Navigation);
+	return true;
 }
 
 FString UUMFocuserEditorSubsystem::TabRoleToString(ETabRole InTabRole)
@@ -877,6 +957,9 @@ void UUMFocuserEditorSubsystem::OnWindowBeingDestroyed(const SWindow& Window)
 	if (!Window.IsRegularWindow())
 		return; // Ignoring all none-regular windows, like notification windows.
 
+	WidgetHistory.RemoveWindowPartition(Window.GetId());
+	ListNavigationManager.OnWindowBeingDestroyed(Window);
+
 	// NOTE:
 	// We want to have a small delay to only start searching after the window
 	// is completey destroyed. Otherwise we will still catch that same winodw
@@ -1110,98 +1193,32 @@ void UUMFocuserEditorSubsystem::Log_OnFocusChanged(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-//				~ FGraphSelectionTracker Implementation ~ //
-UUMFocuserEditorSubsystem::FListNavigationManager::FTrackedInst::FTrackedInst(
-	TWeakPtr<SWidget>  InWidget,
-	TWeakPtr<SWindow>  InParentWindow,
-	TWeakPtr<SDockTab> InParentMajorTab,
-	bool			   InbParentNomadTab,
-	TWeakPtr<SDockTab> InParentMinorTab)
-{
-	Widget = InWidget;
-	ParentWindow = InParentWindow;
-	ParentMajorTab = InParentMajorTab;
-	bIsParentNomadTab = InbParentNomadTab;
-	ParentMinorTab = InParentMinorTab;
-}
-
-bool UUMFocuserEditorSubsystem::FListNavigationManager::FTrackedInst::IsValid()
-{
-	return (Widget.IsValid() && ParentWindow.IsValid() && ParentMajorTab.IsValid()
-		&& (bIsParentNomadTab || ParentMinorTab.IsValid()));
-}
-
+//				~ FListNavigationManager Implementation ~ //
 void UUMFocuserEditorSubsystem::FListNavigationManager::Push(
-	TSharedRef<SWidget>	 InWidget,
-	TSharedRef<SWindow>	 InParentWindow,
-	TSharedRef<SDockTab> InParentMajorTab,
-	bool				 InbParentNomadTab,
-	TSharedPtr<SDockTab> InParentMinorTab)
+	const FUMJumpEntry& InEntry, const TSharedRef<SWindow> InParentWindow)
 {
-	// if (!TrackedWidgets.IsEmpty())
-	// {
-	// 	for (int32 i = TrackedWidgets.Num() - 1; i >= 0; --i)
-	// 	{
-	// 		if (!TrackedWidgets[i].IsValid())
-	// 		{
-	// 			TrackedWidgets.RemoveAt(i); // Remove invalid widgets
-	// 			continue;
-	// 		}
-	// 		else if (TrackedWidgets[i].Widget.Pin()->GetId() == InWidget->GetId())
-	// 		{
-	// 			TrackedWidgets.RemoveAt(i); // No duplicates
-	// 			break;
-	// 		}
-	// 	}
-	// }
-
 	if (bHasJumpedToNewWidget)
 	{
 		bHasJumpedToNewWidget = false;
 		return;
 	}
 
-	TrackedWidgets.RemoveAll([&](const FTrackedInst& Inst) {
-		if (const TSharedPtr<SWidget> Widget = Inst.Widget.Pin())
-		{
-			return Widget->GetId() == InWidget->GetId();
-		}
-		return true;
-	});
-
-	while (TrackedWidgets.Num() > CAP) // Shrink the array if it exceeds Max
-		TrackedWidgets.RemoveAt(TrackedWidgets.Num() - 1);
-
-	// if our currently focused widget is a widget we've previously jumped to:
-	// we want it to be behind the upcoming new widget (for continuity)
-	if (CurrWidgetIndex != 0
-		&& TrackedWidgets.IsValidIndex(CurrWidgetIndex)
-		&& TrackedWidgets[CurrWidgetIndex].IsValid())
-	{
-		FTrackedInst Temp = TrackedWidgets[CurrWidgetIndex];
-		TrackedWidgets.RemoveAt(CurrWidgetIndex);
-		TrackedWidgets.Insert(Temp, 0);
-	}
-
-	TrackedWidgets.Insert(FTrackedInst(InWidget, InParentWindow, InParentMajorTab, InbParentNomadTab, InParentMinorTab), 0);
-	CurrWidgetIndex = 0; // We're at the front when a new widget is added, right?
+	GlobalJumpList.Push(InEntry);
+	FindOrAddWindowJumpList(InParentWindow).Push(InEntry);
 }
 
 // TODO: Figure out what's going on with pop-up windows -> they seem to crash
 void UUMFocuserEditorSubsystem::FListNavigationManager::TrackFocusedWidget(const TSharedRef<SWidget> NewWidget)
 {
-	TWeakPtr<SWidget>		  WeakNewWidget = NewWidget;
 	TSharedRef<FTimerManager> TimerManager = GEditor->GetTimerManager();
 	TimerManager->ClearTimer(TimerHandle_TrackFocusedWidget);
 	FSlateApplication& SlateApp = FSlateApplication::Get();
 
-	// TSharedPtr<SWindow> ParentWindow = SlateApp.FindWidgetWindow(NewWidget);
 	TSharedPtr<SWindow> ParentWindow = SlateApp.GetActiveTopLevelRegularWindow();
 	if (!ParentWindow.IsValid())
 		return;
 
-	TSharedRef<FGlobalTabmanager> GTM = FGlobalTabmanager::Get();
-	TSharedPtr<SDockTab>		  ActiveMajorTab = FUMSlateHelpers::GetActiveMajorTab();
+	TSharedPtr<SDockTab> ActiveMajorTab = FUMSlateHelpers::GetActiveMajorTab();
 	if (!ActiveMajorTab.IsValid())
 		return;
 	TSharedPtr<SDockTab> ActiveMinorTab = nullptr;
@@ -1210,130 +1227,291 @@ void UUMFocuserEditorSubsystem::FListNavigationManager::TrackFocusedWidget(const
 	if (!bIsParentNomadTab)
 		ActiveMinorTab = FUMSlateHelpers::GetActiveMinorTab();
 
-	// Maybe should be checked?
-	// FUMSlateHelpers::DoesWidgetResideInTab(
-	// 	ActiveMajorTab.ToSharedRef(), NewWidget);
+	FUMJumpEntry Entry;
+	Entry.Widget = NewWidget;
+	Entry.ParentWindow = ParentWindow;
+	Entry.ParentMajorTab = ActiveMajorTab;
+	Entry.ParentMinorTab = ActiveMinorTab;
+	Entry.bIsParentNomadTab = bIsParentNomadTab;
 
-	// Track widget params:
-	Push(NewWidget, ParentWindow.ToSharedRef(),
-		ActiveMajorTab.ToSharedRef(), bIsParentNomadTab, ActiveMinorTab);
-	// },
-	// 0.3f /* Test */, false);
+	if (FUMWidgetSignature::Make(NewWidget, ActiveMajorTab.ToSharedRef(),
+			ActiveMinorTab, Entry.Signature))
+		AddLiveEntry(Entry);
+
+	Push(Entry, ParentWindow.ToSharedRef());
 }
 
-void UUMFocuserEditorSubsystem::FListNavigationManager::JumpListNavigation(
-	FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+bool UUMFocuserEditorSubsystem::FListNavigationManager::TryResolveEntry(
+	FUMJumpEntry& InOutEntry)
 {
-	if (TrackedWidgets.IsEmpty())
-		return;
-
-	// Logger->Print(FString::Printf(TEXT("Current Index: %d"),
-	// 				  CurrWidgetIndex),
-	// 	ELogVerbosity::Log, true);
+	if (InOutEntry.IsLive())
+		return true;
 
-	const FKey InKey = InKeyEvent.GetKey();
-	int32	   TempIndex = CurrWidgetIndex;
+	const FUMWidgetSignature& Signature = InOutEntry.Signature;
+	if (!Signature.IsValid())
+		return false;
 
-	if (InKey == FKey(EKeys::I)) // In
+	// 1. One lookup: the widget was already seen since the (re)opening.
+	if (const FUMJumpEntry* LiveEntry = LiveEntriesBySignature.Find(Signature))
 	{
-		if (TempIndex <= 0)
+		if (LiveEntry->IsLive())
 		{
-			// Logger->Print("Can't Jump: Index is at top-of-stack", ELogVerbosity::Warning);
-			CurrWidgetIndex = 0;
-			return; // We're at the top of the stack: No widgets to go into
+			InOutEntry = *LiveEntry;
+			return true;
 		}
+		LiveEntriesBySignature.Remove(Signature); // Stale
+	}
 
-		--TempIndex;
+	// 2. The hosting tabs must be alive for the widget to exist at all.
+	TSharedRef<FGlobalTabmanager> GTM = FGlobalTabmanager::Get();
+	const TSharedPtr<SDockTab>	  MajorTab = FindLiveMajorTab(Signature);
+	if (!MajorTab.IsValid())
+		return false;
 
-		while (!TrackedWidgets[TempIndex].IsValid())
-		{
-			TrackedWidgets.RemoveAt(TempIndex);
+	TSharedPtr<SDockTab> MinorTab;
+	if (!Signature.MinorTabLayoutId.IsNone())
+	{
+		const TSharedPtr<FTabManager> TabManager =
+			GTM->GetTabManagerForMajorTab(MajorTab);
+		if (!TabManager.IsValid())
+			return false;
 
-			if (TempIndex <= 0 || TrackedWidgets.IsEmpty())
-			{
-				// Logger->Print("Can't Jump: Index is at top-of-stack", ELogVerbosity::Warning);
-				CurrWidgetIndex = 0;
-				return; // No widgets to go into
-			}
+		MinorTab = TabManager->FindExistingLiveTab(FTabId(Signature.MinorTabLayoutId));
+		if (!MinorTab.IsValid())
+			return false;
+	}
+
+	// 3. Walk straight down to the widget by its child indices.
+	const TSharedPtr<SWidget> Widget = Signature.FindWidgetInTab(
+		MinorTab.IsValid() ? MinorTab.ToSharedRef() : MajorTab.ToSharedRef());
+	if (!Widget.IsValid())
+		return false;
+
+	InOutEntry.Widget = Widget;
+	InOutEntry.ParentWindow = MajorTab->GetParentWindow();
+	InOutEntry.ParentMajorTab = MajorTab;
+	InOutEntry.ParentMinorTab = MinorTab;
+	InOutEntry.bIsParentNomadTab = MajorTab->GetTabRole() == ETabRole::NomadTab;
+	if (!InOutEntry.IsLive())
+		return false;
+
+	AddLiveEntry(InOutEntry);
+	return true;
+}
+
+TSharedPtr<SDockTab> UUMFocuserEditorSubsystem::FListNavigationManager::FindLiveMajorTab(
+	const FUMWidgetSignature& InSignature)
+{
+	// Asset editors share their layout id; the edited asset tells them apart.
+	if (!InSignature.AssetPath.IsEmpty())
+		return InSignature.FindAssetEditorTab();
+
+	const TSharedPtr<SDockTab> MajorTab =
+		FGlobalTabmanager::Get()->FindExistingLiveTab(FTabId(InSignature.MajorTabLayoutId));
+	if (!MajorTab.IsValid()
+		|| !MajorTab->GetTabLabel().ToString().Equals(InSignature.MajorTabLabel))
+		return nullptr;
 
-			--TempIndex;
+	return MajorTab;
+}
+
+void UUMFocuserEditorSubsystem::FListNavigationManager::AddLiveEntry(const FUMJumpEntry& InEntry)
+{
+	if (LiveEntriesBySignature.Num() >= LiveEntriesPruneThreshold
+		&& !LiveEntriesBySignature.Contains(InEntry.Signature))
+	{
+		// Only what a jumplist may jump to is worth resolving
+		TSet<FUMWidgetSignature> Referenced;
+		auto CollectReferenced = [&Referenced](const FUMJumpList& List) {
+			for (int32 i = 0; i < List.Num(); ++i)
+				Referenced.Add(List.Get(i).Signature);
+		};
+		CollectReferenced(GlobalJumpList);
+		for (const TPair<uint64, FUMJumpList>& Pair : JumpListsByWindowId)
+			CollectReferenced(Pair.Value);
+		for (const TPair<FString, TArray<FUMJumpList>>& Pair : JumpListsByWindowTitle)
+		{
+			for (const FUMJumpList& List : Pair.Value)
+				CollectReferenced(List);
+		}
+
+		for (auto It = LiveEntriesBySignature.CreateIterator(); It; ++It)
+		{
+			if (!It.Value().IsLive() || !Referenced.Contains(It.Key()))
+				It.RemoveCurrent();
 		}
+		// Don't prune again on every add if most of them are still referenced
+		LiveEntriesPruneThreshold = FMath::Max(MaxLiveEntries, 2 * LiveEntriesBySignature.Num());
 	}
-	else // Out
+	LiveEntriesBySignature.Add(InEntry.Signature, InEntry);
+}
+
+FUMJumpList& UUMFocuserEditorSubsystem::FListNavigationManager::FindOrAddWindowJumpList(
+	const TSharedRef<SWindow> InWindow)
+{
+	const uint64 WindowId = InWindow->GetId();
+	if (FUMJumpList* JumpList = JumpListsByWindowId.Find(WindowId))
+		return *JumpList;
+
+	// Restore the list this window had before it was closed (or before the
+	// editor was restarted) if we have any.
+	const FString WindowTitle = InWindow->GetTitle().ToString();
+	FUMJumpList&  NewJumpList = JumpListsByWindowId.Add(WindowId);
+	if (TArray<FUMJumpList>* ParkedJumpLists = JumpListsByWindowTitle.Find(WindowTitle))
 	{
-		int32 NumOfWidgets = TrackedWidgets.Num() - 1; // 0 index
+		NewJumpList = ParkedJumpLists->Pop();
+		if (ParkedJumpLists->IsEmpty())
+			JumpListsByWindowTitle.Remove(WindowTitle);
+	}
+	NewJumpList.WindowTitle = WindowTitle;
+	return NewJumpList;
+}
 
-		if (TempIndex == NumOfWidgets)
-			return; // We're at the bottom of the stack: No widgets to go out to
-		else if (TempIndex > NumOfWidgets)
+void UUMFocuserEditorSubsystem::FListNavigationManager::OnWindowBeingDestroyed(
+	const SWindow& InWindow)
+{
+	FUMJumpList JumpList;
+	if (!JumpListsByWindowId.RemoveAndCopyValue(InWindow.GetId(), JumpList))
+		return;
+
+	if (!JumpList.IsEmpty() && !JumpList.WindowTitle.IsEmpty())
+		JumpListsByWindowTitle.FindOrAdd(JumpList.WindowTitle).Add(JumpList);
+}
+
+FString UUMFocuserEditorSubsystem::FListNavigationManager::GetJumpListsFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("UnrealMotions") / TEXT("JumpLists.txt");
+}
+
+void UUMFocuserEditorSubsystem::FListNavigationManager::SaveJumpLists()
+{
+	// Line format: <List Key> \t <Nomad Flag> \t <Widget Signature>
+	// Window lists are keyed "Window:<Ordinal>:<Title>", as titles may repeat.
+	TArray<FString> Lines;
+	TMap<FString, int32> ListsPerTitle;
+	auto AppendJumpList = [&Lines](const FString& ListKey, const FUMJumpList& List) {
+		for (int32 i = 0; i < List.Num(); ++i) // Oldest to newest
 		{
-			CurrWidgetIndex = NumOfWidgets;
-			return; // We shouldn't really ever get here, but for safety.
+			const FUMJumpEntry& Entry = List.Get(i);
+			if (Entry.Signature.IsValid())
+				Lines.Add(FString::Printf(TEXT("%s\t%d\t%s"), *ListKey,
+					Entry.bIsParentNomadTab ? 1 : 0, *Entry.Signature.ToString()));
 		}
+	};
 
-		++TempIndex;
-		while (!TrackedWidgets[TempIndex].IsValid())
-		{
-			TrackedWidgets.RemoveAt(TempIndex);
+	auto AppendWindowJumpList = [&AppendJumpList, &ListsPerTitle](
+									const FString& WindowTitle, const FUMJumpList& List) {
+		const int32 Ordinal = ListsPerTitle.FindOrAdd(WindowTitle)++;
+		AppendJumpList(FString::Printf(TEXT("Window:%d:%s"), Ordinal, *WindowTitle), List);
+	};
 
-			NumOfWidgets = TrackedWidgets.Num();
-			if (NumOfWidgets == 0)
-			{
-				CurrWidgetIndex = 0;
-				return; // Empty Stack: No widgets to go out to
-			}
+	AppendJumpList(TEXT("Global"), GlobalJumpList);
+	for (const TPair<uint64, FUMJumpList>& Pair : JumpListsByWindowId)
+		AppendWindowJumpList(Pair.Value.WindowTitle, Pair.Value);
+	for (const TPair<FString, TArray<FUMJumpList>>& Pair : JumpListsByWindowTitle)
+	{
+		for (const FUMJumpList& List : Pair.Value)
+			AppendWindowJumpList(Pair.Key, List);
+	}
 
-			--NumOfWidgets; // 0 index
-			if (TempIndex >= NumOfWidgets)
-			{
-				CurrWidgetIndex = NumOfWidgets;
-				return; // Bottom of the stack: No widgets to go out to
-			}
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *GetJumpListsFilePath()))
+		Logger->Print("Could not save the jumplists.", ELogVerbosity::Warning);
+}
 
-			// We've removed a widget, so the array shrinked.
-			// We don't need to touch the TempIndex as it will now point to
-			// a new entry (if it exists)
+void UUMFocuserEditorSubsystem::FListNavigationManager::LoadJumpLists()
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *GetJumpListsFilePath()))
+		return; // Nothing saved yet
+
+	static const FString WindowPrefix = TEXT("Window:");
+	for (const FString& Line : Lines)
+	{
+		FString ListKey, NomadFlag, SignatureStr;
+		if (!Line.Split(TEXT("\t"), &ListKey, &SignatureStr)
+			|| !SignatureStr.Split(TEXT("\t"), &NomadFlag, &SignatureStr))
+			continue;
+
+		FUMJumpEntry Entry;
+		if (!Entry.Signature.InitFromString(SignatureStr))
+			continue;
+		Entry.bIsParentNomadTab = NomadFlag.Equals(TEXT("1"));
+
+		if (ListKey.StartsWith(WindowPrefix))
+		{
+			FString OrdinalStr, WindowTitle;
+			if (!ListKey.RightChop(WindowPrefix.Len()).Split(TEXT(":"), &OrdinalStr, &WindowTitle)
+				|| !OrdinalStr.IsNumeric())
+				continue;
+
+			TArray<FUMJumpList>& JumpLists = JumpListsByWindowTitle.FindOrAdd(WindowTitle);
+			const int32			 Ordinal = FMath::Clamp(FCString::Atoi(*OrdinalStr), 0, JumpLists.Num());
+			if (Ordinal == JumpLists.Num())
+				JumpLists.AddDefaulted();
+
+			JumpLists[Ordinal].WindowTitle = WindowTitle;
+			JumpLists[Ordinal].Push(Entry);
 		}
+		else
+			GlobalJumpList.Push(Entry);
+	}
+}
+
+void UUMFocuserEditorSubsystem::FListNavigationManager::JumpListNavigation(
+	FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent, const bool bGlobal)
+{
+	const TSharedPtr<SWindow> ActiveWindow = SlateApp.GetActiveTopLevelRegularWindow();
+
+	FUMJumpList* JumpList = &GlobalJumpList;
+	if (!bGlobal)
+	{
+		if (!ActiveWindow.IsValid())
+			return;
+		JumpList = JumpListsByWindowId.Find(ActiveWindow->GetId());
 	}
+	if (!JumpList || JumpList->IsEmpty())
+		return;
+
+	// In (Ctrl-I) goes towards newer entries, Out (Ctrl-O) towards older ones.
+	const int32	  Direction = InKeyEvent.GetKey() == EKeys::I ? 1 : -1;
+	FUMJumpEntry* JumpToEntry = JumpList->Step(Direction,
+		[this](FUMJumpEntry& Entry) { return TryResolveEntry(Entry); });
+	if (!JumpToEntry)
+		return; // Top or bottom of the stack: No widgets to go in-out to
 
 	// We've found a valid widget to go In-Out-to
-	FTrackedInst*		 JumpToWidget = &TrackedWidgets[TempIndex];
-	TSharedPtr<SWindow>	 TrackedWindow = JumpToWidget->ParentWindow.Pin();
-	TSharedPtr<SDockTab> TrackedMajorTab = JumpToWidget->ParentMajorTab.Pin();
-	TSharedPtr<SDockTab> TrackedMinorTab = JumpToWidget->ParentMinorTab.Pin();
-	TSharedPtr<SWidget>	 WidgetPtr = JumpToWidget->Widget.Pin();
-	bool				 bIsParentNomadTab = JumpToWidget->bIsParentNomadTab;
+	TSharedPtr<SWindow>	 TrackedWindow = JumpToEntry->ParentWindow.Pin();
+	TSharedPtr<SDockTab> TrackedMajorTab = JumpToEntry->ParentMajorTab.Pin();
+	TSharedPtr<SDockTab> TrackedMinorTab = JumpToEntry->ParentMinorTab.Pin();
+	TSharedPtr<SWidget>	 WidgetPtr = JumpToEntry->Widget.Pin();
 
 	Logger->Print(FString::Printf(TEXT("Valid Widget Found: %s | New Index: %d"),
-					  *WidgetPtr->GetTypeAsString(), TempIndex),
+					  *WidgetPtr->GetTypeAsString(), JumpList->GetCursor()),
 		ELogVerbosity::Verbose, true);
 
-	TSharedPtr<SWindow>	 ActiveWindow = SlateApp.GetActiveTopLevelRegularWindow();
-	TSharedPtr<SDockTab> ActiveMajorTab = FUMSlateHelpers::GetActiveMajorTab();
-	TSharedPtr<SDockTab> ActiveMinorTab = FUMSlateHelpers::GetActiveMinorTab();
-	if (!(ActiveWindow.IsValid() && ActiveMajorTab.IsValid() && ActiveMinorTab.IsValid()))
-		return;
-
 	// Activate the window of the new widget if it's not the current
-	if (ActiveWindow->GetId() != TrackedWindow->GetId())
+	if (!ActiveWindow.IsValid() || ActiveWindow->GetId() != TrackedWindow->GetId())
 		TrackedWindow->BringToFront(true);
 
 	// Activate the Major Tab of the new widget if it's not the current
-	if (ActiveMajorTab->GetId() != TrackedMajorTab->GetId())
+	const TSharedPtr<SDockTab> ActiveMajorTab = FUMSlateHelpers::GetActiveMajorTab();
+	if (!ActiveMajorTab.IsValid() || ActiveMajorTab->GetId() != TrackedMajorTab->GetId())
 		TrackedMajorTab->ActivateInParent(ETabActivationCause::SetDirectly);
 
 	// Activate the Minor Tab of the new widget if it's not the current
-	// + Make sure the parent Major Tab of the new widget isn't Nomad
-	else if (!bIsParentNomadTab /** Minor tab is nullptr if parent Maj=Nomad */
-		&& (ActiveMinorTab->GetId() != TrackedMinorTab->GetId()))
-		TrackedMinorTab->ActivateInParent(ETabActivationCause::SetDirectly);
+	// (Minor tab is nullptr if parent Major Tab is a Nomad Tab)
+	if (!JumpToEntry->bIsParentNomadTab && TrackedMinorTab.IsValid())
+	{
+		const TSharedPtr<SDockTab> ActiveMinorTab = FUMSlateHelpers::GetActiveMinorTab();
+		if (!ActiveMinorTab.IsValid() || ActiveMinorTab->GetId() != TrackedMinorTab->GetId())
+			TrackedMinorTab->ActivateInParent(ETabActivationCause::SetDirectly);
+	}
 
 	bHasJumpedToNewWidget = true; /* Bypass registration for jumped-to-widget */
 	SlateApp.SetAllUserFocus(WidgetPtr, EFocusCause::Navigation);
-	CurrWidgetIndex = TempIndex; // Update index
 }
 //
-//				~ FGraphSelectionTracker Implementation ~ //
+//				~ FListNavigationManager Implementation ~ //
 ///////////////////////////////////////////////////////////////////////////////
 
 void UUMFocuserEditorSubsystem::BindVimCommands()
@@ -1343,31 +1521,37 @@ void UUMFocuserEditorSubsystem::BindVimCommands()
 	TWeakObjectPtr<UUMFocuserEditorSubsystem> WeakFocuserSubsystem =
 		MakeWeakObjectPtr(this);
 
-	// /* Jump List Navigation: In */
-	// VimInputProcessor->AddKeyBinding_KeyEvent(
-	// 	EUMBindingContext::Generic,
-	// 	{ FInputChord(EModifierKey::Control, EKeys::I) },
-	// 	WeakFocuserSubsystem,
-	// 	// &FListNavigationManager::JumpListNavigation);
-	// 	[this](FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) {
+	/* Jump List Navigation (Active Window): In & Out */
+	for (const FKey& Key : { EKeys::I, EKeys::O })
+	{
+		VimInputProcessor->AddKeyBinding_KeyEvent(
+			EUMBindingContext::Generic,
+			{ FInputChord(EModifierKey::Control, Key) },
+			[this](FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) {
+				ListNavigationManager.JumpListNavigation(SlateApp, InKeyEvent, false);
+			});
+	}
 
-	// 	});
+	/* Jump List Navigation (Global): In & Out */
+	for (const FKey& Key : { EKeys::I, EKeys::O })
+	{
+		VimInputProcessor->AddKeyBinding_KeyEvent(
+			EUMBindingContext::Generic,
+			{ FInputChord(EModifierKey::FromBools(true, false, true, false), Key) },
+			[this](FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) {
+				ListNavigationManager.JumpListNavigation(SlateApp, InKeyEvent, true);
+			});
+	}
 
-	// /* Jump List Navigation: Out */
-	VimInputProcessor->AddKeyBinding_KeyEvent(
+	/* Previous Widget: In the active Major Tab */
+	VimInputProcessor->AddKeyBinding_NoParam(
 		EUMBindingContext::Generic,
-		{ FInputChord(EModifierKey::Control, EKeys::I) },
-		// WeakFocuserSubsystem,
-		[this](FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) {
-			ListNavigationManager.JumpListNavigation(SlateApp, InKeyEvent);
-		});
-
-	// /* Jump List Navigation: Out */
-	VimInputProcessor->AddKeyBinding_KeyEvent(
+		{ EKeys::G, EKeys::P },
+		[this]() { TryFocusPreviousWidget(true); });
+
+	/* Previous Widget: Globally */
+	VimInputProcessor->AddKeyBinding_NoParam(
 		EUMBindingContext::Generic,
-		{ FInputChord(EModifierKey::Control, EKeys::O) },
-		// WeakFocuserSubsystem,
-		[this](FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) {
-			ListNavigationManager.JumpListNavigation(SlateApp, InKeyEvent);
-		});
+		{ EKeys::G, FInputChord(EModifierKey::Shift, EKeys::P) },
+		[this]() { TryFocusPreviousWidget(false); });
 }
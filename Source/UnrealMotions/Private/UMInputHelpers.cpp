@@ -699,6 +699,75 @@ bool FUMInputHelpers::DragAndReleaseWidgetAtPosition(
 	return true;
 }
 
+bool FUMInputHelpers::DragAndDropWidgetImmediately(
+	const TSharedRef<SWidget> InWidget,
+	const TArray<FVector2f>&  TargetPositions)
+{
+	if (TargetPositions.IsEmpty())
+		return false;
+
+	FSlateApplication&		  SlateApp = FSlateApplication::Get();
+	const TSharedPtr<SWindow> SourceWindow = SlateApp.FindWidgetWindow(InWidget);
+	if (!SourceWindow.IsValid() || SlateApp.IsDragDropping())
+		return false;
+
+	const TSet<FKey> PressedButtons{ EKeys::LeftMouseButton };
+	const FVector2f	 StartPosition =
+		FUMSlateHelpers::GetWidgetCenterScreenSpacePosition(InWidget);
+	FVector2f LastPosition = StartPosition;
+
+	auto MoveTo = [&SlateApp, &PressedButtons, &LastPosition](const FVector2f NewPosition) {
+		SlateApp.ProcessMouseMoveEvent(FPointerEvent(
+			0,				 // PointerIndex
+			NewPosition,	 // ScreenSpacePosition (Goto)
+			LastPosition,	 // LastScreenSpacePosition (Prev)
+			PressedButtons,	 // Currently pressed buttons
+			EKeys::Invalid,	 // No new button pressed
+			0.0f,			 // WheelDelta
+			FModifierKeysState()));
+		LastPosition = NewPosition;
+	};
+
+	auto Release = [&SlateApp, &LastPosition]() {
+		SlateApp.ProcessMouseButtonUpEvent(FPointerEvent(
+			0,
+			LastPosition,
+			LastPosition,
+			TSet<FKey>(), // No buttons pressed now
+			EKeys::LeftMouseButton,
+			0.0f,
+			FModifierKeysState()));
+	};
+
+	// Press on the widget
+	SlateApp.ProcessMouseButtonDownEvent(SourceWindow->GetNativeWindow(),
+		FPointerEvent(
+			0,
+			0,
+			StartPosition,
+			StartPosition,
+			PressedButtons,
+			EKeys::LeftMouseButton,
+			0,
+			FModifierKeysState()));
+
+	// Cross the drag threshold in place so the widget starts its drag operation
+	MoveTo(StartPosition
+		+ FVector2f(SlateApp.GetDragTriggerDistance() + 1.0f, 0.0f));
+
+	if (!SlateApp.IsDragDropping())
+	{
+		Release();
+		return false;
+	}
+
+	for (const FVector2f& TargetPosition : TargetPositions)
+		MoveTo(TargetPosition);
+
+	Release(); // Drop
+	return true;
+}
+
 bool FUMInputHelpers::SimulateMousePressAtPosition(
 	const FVector2f TargetPosition,
 	const FKey		MouseButtonToSimulate)
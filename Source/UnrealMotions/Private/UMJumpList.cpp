@@ -0,0 +1,269 @@
+#include "UMJumpList.h"
+#include "Editor.h"
+#include "Framework/Docking/TabManager.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+
+///////////////////////////////////////////////////////////////////////////////
+//						~ FUMWidgetSignature ~
+//
+bool FUMWidgetSignature::Make(const TSharedRef<SWidget> InWidget,
+	const TSharedRef<SDockTab> InMajorTab, const TSharedPtr<SDockTab> InMinorTab,
+	FUMWidgetSignature& OutSignature)
+{
+	const TSharedRef<SDockTab> HostTab =
+		InMinorTab.IsValid() ? InMinorTab.ToSharedRef() : InMajorTab;
+	const SWidget* HostContent = &HostTab->GetContent().Get();
+
+	// Collect the chain from the widget up to the host tab's content.
+	TArray<TSharedRef<SWidget>, TInlineAllocator<32>> Chain;
+	TSharedPtr<SWidget>								  Curr = InWidget;
+	while (Curr.IsValid() && Curr.Get() != HostContent)
+	{
+		Chain.Add(Curr.ToSharedRef());
+		Curr = Curr->GetParentWidget();
+	}
+	if (!Curr.IsValid())
+		return false; // Widget doesn't live under this tab
+
+	// Fold top-down (from the tab content to the widget), so walking back down
+	// the child indices computes the very same hash incrementally.
+	uint32 Hash = GetTypeHash(HostContent->GetType());
+	OutSignature.ChildIndices.Reset(Chain.Num());
+	for (int32 i = Chain.Num() - 1; i >= 0; --i)
+	{
+		const TSharedRef<SWidget>& Widget = Chain[i];
+		const TSharedPtr<SWidget>  Parent = Widget->GetParentWidget();
+		int32					   ChildIndex = INDEX_NONE;
+
+		if (FChildren* Children = Parent.IsValid() ? Parent->GetChildren() : nullptr)
+		{
+			for (int32 c = 0; c < Children->Num(); ++c)
+			{
+				if (&Children->GetChildAt(c).Get() == &Widget.Get())
+				{
+					ChildIndex = c;
+					break;
+				}
+			}
+		}
+		Hash = HashPathLevel(Hash, Widget, ChildIndex);
+		OutSignature.ChildIndices.Add(ChildIndex);
+	}
+
+	OutSignature.MajorTabLayoutId = InMajorTab->GetLayoutIdentifier().TabType;
+	OutSignature.MajorTabLabel = InMajorTab->GetTabLabel().ToString();
+	OutSignature.MinorTabLayoutId = InMinorTab.IsValid()
+		? InMinorTab->GetLayoutIdentifier().TabType
+		: NAME_None;
+	OutSignature.AssetPath = GetEditedAssetPath(InMajorTab);
+	OutSignature.TypePathHash = Hash == 0 ? 1 : Hash; // 0 is reserved (invalid)
+	return true;
+}
+
+FString FUMWidgetSignature::GetEditedAssetPath(const TSharedRef<SDockTab> InMajorTab)
+{
+	if (InMajorTab->GetTabRole() != ETabRole::MajorTab || !GEditor)
+		return FString(); // Nomad tabs (Level Editor, etc.) edit no asset
+
+	UAssetEditorSubsystem* AssetEditorSubsystem =
+		GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+	if (!AssetEditorSubsystem)
+		return FString();
+
+	for (UObject* EditedAsset : AssetEditorSubsystem->GetAllEditedAssets())
+	{
+		IAssetEditorInstance* EditorInstance =
+			AssetEditorSubsystem->FindEditorForAsset(EditedAsset, false /*bFocusIfOpen*/);
+		if (!EditorInstance)
+			continue;
+
+		const TSharedPtr<FTabManager> TabManager = EditorInstance->GetAssociatedTabManager();
+		if (TabManager.IsValid() && TabManager->GetOwnerTab() == InMajorTab)
+			return EditedAsset->GetPathName();
+	}
+	return FString();
+}
+
+TSharedPtr<SDockTab> FUMWidgetSignature::FindAssetEditorTab() const
+{
+	if (AssetPath.IsEmpty() || !GEditor)
+		return nullptr;
+
+	// Only an editor that's open can host the widget; never load the asset.
+	UObject* Asset = FSoftObjectPath(AssetPath).ResolveObject();
+	if (!Asset)
+		return nullptr;
+
+	UAssetEditorSubsystem* AssetEditorSubsystem =
+		GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+	IAssetEditorInstance* EditorInstance = AssetEditorSubsystem
+		? AssetEditorSubsystem->FindEditorForAsset(Asset, false /*bFocusIfOpen*/)
+		: nullptr;
+	if (!EditorInstance)
+		return nullptr;
+
+	const TSharedPtr<FTabManager> TabManager = EditorInstance->GetAssociatedTabManager();
+	return TabManager.IsValid() ? TabManager->GetOwnerTab() : nullptr;
+}
+
+TSharedPtr<SWidget> FUMWidgetSignature::FindWidgetInTab(const TSharedRef<SDockTab> InHostTab) const
+{
+	TSharedRef<SWidget> Curr = InHostTab->GetContent();
+	uint32				Hash = GetTypeHash(Curr->GetType());
+	for (const int32 ChildIndex : ChildIndices)
+	{
+		FChildren* Children = Curr->GetChildren();
+		if (!Children || ChildIndex < 0 || ChildIndex >= Children->Num())
+			return nullptr;
+
+		Curr = Children->GetChildAt(ChildIndex);
+		Hash = HashPathLevel(Hash, Curr, ChildIndex);
+	}
+
+	if ((Hash == 0 ? 1 : Hash) != TypePathHash)
+		return nullptr; // Something else lives there now
+	return Curr;
+}
+
+uint32 FUMWidgetSignature::HashPathLevel(const uint32 ParentHash,
+	const TSharedRef<SWidget> InWidget, const int32 ChildIndex)
+{
+	return HashCombine(HashCombine(ParentHash, GetTypeHash(InWidget->GetType())),
+		GetTypeHash(ChildIndex));
+}
+
+FString FUMWidgetSignature::ToString() const
+{
+	TArray<FString> ChildIndexStrings;
+	ChildIndexStrings.Reserve(ChildIndices.Num());
+	for (const int32 ChildIndex : ChildIndices)
+		ChildIndexStrings.Add(FString::FromInt(ChildIndex));
+
+	// Labels are user facing and may contain anything but a tab character.
+	return FString::Printf(TEXT("%s\t%s\t%s\t%u\t%s\t%s"),
+		*MajorTabLayoutId.ToString(),
+		*MajorTabLabel.Replace(TEXT("\t"), TEXT(" ")),
+		*MinorTabLayoutId.ToString(),
+		TypePathHash,
+		*AssetPath,
+		*FString::Join(ChildIndexStrings, TEXT(",")));
+}
+
+bool FUMWidgetSignature::InitFromString(const FString& InString)
+{
+	TArray<FString> Fields;
+	InString.ParseIntoArray(Fields, TEXT("\t"), false);
+	if (Fields.Num() != 6)
+		return false; // Older format; its entries can't be walked to
+
+	MajorTabLayoutId = FName(*Fields[0]);
+	MajorTabLabel = Fields[1];
+	MinorTabLayoutId = FName(*Fields[2]);
+	TypePathHash = static_cast<uint32>(FCString::Strtoui64(*Fields[3], nullptr, 10));
+	AssetPath = Fields[4];
+
+	TArray<FString> ChildIndexStrings;
+	Fields[5].ParseIntoArray(ChildIndexStrings, TEXT(","));
+	ChildIndices.Reset(ChildIndexStrings.Num());
+	for (const FString& ChildIndexString : ChildIndexStrings)
+		ChildIndices.Add(FCString::Atoi(*ChildIndexString));
+
+	return IsValid();
+}
+//
+//						~ FUMWidgetSignature ~
+///////////////////////////////////////////////////////////////////////////////
+
+bool FUMJumpEntry::IsSameTarget(const FUMJumpEntry& Other) const
+{
+	const TSharedPtr<SWidget> ThisWidget = Widget.Pin();
+	const TSharedPtr<SWidget> OtherWidget = Other.Widget.Pin();
+	if (ThisWidget.IsValid() && OtherWidget.IsValid())
+		return ThisWidget->GetId() == OtherWidget->GetId();
+
+	return Signature.IsValid() && Signature == Other.Signature;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//						~ FUMJumpList ~
+//
+FUMJumpList::FUMJumpList()
+{
+	Entries.SetNum(Capacity);
+}
+
+void FUMJumpList::Push(const FUMJumpEntry& InEntry)
+{
+	// Branching off: drop everything newer than where we've jumped back to.
+	if (Cursor != INDEX_NONE && Cursor < Count - 1)
+	{
+		for (int32 i = Cursor + 1; i < Count; ++i)
+			Entries[ToPhysicalIndex(i)] = FUMJumpEntry();
+		Count = Cursor + 1;
+	}
+
+	// No consecutive duplicates
+	if (Count > 0 && Get(Count - 1).IsSameTarget(InEntry))
+	{
+		Get(Count - 1) = InEntry; // Refresh the (potentially rebound) entry
+		Cursor = Count - 1;
+		return;
+	}
+
+	if (Count < Capacity)
+	{
+		Entries[ToPhysicalIndex(Count)] = InEntry;
+		++Count;
+	}
+	else // Full: overwrite the oldest entry and advance the start
+	{
+		Entries[Start] = InEntry;
+		Start = (Start + 1) % Capacity;
+	}
+	Cursor = Count - 1;
+}
+
+FUMJumpEntry* FUMJumpList::Step(const int32 Direction,
+	TFunctionRef<bool(FUMJumpEntry&)> CanReach)
+{
+	if (Count == 0 || Direction == 0)
+		return nullptr;
+
+	const int32 Delta = Direction > 0 ? 1 : -1;
+	for (int32 i = (Cursor == INDEX_NONE ? Count - 1 : Cursor) + Delta;
+		i >= 0 && i < Count; i += Delta)
+	{
+		FUMJumpEntry& Entry = Get(i);
+		if (CanReach(Entry))
+		{
+			Cursor = i;
+			return &Entry;
+		}
+	}
+	return nullptr; // Top or bottom of the list
+}
+
+void FUMJumpList::Reset()
+{
+	for (FUMJumpEntry& Entry : Entries)
+		Entry = FUMJumpEntry();
+
+	Start = 0;
+	Count = 0;
+	Cursor = INDEX_NONE;
+}
+
+FUMJumpEntry& FUMJumpList::Get(const int32 Index)
+{
+	check(Index >= 0 && Index < Count);
+	return Entries[ToPhysicalIndex(Index)];
+}
+
+const FUMJumpEntry& FUMJumpList::Get(const int32 Index) const
+{
+	check(Index >= 0 && Index < Count);
+	return Entries[ToPhysicalIndex(Index)];
+}
+//
+//						~ FUMJumpList ~
+///////////////////////////////////////////////////////////////////////////////
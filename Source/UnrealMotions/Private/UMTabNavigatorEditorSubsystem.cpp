@@ -51,14 +51,20 @@ void UUMTabNavigatorEditorSubsystem::Initialize(FSubsystemCollectionBase& Collec
 	RegisterCycleTabNavigation(MainFrameContext);
 	MapCycleTabsNavigation(CommandList);
 
+	TabRegistry.Init();
+
 	if (FUMConfig::Get()->IsVimEnabled())
+	{
 		BindVimCommands();
+		RegisterConsoleCommands();
+	}
 
 	Super::Initialize(Collection);
 }
 
 void UUMTabNavigatorEditorSubsystem::Deinitialize()
 {
+	TabRegistry.Shutdown();
 	TabChords.Empty();
 	CommandInfoMajorTabs.Empty();
 	CommandInfoMinorTabs.Empty();
@@ -306,15 +312,104 @@ void UUMTabNavigatorEditorSubsystem::MoveActiveTabToWindow(
 		else
 			return;
 	}
+	const TSharedPtr<SDockTab> MajTab = FUMSlateHelpers::GetActiveMajorTab();
+	if (!MajTab.IsValid())
+		return;
+
+	TArray<FVector2f> TargetPositions;
+	if (!GetTabWellDropPositions(
+			TargetTabWell.ToSharedRef(), bIsNomadWindow, TargetPositions))
+		return;
+
+	DockTabAtPositions(SlateApp, MajTab.ToSharedRef(), TargetPositions,
+		[MajTab, TargetTabWell]() {
+			return IsTabInTabWell(MajTab.ToSharedRef(), TargetTabWell.ToSharedRef());
+		});
+}
+
+void UUMTabNavigatorEditorSubsystem::MoveActiveTabOut()
+{
+	FSlateApplication& SlateApp = FSlateApplication::Get();
+
+	const TSharedPtr<SDockTab> MajTab = FUMSlateHelpers::GetActiveMajorTab();
+	if (!MajTab.IsValid())
+		return;
+
+	const TSharedPtr<SWindow> OriginWindow = MajTab->GetParentWindow();
+	if (!OriginWindow.IsValid())
+		return;
+
+	// Dropping a tab onto nothing makes the docking system float it in a new
+	// window; so we look for a spot on the desktop that isn't covered by any.
+	FVector2f DropPosition;
+	if (!FindUncoveredPositionAroundWindow(
+			SlateApp, OriginWindow.ToSharedRef(), DropPosition))
+	{
+		Logger.Print("MoveActiveTabOut: No free desktop space to float the tab.",
+			ELogVerbosity::Warning, true);
+		return;
+	}
+
+	const uint64 OriginWindowId = OriginWindow->GetId();
+	DockTabAtPositions(SlateApp, MajTab.ToSharedRef(), { DropPosition },
+		[MajTab, OriginWindowId]() {
+			const TSharedPtr<SWindow> NewWindow = MajTab->GetParentWindow();
+			return NewWindow.IsValid() && NewWindow->GetId() != OriginWindowId;
+		});
+}
+
+void UUMTabNavigatorEditorSubsystem::MoveActiveMinorTabToPanel(
+	FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	EUINavigation Direction;
+	if (!FUMInputHelpers::GetUINavigationFromVimKey(InKeyEvent.GetKey(), Direction))
+		return;
+
+	const TSharedPtr<SDockTab> MajTab = FUMSlateHelpers::GetActiveMajorTab();
+	const TSharedPtr<SDockTab> MinTab = FUMSlateHelpers::GetActiveMinorTab();
+	if (!MajTab.IsValid() || !MinTab.IsValid())
+		return;
+
+	TSharedPtr<SWidget> OriginTabWell;
+	if (!FUMSlateHelpers::TraverseFindWidgetUpwards(
+			MinTab.ToSharedRef(), OriginTabWell, FUMSlateHelpers::TabWellType))
+		return;
+
+	// Panels of the Major Tab are the Tab Wells found under its content.
+	TArray<TSharedPtr<SWidget>> TabWells;
+	if (!FUMSlateHelpers::TraverseFindWidget(
+			MajTab->GetContent(), TabWells, FUMSlateHelpers::TabWellType))
+		return;
+
+	const TSharedPtr<SWidget> TargetTabWell =
+		FindTabWellInDirection(OriginTabWell.ToSharedRef(), TabWells, Direction);
+	if (!TargetTabWell.IsValid())
+		return;
+
+	TArray<FVector2f> TargetPositions;
+	if (!GetTabWellDropPositions(
+			TargetTabWell.ToSharedRef(), false, TargetPositions))
+		return;
+
+	DockTabAtPositions(SlateApp, MinTab.ToSharedRef(), TargetPositions,
+		[MinTab, TargetTabWell]() {
+			return IsTabInTabWell(MinTab.ToSharedRef(), TargetTabWell.ToSharedRef());
+		});
+}
+
+bool UUMTabNavigatorEditorSubsystem::GetTabWellDropPositions(
+	const TSharedRef<SWidget> TargetTabWell, const bool bIsNomadWindow,
+	TArray<FVector2f>& OutPositions)
+{
 	const TSharedPtr<SDockTab> LastTabInWell =
-		FUMSlateHelpers::GetLastTabInTabWell(TargetTabWell.ToSharedRef());
+		FUMSlateHelpers::GetLastTabInTabWell(TargetTabWell);
 	if (!LastTabInWell.IsValid())
-		return;
+		return false;
 
 	// The drag motion we want to perform now, in order to cover a all edge cases
 	// where the dragging will append before the last tab (or not be able to dock
-	// at all) is to drag to the center of the last tab, wait a tiny bit, then
-	// drag to the end of the TabWell.
+	// at all) is to drag to the center of the last tab, then drag to the end of
+	// the TabWell.
 	// The reason we can't directly drag to the end of the TabWell is because of
 	// focus and heirarchy of layers, it won't detect our dragging if we won't
 	// firstly drag to the center of the last tab.
@@ -338,13 +433,46 @@ void UUMTabNavigatorEditorSubsystem::MoveActiveTabToWindow(
 
 	const FVector2f DragToPos_TargetTabWellCenterRight =
 		FUMSlateHelpers::GetWidgetCenterRightScreenSpacePosition(
-			TargetTabWell.ToSharedRef(), OffsetTabWellTargetPosBy);
+			TargetTabWell, OffsetTabWellTargetPosBy);
 
-	// This is the array of positions we will pass on.
 	// Firstly we move to the last tab center, then right edge of TabWell.
-	TArray<FVector2f> TargetPositions({ DragToPos_LastTabCenter,
-		DragToPos_TargetTabWellCenterRight });
+	OutPositions = { DragToPos_LastTabCenter, DragToPos_TargetTabWellCenterRight };
+	return true;
+}
 
+void UUMTabNavigatorEditorSubsystem::DockTabAtPositions(
+	FSlateApplication& SlateApp, const TSharedRef<SDockTab> InTab,
+	const TArray<FVector2f>& TargetPositions, TFunctionRef<bool()> HasLanded)
+{
+	// Where the tab sits now, to tell whether the direct drop moved it at all.
+	const TSharedPtr<SWidget> OriginParent = InTab->GetParentWidget();
+
+	// Direct path: the whole drag & drop is routed through the docking system
+	// within this very call. The cursor is neither moved nor hidden.
+	if (FUMInputHelpers::DragAndDropWidgetImmediately(InTab, TargetPositions))
+	{
+		if (HasLanded())
+			return;
+
+		// Docked somewhere else (or closed); dragging it again from there would
+		// only move it a second time.
+		if (InTab->GetParentWidget() != OriginParent)
+		{
+			Logger.Print("Direct tab docking landed elsewhere; not dragging again.",
+				ELogVerbosity::Warning);
+			return;
+		}
+	}
+
+	Logger.Print("Direct tab docking didn't land; falling back to cursor drag.",
+		ELogVerbosity::Warning);
+	DragTabWithCursor(SlateApp, InTab, TargetPositions);
+}
+
+void UUMTabNavigatorEditorSubsystem::DragTabWithCursor(
+	FSlateApplication& SlateApp, const TSharedRef<SDockTab> InTab,
+	const TArray<FVector2f>& TargetPositions)
+{
 	// Store the origin position so we can restore it at the end
 	const FVector2f MouseOriginPos = SlateApp.GetCursorPos();
 
@@ -352,10 +480,9 @@ void UUMTabNavigatorEditorSubsystem::MoveActiveTabToWindow(
 	const float TotalOffsetDelay = TargetPositions.Num() * MoveOffsetDelay;
 
 	// Perform the dragging & releasing of the tab
-	if (const TSharedPtr<SDockTab> MajTab = FUMSlateHelpers::GetActiveMajorTab())
-		if (!FUMInputHelpers::DragAndReleaseWidgetAtPosition(
-				MajTab.ToSharedRef(), TargetPositions, MoveOffsetDelay))
-			return;
+	if (!FUMInputHelpers::DragAndReleaseWidgetAtPosition(
+			InTab, TargetPositions, MoveOffsetDelay))
+		return;
 
 	// Restore the original position of the cursor to where it was pre-shenanigans
 	FTimerHandle TimerHandle_MoveMouseToOrigin;
@@ -370,8 +497,228 @@ void UUMTabNavigatorEditorSubsystem::MoveActiveTabToWindow(
 		false);
 }
 
-void UUMTabNavigatorEditorSubsystem::MoveActiveTabOut()
+bool UUMTabNavigatorEditorSubsystem::IsTabInTabWell(
+	const TSharedRef<SDockTab> InTab, const TSharedRef<SWidget> InTabWell)
 {
+	const TSharedPtr<SWidget> Parent = InTab->GetParentWidget();
+	return Parent.IsValid() && Parent->GetId() == InTabWell->GetId();
+}
+
+TSharedPtr<SWidget> UUMTabNavigatorEditorSubsystem::FindTabWellInDirection(
+	const TSharedRef<SWidget> OriginTabWell,
+	const TArray<TSharedPtr<SWidget>>& TabWells, const EUINavigation Direction)
+{
+	// Panels are compared by their Tab Well's rect; a candidate must lie fully
+	// past the origin in the requested direction. Ties are broken by how far
+	// off-axis the candidate is, so we favor the panel that's right next to us.
+	const FSlateRect OriginRect =
+		OriginTabWell->GetCachedGeometry().GetLayoutBoundingRect();
+	const FVector2f OriginCenter = FVector2f(OriginRect.GetCenter());
+
+	TSharedPtr<SWidget> BestTabWell;
+	float				BestScore = TNumericLimits<float>::Max();
+
+	for (const TSharedPtr<SWidget>& TabWell : TabWells)
+	{
+		if (!TabWell.IsValid() || TabWell->GetId() == OriginTabWell->GetId())
+			continue;
+
+		const FSlateRect Rect = TabWell->GetCachedGeometry().GetLayoutBoundingRect();
+		const FVector2f	 Center = FVector2f(Rect.GetCenter());
+
+		float Distance; // Along the direction axis
+		float OffAxis;
+		switch (Direction)
+		{
+			case EUINavigation::Left:
+				Distance = OriginRect.Left - Rect.Left;
+				OffAxis = FMath::Abs(Center.Y - OriginCenter.Y);
+				break;
+			case EUINavigation::Right:
+				Distance = Rect.Left - OriginRect.Left;
+				OffAxis = FMath::Abs(Center.Y - OriginCenter.Y);
+				break;
+			case EUINavigation::Up:
+				Distance = OriginRect.Top - Rect.Top;
+				OffAxis = FMath::Abs(Center.X - OriginCenter.X);
+				break;
+			case EUINavigation::Down:
+				Distance = Rect.Top - OriginRect.Top;
+				OffAxis = FMath::Abs(Center.X - OriginCenter.X);
+				break;
+			default:
+				return nullptr;
+		}
+
+		if (Distance <= 0.0f)
+			continue;
+
+		const float Score = Distance + OffAxis * 2.0f;
+		if (Score < BestScore)
+		{
+			BestScore = Score;
+			BestTabWell = TabWell;
+		}
+	}
+	return BestTabWell;
+}
+
+bool UUMTabNavigatorEditorSubsystem::FindUncoveredPositionAroundWindow(
+	FSlateApplication& SlateApp, const TSharedRef<SWindow> InWindow,
+	FVector2f& OutPosition)
+{
+	FDisplayMetrics DisplayMetrics;
+	SlateApp.GetCachedDisplayMetrics(DisplayMetrics);
+	const FPlatformRect& Desktop = DisplayMetrics.VirtualDisplayRect;
+
+	TArray<TSharedRef<SWindow>> VisibleWindows;
+	SlateApp.GetAllVisibleWindowsOrdered(VisibleWindows);
+
+	const FVector2f Pos = FVector2f(InWindow->GetPositionInScreen());
+	const FVector2f Size = FVector2f(InWindow->GetSizeInScreen());
+	const float		Margin = 64.0f;
+
+	// Right, Left, Below, Above the window, then the desktop's corners.
+	const TArray<FVector2f> Candidates = {
+		{ Pos.X + Size.X + Margin, Pos.Y + Margin },
+		{ Pos.X - Margin, Pos.Y + Margin },
+		{ Pos.X + Margin, Pos.Y + Size.Y + Margin },
+		{ Pos.X + Margin, Pos.Y - Margin },
+		{ Desktop.Right - Margin, Desktop.Bottom - Margin },
+		{ Desktop.Left + Margin, Desktop.Bottom - Margin },
+	};
+
+	for (const FVector2f& Candidate : Candidates)
+	{
+		if (Candidate.X < Desktop.Left || Candidate.X >= Desktop.Right
+			|| Candidate.Y < Desktop.Top || Candidate.Y >= Desktop.Bottom)
+			continue;
+
+		const FWidgetPath PathUnderCandidate =
+			SlateApp.LocateWindowUnderMouse(FVector2D(Candidate), VisibleWindows);
+		if (!PathUnderCandidate.IsValid())
+		{
+			OutPosition = Candidate;
+			return true;
+		}
+	}
+	return false;
+}
+
+void UUMTabNavigatorEditorSubsystem::CycleRecentTabs(bool bIsOlder)
+{
+	// Presses closer than this to each other are one switching session, in
+	// which we step through the order captured when the session started.
+	static constexpr double CycleSessionTimeout = 1.0;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastRecentTabsCycleTime > CycleSessionTimeout)
+	{
+		TArray<TSharedRef<SDockTab>> Tabs;
+		TabRegistry.GetTabsByRecency(Tabs, [](const FUMTabRecord& Record) {
+			return Record.Role == ETabRole::MajorTab
+				|| Record.Role == ETabRole::NomadTab;
+		});
+
+		RecentTabsCycle.Reset(Tabs.Num());
+		for (const TSharedRef<SDockTab>& Tab : Tabs)
+			RecentTabsCycle.Add(Tab);
+		RecentTabsCycleIndex = 0; // The currently active tab
+	}
+	LastRecentTabsCycleTime = Now;
+
+	const int32 Num = RecentTabsCycle.Num();
+	if (Num < 2)
+		return;
+
+	// Step over tabs that were closed mid-session.
+	for (int32 Attempt = 0; Attempt < Num - 1; ++Attempt)
+	{
+		RecentTabsCycleIndex = bIsOlder
+			? (RecentTabsCycleIndex + 1) % Num
+			: (RecentTabsCycleIndex - 1 + Num) % Num;
+
+		if (const TSharedPtr<SDockTab> Tab = RecentTabsCycle[RecentTabsCycleIndex].Pin())
+		{
+			ActivateTabAcrossWindows(Tab.ToSharedRef());
+			return;
+		}
+	}
+}
+
+void UUMTabNavigatorEditorSubsystem::GoToTabByName(const TArray<FString>& Args)
+{
+	const FString Query = FString::Join(Args, TEXT(" "));
+	const TSharedPtr<SDockTab> Tab = TabRegistry.FindTabByName(
+		Query, [](const FUMTabRecord&) { return true; });
+
+	if (!Tab.IsValid())
+	{
+		Logger.Print(FString::Printf(TEXT("No tab matches: %s"), *Query),
+			ELogVerbosity::Warning, true);
+		return;
+	}
+	ActivateTabAcrossWindows(Tab.ToSharedRef());
+}
+
+void UUMTabNavigatorEditorSubsystem::ListTabs()
+{
+	TArray<TSharedRef<SDockTab>> Tabs;
+	TabRegistry.GetTabsByRecency(Tabs, [](const FUMTabRecord&) { return true; });
+
+	FString Listing;
+	for (int32 i = 0; i < Tabs.Num(); ++i)
+	{
+		const FUMTabRecord* Record = TabRegistry.FindRecord(Tabs[i]->GetId());
+		if (!Record)
+			continue;
+
+		const TSharedPtr<SWindow> Window = Record->ParentWindow.Pin();
+		Listing += FString::Printf(TEXT("%3d %-12s %s  (%s)\n"),
+			i,
+			Record->Role == ETabRole::MajorTab	   ? TEXT("[Major]")
+				: Record->Role == ETabRole::NomadTab ? TEXT("[Nomad]")
+													 : TEXT("[Panel]"),
+			*Record->Label,
+			Window.IsValid() ? *Window->GetTitle().ToString() : TEXT("-"));
+	}
+	Logger.Print(Listing, ELogVerbosity::Log);
+}
+
+void UUMTabNavigatorEditorSubsystem::ActivateTabAcrossWindows(
+	const TSharedRef<SDockTab> InTab)
+{
+	if (const TSharedPtr<SWindow> Window = InTab->GetParentWindow())
+		FUMSlateHelpers::ActivateWindow(Window.ToSharedRef());
+
+	// Minor Tabs are only reachable once their Major Tab is in the foreground.
+	if (InTab->GetVisualTabRole() != ETabRole::MajorTab)
+	{
+		if (const TSharedPtr<FTabManager> TabManager = InTab->GetTabManagerPtr())
+		{
+			if (const TSharedPtr<SDockTab> MajorTab =
+					FGlobalTabmanager::Get()->GetMajorTabForTabManager(
+						TabManager.ToSharedRef()))
+				MajorTab->ActivateInParent(ETabActivationCause::SetDirectly);
+		}
+	}
+
+	InTab->ActivateInParent(ETabActivationCause::SetDirectly);
+}
+
+void UUMTabNavigatorEditorSubsystem::RegisterConsoleCommands()
+{
+	static FAutoConsoleCommand Cmd_GoToTabByName = FAutoConsoleCommand(
+		TEXT("b"),
+		TEXT("Go to a tab (in any window) by fuzzy matching its name"),
+		FConsoleCommandWithArgsDelegate::CreateUObject(
+			this, &UUMTabNavigatorEditorSubsystem::GoToTabByName));
+
+	static FAutoConsoleCommand Cmd_ListTabs = FAutoConsoleCommand(
+		TEXT("ls"),
+		TEXT("List all tabs by most recent use"),
+		FConsoleCommandDelegate::CreateUObject(
+			this, &UUMTabNavigatorEditorSubsystem::ListTabs));
 }
 
 void UUMTabNavigatorEditorSubsystem::BindVimCommands()
@@ -426,6 +773,24 @@ void UUMTabNavigatorEditorSubsystem::BindVimCommands()
 		{ EKeys::M, EKeys::T, EKeys::O },
 		WeakTabSubsystem,
 		&UUMTabNavigatorEditorSubsystem::MoveActiveTabOut);
+
+	for (const FKey& Key : { EKeys::H, EKeys::J, EKeys::K, EKeys::L })
+		VimInputProcessor->AddKeyBinding_KeyEvent(
+			EUMBindingContext::Generic,
+			{ EKeys::M, EKeys::T, Key },
+			WeakTabSubsystem,
+			&UUMTabNavigatorEditorSubsystem::MoveActiveMinorTabToPanel);
+
+	// Alternate tab (Vim's Ctrl-^); repeat to step further back in recency.
+	VimInputProcessor->AddKeyBinding_NoParam(
+		EUMBindingContext::Generic,
+		{ FInputChord(EModifierKey::FromBools(true, false, false, false), EKeys::Six) },
+		[this]() { CycleRecentTabs(true); });
+
+	VimInputProcessor->AddKeyBinding_NoParam(
+		EUMBindingContext::Generic,
+		{ FInputChord(EModifierKey::FromBools(true, false, true, false), EKeys::Six) },
+		[this]() { CycleRecentTabs(false); });
 }
 
 void UUMTabNavigatorEditorSubsystem::RegisterCycleTabNavigation(
@@ -0,0 +1,236 @@
+#include "UMTabRegistry.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Docking/TabManager.h"
+#include "UMSlateHelpers.h"
+
+bool FUMTabRecord::IsLive() const
+{
+	const TSharedPtr<SDockTab> DockTab = Tab.Pin();
+	return DockTab.IsValid() && DockTab->GetParentWindow().IsValid();
+}
+
+void FUMTabRegistry::Init()
+{
+	TSharedRef<FGlobalTabmanager> GTM = FGlobalTabmanager::Get();
+
+	DelegateHandle_OnActiveTabChanged = GTM->OnActiveTabChanged_Subscribe(
+		FOnActiveTabChanged::FDelegate::CreateRaw(
+			this, &FUMTabRegistry::OnActiveTabChanged));
+
+	DelegateHandle_OnTabForegrounded = GTM->OnTabForegrounded_Subscribe(
+		FOnActiveTabChanged::FDelegate::CreateRaw(
+			this, &FUMTabRegistry::OnTabForegrounded));
+}
+
+void FUMTabRegistry::Shutdown()
+{
+	TSharedRef<FGlobalTabmanager> GTM = FGlobalTabmanager::Get();
+	GTM->OnActiveTabChanged_Unsubscribe(DelegateHandle_OnActiveTabChanged);
+	GTM->OnTabForegrounded_Unsubscribe(DelegateHandle_OnTabForegrounded);
+
+	RecordsById.Reset();
+	RecentTabs.Reset();
+	bHasDiscoveredTabs = false;
+}
+
+void FUMTabRegistry::RegisterTab(
+	const TSharedRef<SDockTab>& InTab, const bool bActivated)
+{
+	FUMTabRecord& Record = RecordsById.FindOrAdd(InTab->GetId());
+	Record.Tab = InTab;
+	Record.ParentWindow = InTab->GetParentWindow();
+	Record.Role = InTab->GetTabRole();
+
+	// Labels may change (e.g. renamed or dirty assets); refresh on each visit.
+	Record.Label = FUMSlateHelpers::GetCleanTabLabel(InTab);
+	Record.LabelLower = Record.Label.ToLower();
+
+	if (bActivated)
+	{
+		Record.LastActivationTime = FPlatformTime::Seconds();
+		RecentTabs.Touch(InTab);
+	}
+	else
+		RecentTabs.AddLeastRecent(InTab);
+}
+
+const FUMTabRecord* FUMTabRegistry::FindRecord(const uint64 TabId) const
+{
+	return RecordsById.Find(TabId);
+}
+
+void FUMTabRegistry::GetTabsByRecency(TArray<TSharedRef<SDockTab>>& OutTabs,
+	TFunctionRef<bool(const FUMTabRecord&)> Filter)
+{
+	DiscoverAllTabs();
+
+	RecentTabs.FindMostRecent([this, &OutTabs, &Filter](const TSharedRef<SWidget>& Widget) {
+		const FUMTabRecord* Record = RecordsById.Find(Widget->GetId());
+		if (Record && Record->IsLive() && Filter(*Record))
+			OutTabs.Add(StaticCastSharedRef<SDockTab>(Widget));
+		return false; // Keep walking
+	});
+
+	// The walk above reclaimed destroyed tabs from the recency list.
+	if (RecordsById.Num() != RecentTabs.Num())
+		PruneStaleRecords();
+}
+
+TSharedPtr<SDockTab> FUMTabRegistry::FindTabByName(const FString& InQuery,
+	TFunctionRef<bool(const FUMTabRecord&)> Filter)
+{
+	const FString QueryLower = InQuery.TrimStartAndEnd().ToLower();
+	if (QueryLower.IsEmpty())
+		return nullptr;
+
+	DiscoverAllTabs();
+
+	TSharedPtr<SDockTab> BestTab;
+	int32				 BestScore = INDEX_NONE;
+
+	// Walking by recency: a strictly better score is needed to replace a match,
+	// so the most recent tab wins ties.
+	RecentTabs.FindMostRecent([&](const TSharedRef<SWidget>& Widget) {
+		const FUMTabRecord* Record = RecordsById.Find(Widget->GetId());
+		if (!Record || !Record->IsLive() || !Filter(*Record))
+			return false;
+
+		const int32 Score = ScoreFuzzyMatch(QueryLower, Record->LabelLower);
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			BestTab = StaticCastSharedRef<SDockTab>(Widget);
+		}
+		return false;
+	});
+
+	return BestTab;
+}
+
+int32 FUMTabRegistry::ScoreFuzzyMatch(
+	const FString& QueryLower, const FString& CandidateLower)
+{
+	const int32 QLen = QueryLower.Len();
+	const int32 CLen = CandidateLower.Len();
+	if (QLen == 0 || QLen > CLen)
+		return INDEX_NONE;
+
+	int32 Score = 0;
+	int32 PrevMatch = INDEX_NONE;
+	int32 q = 0;
+
+	for (int32 c = 0; c < CLen && q < QLen; ++c)
+	{
+		if (CandidateLower[c] != QueryLower[q])
+			continue;
+
+		Score += 10;
+		if (PrevMatch != INDEX_NONE && c == PrevMatch + 1)
+			Score += 15; // Consecutive
+		else if (PrevMatch != INDEX_NONE)
+			Score -= FMath::Min(c - PrevMatch - 1, 10); // Gap
+
+		if (c == 0)
+			Score += 25; // Prefix
+		else if (!FChar::IsAlnum(CandidateLower[c - 1]))
+			Score += 20; // Word start
+
+		PrevMatch = c;
+		++q;
+	}
+
+	if (q < QLen)
+		return INDEX_NONE;
+
+	return Score - (CLen - QLen) / 4; // Slightly prefer shorter labels
+}
+
+void FUMTabRegistry::OnActiveTabChanged(
+	TSharedPtr<SDockTab> NewTab, TSharedPtr<SDockTab> PrevTab)
+{
+	if (!NewTab.IsValid())
+		return;
+
+	RegisterTab(NewTab.ToSharedRef(), true);
+
+	// A minor tab activation also means its major tab is in use.
+	if (const TSharedPtr<FTabManager> TabManager = NewTab->GetTabManagerPtr())
+	{
+		if (const TSharedPtr<SDockTab> MajorTab =
+				FGlobalTabmanager::Get()->GetMajorTabForTabManager(
+					TabManager.ToSharedRef()))
+			RegisterTab(MajorTab.ToSharedRef(), true);
+	}
+}
+
+void FUMTabRegistry::OnTabForegrounded(
+	TSharedPtr<SDockTab> NewTab, TSharedPtr<SDockTab> PrevTab)
+{
+	if (!NewTab.IsValid())
+		return;
+
+	const TSharedRef<SDockTab> NewTabRef = NewTab.ToSharedRef();
+	RegisterTab(NewTabRef, true);
+
+	// Foregrounding is the moment tabs spawned in the background show up for us
+	// (e.g. a freshly opened asset editor with its panels).
+	RegisterNeighborTabs(NewTabRef);
+}
+
+void FUMTabRegistry::RegisterNeighborTabs(const TSharedRef<SDockTab>& InTab)
+{
+	const TSharedPtr<SWidget> TabWell = InTab->GetParentWidget();
+	if (TabWell.IsValid() && TabWell->GetType().IsEqual(*FUMSlateHelpers::TabWellType))
+	{
+		if (FChildren* Tabs = TabWell->GetChildren())
+		{
+			for (int32 i = 0; i < Tabs->Num(); ++i)
+				RegisterTab(StaticCastSharedRef<SDockTab>(Tabs->GetChildAt(i)), false);
+		}
+	}
+
+	if (InTab->GetVisualTabRole() != ETabRole::MajorTab)
+		return;
+
+	TArray<TSharedPtr<SWidget>> MinorTabs;
+	if (FUMSlateHelpers::TraverseFindWidget(
+			InTab->GetContent(), MinorTabs, "SDockTab", -1, false))
+	{
+		for (const TSharedPtr<SWidget>& MinorTab : MinorTabs)
+			RegisterTab(StaticCastSharedPtr<SDockTab>(MinorTab).ToSharedRef(), false);
+	}
+}
+
+void FUMTabRegistry::DiscoverAllTabs()
+{
+	if (bHasDiscoveredTabs)
+		return;
+	bHasDiscoveredTabs = true;
+
+	for (const TSharedRef<SWindow>& Window :
+		FSlateApplication::Get().GetTopLevelWindows())
+	{
+		TArray<TSharedPtr<SWidget>> Tabs;
+		if (!FUMSlateHelpers::TraverseFindWidget(Window, Tabs, "SDockTab", -1, false))
+			continue;
+
+		for (const TSharedPtr<SWidget>& Tab : Tabs)
+		{
+			const TSharedRef<SDockTab> DockTab =
+				StaticCastSharedPtr<SDockTab>(Tab).ToSharedRef();
+			if (DockTab->IsForeground())
+				RegisterTab(DockTab, true);
+			else
+				RegisterTab(DockTab, false);
+		}
+	}
+}
+
+void FUMTabRegistry::PruneStaleRecords()
+{
+	for (auto It = RecordsById.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Tab.IsValid() || !RecentTabs.Contains(It.Key()))
+			It.RemoveCurrent();
+	}
+}
@@ -0,0 +1,299 @@
+#include "UMWidgetHistory.h"
+
+///////////////////////////////////////////////////////////////////////////////
+//						~ FUMWidgetMRUList ~
+//
+FUMWidgetMRUList::FUMWidgetMRUList(const int32 InCapacity)
+	: Capacity(FMath::Max(1, InCapacity))
+{
+}
+
+void FUMWidgetMRUList::SetCapacity(const int32 InCapacity)
+{
+	Capacity = FMath::Max(1, InCapacity);
+	EvictOverCapacity();
+}
+
+void FUMWidgetMRUList::Touch(const TSharedRef<SWidget>& InWidget)
+{
+	const uint64 WidgetId = InWidget->GetId();
+	if (const int32* FoundIndex = NodeIndexById.Find(WidgetId))
+	{
+		// Already tracked: just promote it to the front.
+		if (*FoundIndex != Head)
+		{
+			Unlink(*FoundIndex);
+			LinkFront(*FoundIndex);
+		}
+		return;
+	}
+
+	const int32 NodeIndex = AllocateNode();
+	FNode&		Node = Nodes[NodeIndex];
+	Node.Widget = InWidget;
+	Node.WidgetId = WidgetId;
+
+	LinkFront(NodeIndex);
+	NodeIndexById.Add(WidgetId, NodeIndex);
+	EvictOverCapacity();
+}
+
+void FUMWidgetMRUList::AddLeastRecent(const TSharedRef<SWidget>& InWidget)
+{
+	const uint64 WidgetId = InWidget->GetId();
+	if (NodeIndexById.Num() >= Capacity || NodeIndexById.Contains(WidgetId))
+		return;
+
+	const int32 NodeIndex = AllocateNode();
+	FNode&		Node = Nodes[NodeIndex];
+	Node.Widget = InWidget;
+	Node.WidgetId = WidgetId;
+
+	LinkBack(NodeIndex);
+	NodeIndexById.Add(WidgetId, NodeIndex);
+}
+
+bool FUMWidgetMRUList::Remove(const uint64 WidgetId)
+{
+	int32 NodeIndex;
+	if (!NodeIndexById.RemoveAndCopyValue(WidgetId, NodeIndex))
+		return false;
+
+	Unlink(NodeIndex);
+	ReleaseNode(NodeIndex);
+	return true;
+}
+
+bool FUMWidgetMRUList::Contains(const uint64 WidgetId) const
+{
+	return NodeIndexById.Contains(WidgetId);
+}
+
+TSharedPtr<SWidget> FUMWidgetMRUList::GetMostRecent()
+{
+	return FindMostRecent(
+		[](const TSharedRef<SWidget>&) { return true; });
+}
+
+TSharedPtr<SWidget> FUMWidgetMRUList::GetPrevious(const uint64 IgnoreWidgetId)
+{
+	return FindMostRecent([IgnoreWidgetId](const TSharedRef<SWidget>& Widget) {
+		return Widget->GetId() != IgnoreWidgetId;
+	});
+}
+
+TSharedPtr<SWidget> FUMWidgetMRUList::FindMostRecent(
+	TFunctionRef<bool(const TSharedRef<SWidget>&)> Predicate)
+{
+	int32 NodeIndex = Head;
+	while (NodeIndex != INDEX_NONE)
+	{
+		const int32 NextIndex = Nodes[NodeIndex].Next;
+		if (const TSharedPtr<SWidget> Widget = Nodes[NodeIndex].Widget.Pin())
+		{
+			if (Predicate(Widget.ToSharedRef()))
+				return Widget;
+		}
+		else // Stale reference; reclaim it now that we've stumbled upon it.
+			Remove(Nodes[NodeIndex].WidgetId);
+
+		NodeIndex = NextIndex;
+	}
+	return nullptr;
+}
+
+void FUMWidgetMRUList::Reset()
+{
+	Nodes.Reset();
+	FreeNodes.Reset();
+	NodeIndexById.Reset();
+	Head = INDEX_NONE;
+	Tail = INDEX_NONE;
+}
+
+void FUMWidgetMRUList::Unlink(const int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+
+	if (Node.Prev != INDEX_NONE)
+		Nodes[Node.Prev].Next = Node.Next;
+	else
+		Head = Node.Next;
+
+	if (Node.Next != INDEX_NONE)
+		Nodes[Node.Next].Prev = Node.Prev;
+	else
+		Tail = Node.Prev;
+
+	Node.Prev = INDEX_NONE;
+	Node.Next = INDEX_NONE;
+}
+
+void FUMWidgetMRUList::LinkFront(const int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	Node.Prev = INDEX_NONE;
+	Node.Next = Head;
+
+	if (Head != INDEX_NONE)
+		Nodes[Head].Prev = NodeIndex;
+	Head = NodeIndex;
+
+	if (Tail == INDEX_NONE)
+		Tail = NodeIndex;
+}
+
+void FUMWidgetMRUList::LinkBack(const int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	Node.Prev = Tail;
+	Node.Next = INDEX_NONE;
+
+	if (Tail != INDEX_NONE)
+		Nodes[Tail].Next = NodeIndex;
+	Tail = NodeIndex;
+
+	if (Head == INDEX_NONE)
+		Head = NodeIndex;
+}
+
+int32 FUMWidgetMRUList::AllocateNode()
+{
+	if (!FreeNodes.IsEmpty())
+		return FreeNodes.Pop();
+
+	return Nodes.AddDefaulted();
+}
+
+void FUMWidgetMRUList::ReleaseNode(const int32 NodeIndex)
+{
+	Nodes[NodeIndex] = FNode();
+	FreeNodes.Push(NodeIndex);
+}
+
+void FUMWidgetMRUList::EvictOverCapacity()
+{
+	while (NodeIndexById.Num() > Capacity && Tail != INDEX_NONE)
+		Remove(Nodes[Tail].WidgetId);
+}
+//
+//						~ FUMWidgetMRUList ~
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+//						~ FUMWidgetHistory ~
+//
+void FUMWidgetHistory::Configure(const int32 InDepth, const int32 InPartitionDepth,
+	const bool bInPartitionByTab, const bool bInPartitionByWindow)
+{
+	GlobalList.SetCapacity(InDepth);
+	PartitionDepth = FMath::Max(1, InPartitionDepth);
+	bPartitionByTab = bInPartitionByTab;
+	bPartitionByWindow = bInPartitionByWindow;
+
+	if (!bPartitionByTab)
+		ListsByMajorTabId.Reset();
+	if (!bPartitionByWindow)
+		ListsByWindowId.Reset();
+
+	for (TPair<uint64, FUMWidgetMRUList>& Pair : ListsByMajorTabId)
+		Pair.Value.SetCapacity(PartitionDepth);
+	for (TPair<uint64, FUMWidgetMRUList>& Pair : ListsByWindowId)
+		Pair.Value.SetCapacity(PartitionDepth);
+}
+
+void FUMWidgetHistory::RecordWidgetUse(const TSharedRef<SWidget>& InWidget,
+	const uint64 MajorTabId, const uint64 WindowId)
+{
+	GlobalList.Touch(InWidget);
+
+	if (bPartitionByTab && MajorTabId != 0)
+		FindOrAddPartition(ListsByMajorTabId, MajorTabId).Touch(InWidget);
+
+	if (bPartitionByWindow && WindowId != 0)
+		FindOrAddPartition(ListsByWindowId, WindowId).Touch(InWidget);
+}
+
+TSharedPtr<SWidget> FUMWidgetHistory::GetPreviousWidget(const uint64 IgnoreWidgetId)
+{
+	return GlobalList.GetPrevious(IgnoreWidgetId);
+}
+
+TSharedPtr<SWidget> FUMWidgetHistory::FindMostRecent(
+	const uint64 MajorTabId, const uint64 WindowId,
+	TFunctionRef<bool(const TSharedRef<SWidget>&)> Predicate)
+{
+	// The narrower lists hold the likeliest candidates; whatever they miss
+	// (e.g. widgets recorded before their tab was known) is in the wider ones.
+	TSet<uint64>		Tested;
+	TSharedPtr<SWidget> Found;
+
+	auto FindIn = [&Tested, &Found, &Predicate](FUMWidgetMRUList& List) {
+		Found = List.FindMostRecent([&Tested, &Predicate](const TSharedRef<SWidget>& Widget) {
+			bool bIsAlreadyTested = false;
+			Tested.Add(Widget->GetId(), &bIsAlreadyTested);
+			return !bIsAlreadyTested && Predicate(Widget);
+		});
+		return Found.IsValid();
+	};
+
+	auto FindInPartition = [&FindIn](TMap<uint64, FUMWidgetMRUList>& Partitions, const uint64 PartitionId) {
+		FUMWidgetMRUList* Partition = Partitions.Find(PartitionId);
+		if (!Partition)
+			return false;
+
+		const bool bFound = FindIn(*Partition);
+
+		// Every widget in this partition is gone, which means its tab or
+		// window was most likely destroyed. Drop the whole partition.
+		if (Partition->IsEmpty())
+			Partitions.Remove(PartitionId);
+		return bFound;
+	};
+
+	if (bPartitionByTab && MajorTabId != 0 && FindInPartition(ListsByMajorTabId, MajorTabId))
+		return Found;
+
+	if (bPartitionByWindow && WindowId != 0 && FindInPartition(ListsByWindowId, WindowId))
+		return Found;
+
+	FindIn(GlobalList);
+	return Found;
+}
+
+void FUMWidgetHistory::RemoveWindowPartition(const uint64 WindowId)
+{
+	ListsByWindowId.Remove(WindowId);
+}
+
+void FUMWidgetHistory::PruneEmptyPartitions()
+{
+	PruneEmptyPartitions(ListsByMajorTabId);
+	PruneEmptyPartitions(ListsByWindowId);
+}
+
+void FUMWidgetHistory::PruneEmptyPartitions(TMap<uint64, FUMWidgetMRUList>& Partitions)
+{
+	for (auto It = Partitions.CreateIterator(); It; ++It)
+	{
+		// Reclaims the destroyed widgets on the way
+		if (!It.Value().GetMostRecent().IsValid())
+			It.RemoveCurrent();
+	}
+}
+
+FUMWidgetMRUList& FUMWidgetHistory::FindOrAddPartition(
+	TMap<uint64, FUMWidgetMRUList>& Partitions, const uint64 PartitionId)
+{
+	if (FUMWidgetMRUList* Partition = Partitions.Find(PartitionId))
+		return *Partition;
+
+	// Closed tabs aren't broadcast; their partitions are swept as they pile up.
+	if (Partitions.Num() >= MaxPartitions)
+		PruneEmptyPartitions(Partitions);
+
+	return Partitions.Add(PartitionId, FUMWidgetMRUList(PartitionDepth));
+}
+//
+//						~ FUMWidgetHistory ~
+///////////////////////////////////////////////////////////////////////////////
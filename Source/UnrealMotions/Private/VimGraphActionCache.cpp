@@ -0,0 +1,231 @@
+#include "VimGraphActionCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "BlueprintActionDatabase.h"
+#include "BlueprintActionFilter.h"
+#include "BlueprintActionMenuBuilder.h"
+#include "BlueprintActionMenuUtils.h"
+#include "BlueprintEditor.h"
+#include "Editor.h"
+#include "EdGraphSchema_K2.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "SBlueprintContextTargetMenu.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+
+void FVimGraphActionCache::Init()
+{
+	if (GEditor)
+		DelegateHandle_OnBlueprintCompiled = GEditor->OnBlueprintCompiled().AddRaw(
+			this, &FVimGraphActionCache::OnBlueprintCompiled);
+
+	// The database refreshes a Blueprint's actions on every structural change
+	// (variables, functions, local variables...), without waiting on a compile.
+	FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+	DelegateHandle_OnActionDatabaseEntryUpdated = ActionDatabase.OnEntryUpdated().AddRaw(
+		this, &FVimGraphActionCache::OnActionDatabaseEntryChanged);
+	DelegateHandle_OnActionDatabaseEntryRemoved = ActionDatabase.OnEntryRemoved().AddRaw(
+		this, &FVimGraphActionCache::OnActionDatabaseEntryChanged);
+
+	IAssetRegistry& AssetRegistry =
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	DelegateHandle_OnAssetAdded = AssetRegistry.OnAssetAdded().AddRaw(
+		this, &FVimGraphActionCache::OnAssetAdded);
+	DelegateHandle_OnAssetRemoved = AssetRegistry.OnAssetRemoved().AddRaw(
+		this, &FVimGraphActionCache::OnAssetRemoved);
+	DelegateHandle_OnAssetRenamed = AssetRegistry.OnAssetRenamed().AddRaw(
+		this, &FVimGraphActionCache::OnAssetRenamed);
+}
+
+void FVimGraphActionCache::Shutdown()
+{
+	if (GEditor)
+		GEditor->OnBlueprintCompiled().Remove(DelegateHandle_OnBlueprintCompiled);
+
+	if (FBlueprintActionDatabase* ActionDatabase = FBlueprintActionDatabase::TryGet())
+	{
+		ActionDatabase->OnEntryUpdated().Remove(DelegateHandle_OnActionDatabaseEntryUpdated);
+		ActionDatabase->OnEntryRemoved().Remove(DelegateHandle_OnActionDatabaseEntryRemoved);
+	}
+
+	// The registry may already be gone when shutting the editor down.
+	if (FAssetRegistryModule* AssetRegistryModule =
+			FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(DelegateHandle_OnAssetAdded);
+		AssetRegistry.OnAssetRemoved().Remove(DelegateHandle_OnAssetRemoved);
+		AssetRegistry.OnAssetRenamed().Remove(DelegateHandle_OnAssetRenamed);
+	}
+
+	ListsByKey.Reset();
+}
+
+TSharedRef<const FVimGraphActionList> FVimGraphActionCache::FindOrBuild(
+	UEdGraph* InGraph, UEdGraphPin* FromPin)
+{
+	const FString Key = MakeKey(InGraph, FromPin);
+	if (const TSharedRef<FVimGraphActionList>* Found = ListsByKey.Find(Key))
+		return *Found;
+
+	TSharedRef<FVimGraphActionList> List = MakeShared<FVimGraphActionList>();
+	BuildActions(InGraph, FromPin, *List);
+
+	ListsByKey.Add(Key, List);
+	return List;
+}
+
+void FVimGraphActionCache::Invalidate()
+{
+	ListsByKey.Reset();
+}
+
+FString FVimGraphActionCache::MakeKey(
+	const UEdGraph* InGraph, const UEdGraphPin* FromPin) const
+{
+	if (!InGraph)
+		return FString();
+
+	const UEdGraphSchema* Schema = InGraph->GetSchema();
+	const UBlueprint*	  Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(InGraph);
+
+	// The graph's type matters too (e.g. events can't go into functions)
+	FString Key = FString::Printf(TEXT("%s|%d|%s"),
+		Schema ? *Schema->GetClass()->GetPathName() : TEXT("None"),
+		Schema ? static_cast<int32>(Schema->GetGraphType(InGraph)) : -1,
+		Blueprint && Blueprint->GeneratedClass
+			? *Blueprint->GeneratedClass->GetPathName()
+			: *InGraph->GetOuter()->GetClass()->GetPathName());
+
+	// Function & macro graphs list their own local variables & parameters
+	if (Schema
+		&& (Schema->GetGraphType(InGraph) == GT_Function
+			|| Schema->GetGraphType(InGraph) == GT_Macro))
+		Key += TEXT("|") + InGraph->GetPathName();
+
+	if (FromPin)
+	{
+		const FEdGraphPinType& PinType = FromPin->PinType;
+		Key += FString::Printf(TEXT("|%d|%s|%s|%s|%d|%d"),
+			static_cast<int32>(FromPin->Direction),
+			*PinType.PinCategory.ToString(),
+			*PinType.PinSubCategory.ToString(),
+			PinType.PinSubCategoryObject.IsValid()
+				? *PinType.PinSubCategoryObject->GetPathName()
+				: TEXT("None"),
+			static_cast<int32>(PinType.ContainerType),
+			PinType.bIsReference ? 1 : 0);
+	}
+	return Key;
+}
+
+void FVimGraphActionCache::BuildActions(
+	UEdGraph* InGraph, UEdGraphPin* FromPin, FVimGraphActionList& OutList) const
+{
+	if (!InGraph)
+		return;
+
+	const UEdGraphSchema* Schema = InGraph->GetSchema();
+	if (!Schema)
+		return;
+
+	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(InGraph);
+	if (Blueprint && Schema->IsA<UEdGraphSchema_K2>())
+	{
+		// Blueprint graphs get their actions from the Blueprint action database,
+		// filtered the way the Blueprint editor's context menu filters them.
+		TWeakPtr<FBlueprintEditor> BlueprintEditor;
+		if (IAssetEditorInstance* EditorInstance =
+				GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()
+					->FindEditorForAsset(Blueprint, false))
+		{
+			FBlueprintEditor* BPEditor = StaticCast<FBlueprintEditor*>(EditorInstance);
+			BlueprintEditor = StaticCastSharedRef<FBlueprintEditor>(BPEditor->AsShared());
+		}
+
+		FBlueprintActionContext Context;
+		Context.Blueprints.Add(Blueprint);
+		Context.Graphs.Add(InGraph);
+		if (FromPin)
+			Context.Pins.Add(FromPin);
+
+		const uint32 ContextTargetMask = EContextTargetFlags::TARGET_Blueprint
+			| EContextTargetFlags::TARGET_BlueprintLibraries
+			| EContextTargetFlags::TARGET_SubComponents
+			| EContextTargetFlags::TARGET_NodeTarget
+			| EContextTargetFlags::TARGET_PinObject
+			| EContextTargetFlags::TARGET_SiblingPinObjects;
+
+		FBlueprintActionMenuBuilder MenuBuilder(BlueprintEditor);
+		FBlueprintActionMenuUtils::MakeContextMenu(
+			Context, /*bIsContextSensitive=*/true, ContextTargetMask, MenuBuilder);
+
+		OutList.Actions.Reserve(MenuBuilder.GetNumActions());
+		for (int32 i = 0; i < MenuBuilder.GetNumActions(); ++i)
+		{
+			for (const TSharedPtr<FEdGraphSchemaAction>& Action : MenuBuilder.GetAction(i).Actions)
+				AddAction(Action, OutList);
+		}
+		return;
+	}
+
+	// Any other graph (Materials, Sound Cues, etc.) lists through its schema.
+	FGraphContextMenuBuilder MenuBuilder(InGraph);
+	MenuBuilder.FromPin = FromPin;
+	Schema->GetGraphContextActions(MenuBuilder);
+
+	OutList.Actions.Reserve(MenuBuilder.GetNumActions());
+	for (int32 i = 0; i < MenuBuilder.GetNumActions(); ++i)
+	{
+		for (const TSharedPtr<FEdGraphSchemaAction>& Action : MenuBuilder.GetAction(i).Actions)
+			AddAction(Action, OutList);
+	}
+}
+
+void FVimGraphActionCache::AddAction(
+	const TSharedPtr<FEdGraphSchemaAction>& InAction, FVimGraphActionList& OutList) const
+{
+	if (!InAction.IsValid())
+		return;
+
+	// Skip separators & headers; they have nothing to perform.
+	const FText DisplayText = InAction->GetMenuDescription();
+	if (DisplayText.IsEmpty())
+		return;
+
+	TSharedPtr<FVimGraphAction> Entry = MakeShared<FVimGraphAction>();
+	Entry->Action = InAction;
+	Entry->DisplayText = DisplayText;
+	Entry->CategoryText = InAction->GetCategory();
+	Entry->NameLower = DisplayText.ToString().ToLower();
+	Entry->SearchLower = FString::Printf(TEXT("%s %s %s"),
+		*Entry->NameLower,
+		*Entry->CategoryText.ToString().ToLower(),
+		*InAction->GetKeywords().ToString().ToLower());
+
+	OutList.Actions.Add(MoveTemp(Entry));
+}
+
+void FVimGraphActionCache::OnBlueprintCompiled()
+{
+	Invalidate();
+}
+
+void FVimGraphActionCache::OnActionDatabaseEntryChanged(UObject* InActionKey)
+{
+	Invalidate();
+}
+
+void FVimGraphActionCache::OnAssetAdded(const FAssetData& InAssetData)
+{
+	Invalidate();
+}
+
+void FVimGraphActionCache::OnAssetRemoved(const FAssetData& InAssetData)
+{
+	Invalidate();
+}
+
+void FVimGraphActionCache::OnAssetRenamed(
+	const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	Invalidate();
+}
@@ -3,6 +3,7 @@
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraphNode_Comment.h"
 #include "Framework/Application/SlateApplication.h"
+#include "Framework/Application/IMenu.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "ScopedTransaction.h"
 #include "UMConfig.h"
@@ -10,6 +11,7 @@
 #include "UMFocusHelpers.h"
 #include "UMSlateHelpers.h"
 #include "VimInputProcessor.h"
+#include "EdGraphSchema_K2.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "EdGraphSchema_K2_Actions.h"
 #include "BlueprintNodeSpawner.h"
@@ -27,6 +29,8 @@
 #include "UMFocuserEditorSubsystem.h"
 #include "VimNavigationEditorSubsystem.h"
 #include "UMEditorCommands.h"
+#include "Misc/TransactionObjectEvent.h"
+#include "SVimGraphActionMenu.h"
 
 // DEFINE_LOG_CATEGORY_STATIC(LogVimGraphEditorSubsystem, NoLogging, All); // Prod
 DEFINE_LOG_CATEGORY_STATIC(LogVimGraphEditorSubsystem, Log, All); // Dev
@@ -46,6 +50,16 @@ void UVimGraphEditorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 	BindVimCommands();
 
+	// Graphs don't broadcast node moves; the nodes get modified (or restored
+	// by Undo / Redo) on the way though, which is what the spatial index of
+	// the navigated graph is kept in sync with.
+	DelegateHandle_OnObjectModified = FCoreUObjectDelegates::OnObjectModified.AddUObject(
+		this, &UVimGraphEditorSubsystem::HandleOnObjectModified);
+	DelegateHandle_OnObjectTransacted = FCoreUObjectDelegates::OnObjectTransacted.AddUObject(
+		this, &UVimGraphEditorSubsystem::HandleOnObjectTransacted);
+
+	ActionCache.Init();
+
 	// Start listening when Context Binding is changed directly
 	// I wonder about this, it's cute. But is it really needed?
 	FCoreDelegates::OnPostEngineInit.AddLambda([this]() {
@@ -62,6 +76,17 @@ void UVimGraphEditorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UVimGraphEditorSubsystem::Deinitialize()
 {
+	if (UEdGraph* GraphObj = NavigationIndexGraph.Get())
+		GraphObj->RemoveOnGraphChangedHandler(DelegateHandle_OnNavigationGraphChanged);
+	NavigationIndex.Reset();
+
+	FCoreUObjectDelegates::OnObjectModified.Remove(DelegateHandle_OnObjectModified);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(DelegateHandle_OnObjectTransacted);
+
+	ActionCache.Shutdown();
+	PanController.Stop();
+	NodeSearchIndex.Reset();
+
 	Super::Deinitialize();
 }
 
@@ -219,6 +244,67 @@ void UVimGraphEditorSubsystem::BindVimCommands()
 		WeakGraphSubsystem,
 		&UVimGraphEditorSubsystem::HandleVimNodeNavigation);
 
+	// Alt + H: Go to the nearest Node to the Left (wired or not)
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::GraphEditor,
+		{ FInputChord(EModifierKey::Alt, EKeys::H) },
+		WeakGraphSubsystem,
+		&UVimGraphEditorSubsystem::HandleVimSpatialNodeNavigation);
+
+	// Alt + J: Go to the nearest Node Below (wired or not)
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::GraphEditor,
+		{ FInputChord(EModifierKey::Alt, EKeys::J) },
+		WeakGraphSubsystem,
+		&UVimGraphEditorSubsystem::HandleVimSpatialNodeNavigation);
+
+	// Alt + K: Go to the nearest Node Above (wired or not)
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::GraphEditor,
+		{ FInputChord(EModifierKey::Alt, EKeys::K) },
+		WeakGraphSubsystem,
+		&UVimGraphEditorSubsystem::HandleVimSpatialNodeNavigation);
+
+	// Alt + L: Go to the nearest Node to the Right (wired or not)
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::GraphEditor,
+		{ FInputChord(EModifierKey::Alt, EKeys::L) },
+		WeakGraphSubsystem,
+		&UVimGraphEditorSubsystem::HandleVimSpatialNodeNavigation);
+
+	// ']' & '[': Go to the Next / Previous Node in reading order
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::GraphEditor,
+		{ EKeys::RightBracket },
+		WeakGraphSubsystem,
+		&UVimGraphEditorSubsystem::HandleVimSpatialNodeNavigation);
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::GraphEditor,
+		{ EKeys::LeftBracket },
+		WeakGraphSubsystem,
+		&UVimGraphEditorSubsystem::HandleVimSpatialNodeNavigation);
+
+	// '/': Find a Node by title, comment or pin value; 'n' & 'N' to cycle
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::GraphEditor,
+		{ EKeys::Slash },
+		WeakGraphSubsystem,
+		&UVimGraphEditorSubsystem::BeginNodeSearch,
+		TArray<EVimMode>({ EVimMode::Normal }));
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::GraphEditor,
+		{ EKeys::N },
+		WeakGraphSubsystem,
+		&UVimGraphEditorSubsystem::SearchNextNode);
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::GraphEditor,
+		{ FInputChord(EModifierKey::Shift, EKeys::N) },
+		WeakGraphSubsystem,
+		&UVimGraphEditorSubsystem::SearchNextNode);
+
 	// 'b':
 	// If currently in an output pin, go to same node's input pin. (1 move)
 	// Else if currently in Input Pin, go to previous node's input pin. (2 moves)
@@ -474,7 +560,8 @@ void UVimGraphEditorSubsystem::AddNode(
 
 void UVimGraphEditorSubsystem::OnNodeCreationMenuClosed(
 	FSlateApplication& SlateApp,
-	UEdGraphPin* DraggedFromPin, bool bIsAppendingNode)
+	UEdGraphPin* DraggedFromPin, bool bIsAppendingNode,
+	UEdGraphNode* CreatedNode)
 {
 	FVimInputProcessor::Get()->SetVimMode(SlateApp, EVimMode::Normal);
 
@@ -495,7 +582,7 @@ void UVimGraphEditorSubsystem::OnNodeCreationMenuClosed(
 	if (!GraphObj)
 		return;
 	// if (NodeCounter == GraphPanel->GetChildren()->Num())
-	if (NodeCounter == GraphObj->Nodes.Num())
+	if (!CreatedNode && NodeCounter == GraphObj->Nodes.Num())
 	{
 		Logger.Print("No new Nodes were created...", ELogVerbosity::Log, true);
 		// Revert if we had shifted
@@ -508,32 +595,37 @@ void UVimGraphEditorSubsystem::OnNodeCreationMenuClosed(
 	// GraphPanel->SelectionManager.SetSelectionSet()
 
 	// Get and neatly reposition the newly created to node.
-	TArray<UEdGraphNode*> SelNodes = GraphPanel->GetSelectedGraphNodes();
-	if (SelNodes.Num() != 1 || !SelNodes[0]) // Should have exactly 1 node
-		return;
+	UEdGraphNode* NewNodeObj = CreatedNode;
+	if (!NewNodeObj)
+	{
+		TArray<UEdGraphNode*> SelNodes = GraphPanel->GetSelectedGraphNodes();
+		if (SelNodes.Num() != 1 || !SelNodes[0]) // Should have exactly 1 node
+			return;
+		NewNodeObj = SelNodes[0];
+	}
 	const TSharedPtr<SGraphNode> NewNode =
-		GraphPanel->GetNodeWidgetFromGuid(SelNodes[0]->NodeGuid);
+		GraphPanel->GetNodeWidgetFromGuid(NewNodeObj->NodeGuid);
 	if (!NewNode.IsValid())
 		return;
 	const TSharedRef<SGraphNode> NewNodeRef = NewNode.ToSharedRef();
 
-	// TODO: Refactor this
-	TSet<UEdGraphNode*> NodesToShift;
-	for (const auto& Pair : ShiftedNodesOriginalPositions)
+	// A widget spawned this very frame wasn't measured yet
+	if (NewNode->GetDesiredSize().IsNearlyZero())
+		NewNode->SlatePrepass(GraphPanel->GetCachedGeometry().Scale);
+
+	// Shift the nodes we made space with further, by the new node's width
+	TArray<UEdGraphNode*> NodesToShift;
+	NodesToShift.Reserve(ShiftedNodes.Num());
+	for (const FShiftedNode& Shifted : ShiftedNodes)
 	{
-		if (Pair.Key.IsValid())
-			NodesToShift.Add(Pair.Key.Get());
+		if (UEdGraphNode* ShiftedNode = Shifted.Node.Get())
+			NodesToShift.Add(ShiftedNode);
 	}
 
 	// Move all the nodes by the width of the new node
 	if (!NodesToShift.IsEmpty())
 		ShiftNodesForSpace(GraphPanel, NodesToShift, NewNode->GetDesiredSize().X);
 
-	// Get the origin node ~~~~
-	UEdGraphNode* NewNodeObj = NewNode->GetNodeObj();
-	if (!NewNodeObj)
-		return;
-
 	// Get the Dragged From Node:
 	// Simply passing it by a weak ptr doesn't seem to always work - especially
 	// when new macros are created in the graph. Thus we fetch it like that:
@@ -554,9 +646,9 @@ void UVimGraphEditorSubsystem::OnNodeCreationMenuClosed(
 	// Add the previous node to the selection and align the Y position too.
 	GraphPanel->SelectionManager.SetNodeSelection(DraggedFromNode->GetNodeObj(), true);
 	GraphPanel->StraightenConnections();
-	GraphPanel->SelectionManager.SelectSingleNode(SelNodes[0]);
+	GraphPanel->SelectionManager.SelectSingleNode(NewNodeObj);
 
-	HighlightPinForSelectedNode(SlateApp, GraphPanel.ToSharedRef(), SelNodes[0]);
+	HighlightPinForSelectedNode(SlateApp, GraphPanel.ToSharedRef(), NewNodeObj);
 
 	// When inserting we also want to potentially connect the new node to any
 	// existing nodes previous to our origin node (it will be disconnected
@@ -663,78 +755,181 @@ UEdGraphNode* UVimGraphEditorSubsystem::FindEdgeNodeInChain(
 	if (SelectedNodes.IsEmpty())
 		return nullptr;
 
-	TMap<UEdGraphNode*, TArray<UEdGraphNode*>> OutgoingConnections;
-	TSet<UEdGraphNode*>						   InputNodes;
-
-	// Build the connectivity graph
+	// Index the selection once, so links resolve to it by hash lookups
+	TArray<UEdGraphNode*>	   Nodes;
+	TMap<UEdGraphNode*, int32> IndexByNode;
+	Nodes.Reserve(SelectedNodes.Num());
+	IndexByNode.Reserve(SelectedNodes.Num());
 	for (UEdGraphNode* Node : SelectedNodes)
 	{
-		for (UEdGraphPin* Pin : Node->Pins)
+		if (Node && !IndexByNode.Contains(Node))
+			IndexByNode.Add(Node, Nodes.Add(Node));
+	}
+
+	// Build the connectivity graph (between selected nodes only)
+	TArray<TArray<int32>> OutgoingConnections;
+	OutgoingConnections.SetNum(Nodes.Num());
+	for (int32 i = 0; i < Nodes.Num(); ++i)
+	{
+		for (UEdGraphPin* Pin : Nodes[i]->Pins)
 		{
-			if (Pin->Direction == EGPD_Output)
+			if (!Pin || Pin->Direction != EGPD_Output)
+				continue;
+
+			for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
 			{
-				for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-				{
-					if (LinkedPin && SelectedNodes.Contains(LinkedPin->GetOwningNode()))
-					{
-						OutgoingConnections.FindOrAdd(Node).Add(LinkedPin->GetOwningNode());
-						InputNodes.Add(LinkedPin->GetOwningNode());
-					}
-				}
+				if (!LinkedPin)
+					continue;
+				if (const int32* LinkedIndex = IndexByNode.Find(LinkedPin->GetOwningNode()))
+					OutgoingConnections[i].Add(*LinkedIndex);
 			}
 		}
 	}
 
-	// Find candidates: Either source nodes (for first) or sink nodes (for last)
-	TArray<UEdGraphNode*> Candidates;
-	for (UEdGraphNode* Node : SelectedNodes)
-	{
-		bool bIsCandidate = bFindFirstNode
-			? !InputNodes.Contains(Node)		   // First: No incoming connections
-			: !OutgoingConnections.Contains(Node); // Last: No outgoing connections
+	return FindFarthestNode(Nodes, OutgoingConnections, bFindFirstNode);
+}
 
-		if (bIsCandidate)
-			Candidates.Add(Node);
+// Finds the node on either end of the longest path through the nodes
+UEdGraphNode* UVimGraphEditorSubsystem::FindFarthestNode(
+	const TArray<UEdGraphNode*>& Nodes,
+	const TArray<TArray<int32>>& OutgoingConnections,
+	bool						 bFindFirstNode)
+{
+	const int32 NumNodes = Nodes.Num();
+	if (NumNodes == 0)
+		return nullptr;
+
+	TArray<int32> NumIncoming;
+	NumIncoming.SetNumZeroed(NumNodes);
+	for (const TArray<int32>& Linked : OutgoingConnections)
+	{
+		for (const int32 LinkedIndex : Linked)
+			++NumIncoming[LinkedIndex];
 	}
 
-	// If there's only one candidate, return it immediately
-	if (Candidates.Num() == 1)
-		return Candidates[0];
+	// Topological sweep (Kahn's), tracking the longest path into each node.
+	// Nodes within a cycle never run out of incoming links; when stuck we
+	// force in the next unvisited node (in selection order), treating the
+	// links back into it as closing the cycle.
+	TArray<int32> Order; // Visiting order
+	TArray<int32> Rank;	 // Of each node in Order
+	TArray<int32> Depth; // Longest path reaching the node
+	Order.Reserve(NumNodes);
+	Rank.Init(INDEX_NONE, NumNodes);
+	Depth.SetNumZeroed(NumNodes);
 
-	// Otherwise, traverse to find the deepest node
-	return FindFarthestNode(Candidates, OutgoingConnections, bFindFirstNode);
-}
+	auto Visit = [&Order, &Rank](const int32 Index) {
+		Rank[Index] = Order.Add(Index);
+	};
 
-// Traverses and finds the deepest node from given candidates
-UEdGraphNode* UVimGraphEditorSubsystem::FindFarthestNode(
-	const TArray<UEdGraphNode*>&					  Candidates,
-	const TMap<UEdGraphNode*, TArray<UEdGraphNode*>>& OutgoingConnections,
-	bool											  bFindFirstNode)
-{
-	UEdGraphNode* EdgeNode = nullptr;
-	int			  MaxDepth = -1;
+	for (int32 i = 0; i < NumNodes; ++i)
+	{
+		if (NumIncoming[i] == 0)
+			Visit(i);
+	}
 
-	for (UEdGraphNode* StartNode : Candidates)
+	int32 NextUnvisited = 0;
+	for (int32 Head = 0; Head < NumNodes; ++Head)
 	{
-		TSet<UEdGraphNode*> Visited;
-		int					Depth = 0;
-		UEdGraphNode*		CurrentNode = StartNode;
+		if (Head == Order.Num()) // Only cycles left
+		{
+			while (Rank[NextUnvisited] != INDEX_NONE)
+				++NextUnvisited;
+			Visit(NextUnvisited);
+		}
 
-		while (OutgoingConnections.Contains(CurrentNode) && OutgoingConnections[CurrentNode].Num() > 0)
+		const int32 Index = Order[Head];
+		for (const int32 LinkedIndex : OutgoingConnections[Index])
 		{
-			Depth++;
-			Visited.Add(CurrentNode);
-			CurrentNode = OutgoingConnections[CurrentNode][0]; // Follow the first link
+			if (Rank[LinkedIndex] != INDEX_NONE)
+				continue; // Closes a cycle
+
+			Depth[LinkedIndex] = FMath::Max(Depth[LinkedIndex], Depth[Index] + 1);
+			if (--NumIncoming[LinkedIndex] == 0)
+				Visit(LinkedIndex);
 		}
+	}
 
-		if (Depth > MaxDepth)
+	// The last node ends the longest path; for the first one we sweep back
+	// to get the longest path leaving each node.
+	TArray<int32> Height;
+	if (bFindFirstNode)
+	{
+		Height.SetNumZeroed(NumNodes);
+		for (int32 i = NumNodes - 1; i >= 0; --i)
 		{
-			MaxDepth = Depth;
-			EdgeNode = CurrentNode;
+			const int32 Index = Order[i];
+			for (const int32 LinkedIndex : OutgoingConnections[Index])
+			{
+				if (Rank[LinkedIndex] > i) // Same links the sweep followed
+					Height[Index] = FMath::Max(Height[Index], Height[LinkedIndex] + 1);
+			}
 		}
 	}
+	const TArray<int32>& Distances = bFindFirstNode ? Height : Depth;
+
+	// Ties go to the earliest selected node
+	int32 EdgeIndex = 0;
+	for (int32 i = 1; i < NumNodes; ++i)
+	{
+		if (Distances[i] > Distances[EdgeIndex])
+			EdgeIndex = i;
+	}
+	return Nodes[EdgeIndex];
+}
+
+static FAutoConsoleCommand Cmd_BenchmarkFindEdgeNodeInChain = FAutoConsoleCommand(
+	TEXT("UnrealMotions.BenchmarkFindEdgeNodeInChain"),
+	TEXT("Times finding the first & last nodes of generated node chains (plain & cyclic). Args: [NumNodes=10000]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 NumNodes = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000;
+		if (UVimGraphEditorSubsystem* VimGraph =
+				GEditor ? GEditor->GetEditorSubsystem<UVimGraphEditorSubsystem>() : nullptr)
+			VimGraph->BenchmarkFindEdgeNodeInChain(FMath::Max(NumNodes, 2));
+	}));
+
+void UVimGraphEditorSubsystem::BenchmarkFindEdgeNodeInChain(const int32 NumNodes)
+{
+	// A transient graph with a single exec chain: Nodes[0] -> ... -> Nodes[N-1]
+	UEdGraph* Graph = NewObject<UEdGraph>(GetTransientPackage());
+
+	TArray<UEdGraphNode*> Nodes;
+	Nodes.Reserve(NumNodes);
+	for (int32 i = 0; i < NumNodes; ++i)
+	{
+		UEdGraphNode* Node = NewObject<UEdGraphNode>(Graph);
+		Node->CreatePin(EGPD_Input, TEXT("exec"), TEXT("In"));
+		Node->CreatePin(EGPD_Output, TEXT("exec"), TEXT("Out"));
+		if (i > 0)
+			Nodes.Last()->Pins[1]->MakeLinkTo(Node->Pins[0]);
+		Nodes.Add(Node);
+	}
+
+	// Selections don't come in chain order
+	TArray<UEdGraphNode*> Selection = Nodes;
+	FRandomStream		  Random(NumNodes);
+	for (int32 i = Selection.Num() - 1; i > 0; --i)
+		Selection.Swap(i, Random.RandRange(0, i));
+
+	auto TimeCase = [&](const TCHAR* Name, const bool bHasEdges) {
+		const double  StartTime = FPlatformTime::Seconds();
+		UEdGraphNode* FirstNode = FindEdgeNodeInChain(Selection, true);
+		UEdGraphNode* LastNode = FindEdgeNodeInChain(Selection, false);
+		const double  Seconds = FPlatformTime::Seconds() - StartTime;
+
+		const bool bFoundEdges = FirstNode == Nodes[0] && LastNode == Nodes.Last();
+		Logger.Print(FString::Printf(
+			TEXT("%-6s %6d nodes: first & last in %7.2f ms%s"),
+			Name, NumNodes, Seconds * 1000.0,
+			bHasEdges && !bFoundEdges ? TEXT(" (WRONG NODES)") : TEXT("")));
+	};
 
-	return EdgeNode;
+	TimeCase(TEXT("Chain"), true);
+
+	// Close the chain into a loop: there are no true edges anymore, but it
+	// must still terminate (and in linear time).
+	Nodes.Last()->Pins[1]->MakeLinkTo(Nodes[0]->Pins[0]);
+	TimeCase(TEXT("Cyclic"), false);
 }
 
 bool UVimGraphEditorSubsystem::IsValidZoom(const FString InZoomLevelStr)
@@ -758,33 +953,18 @@ bool UVimGraphEditorSubsystem::IsValidZoom(const FString InZoomLevelStr)
 }
 
 /** Deprecated but potentially some snippet here are interesting? */
-void UVimGraphEditorSubsystem::MoveConnectedNodesToRight(UEdGraphNode* StartNode, float OffsetX)
+void UVimGraphEditorSubsystem::MoveConnectedNodesToRight(
+	const TSharedRef<SGraphPanel> GraphPanel, UEdGraphNode* StartNode, float OffsetX)
 {
 	if (!StartNode)
 		return;
 
-	TSet<UEdGraphNode*>	  VisitedNodes;
-	TQueue<UEdGraphNode*> NodeQueue;
-
-	NodeQueue.Enqueue(StartNode);
-	VisitedNodes.Add(StartNode);
+	FVimGraphNavigationIndex& NavIndex = GetNavigationIndex(GraphPanel);
+	TBitArray<>				  Visited(false, NavIndex.NumGraphNodes());
+	TArray<UEdGraphNode*>	  NodesToMove;
+	CollectDownstreamNodes(NavIndex, StartNode, Visited, NodesToMove);
 
-	while (!NodeQueue.IsEmpty())
-	{
-		UEdGraphNode* CurrentNode;
-		NodeQueue.Dequeue(CurrentNode);
-
-		CurrentNode->NodePosX += OffsetX; // Move current node
-
-		// Enqueue connected nodes
-		CurrentNode->ForEachNodeDirectlyConnectedToOutputs([&](UEdGraphNode* ConnectedNode) {
-			if (!VisitedNodes.Contains(ConnectedNode))
-			{
-				VisitedNodes.Add(ConnectedNode);
-				NodeQueue.Enqueue(ConnectedNode);
-			}
-		});
-	}
+	ShiftNodesForSpace(GraphPanel, NodesToMove, OffsetX);
 }
 
 // TODO: We want to also collect nodes that are linked to pins other
@@ -793,60 +973,37 @@ void UVimGraphEditorSubsystem::MoveConnectedNodesToRight(UEdGraphNode* StartNode
 // We will basically need to check if a certain pin has multiple connections(?)
 // and collect them all(?)
 void UVimGraphEditorSubsystem::CollectDownstreamNodes(
-	UEdGraphPin*		 StartPin,
-	UEdGraphNode*		 StartNode,
-	TSet<UEdGraphNode*>& OutNodes,
-	bool				 bIsAppending)
+	FVimGraphNavigationIndex& NavIndex,
+	UEdGraphNode*			  StartNode,
+	TBitArray<>&			  Visited,
+	TArray<UEdGraphNode*>&	  OutNodes)
 {
-	if (!(StartPin && StartNode))
+	if (!StartNode)
 		return;
 
-	// A simple BFS or DFS approach
-	TQueue<UEdGraphNode*> Queue;
-	Queue.Enqueue(StartNode);
+	// Nodes are marked as visited once queued. The output array doubles as
+	// the BFS queue; everything past the head is yet to be expanded.
+	auto TryVisit = [&NavIndex, &Visited, &OutNodes](UEdGraphNode* Node) {
+		const int32 Index = NavIndex.FindNodeIndex(Node);
+		if (!Visited.IsValidIndex(Index) || Visited[Index])
+			return; // Not in the graph, or already collected
+		Visited[Index] = true;
+		OutNodes.Add(Node);
+	};
 
-	while (!Queue.IsEmpty())
+	int32 Head = OutNodes.Num();
+	TryVisit(StartNode);
+	for (; Head < OutNodes.Num(); ++Head)
 	{
-		UEdGraphNode* Current = nullptr;
-		Queue.Dequeue(Current);
-
-		if (!Current || OutNodes.Contains(Current))
-			continue;
-
-		// Mark visited
-		OutNodes.Add(Current);
-
-		// For "append", we look at output pins; for "insert",
-		// we might also want to move everything downstream,
-		// including the "current" node itself. So logic can differ.
-		for (UEdGraphPin* Pin : Current->Pins)
+		for (UEdGraphPin* Pin : OutNodes[Head]->Pins)
 		{
-			if (!Pin)
+			if (!Pin || Pin->Direction != EGPD_Output)
 				continue;
 
-			// If appending, we want to follow outgoing edges
-			// If inserting, we might do the same, except also
-			// treat the node itself as "to be moved".
-			if (bIsAppending && Pin->Direction == EGPD_Output)
-			{
-				for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-				{
-					if (LinkedPin && LinkedPin->GetOwningNode())
-					{
-						Queue.Enqueue(LinkedPin->GetOwningNode());
-					}
-				}
-			}
-			else if (!bIsAppending && Pin->Direction == EGPD_Output)
+			for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
 			{
-				// For insert, we also gather downstream:
-				for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-				{
-					if (LinkedPin && LinkedPin->GetOwningNode())
-					{
-						Queue.Enqueue(LinkedPin->GetOwningNode());
-					}
-				}
+				if (LinkedPin)
+					TryVisit(LinkedPin->GetOwningNode());
 			}
 		}
 	}
@@ -854,68 +1011,48 @@ void UVimGraphEditorSubsystem::CollectDownstreamNodes(
 
 void UVimGraphEditorSubsystem::ShiftNodesForSpace(
 	const TSharedPtr<SGraphPanel>& GraphPanel,
-	const TSet<UEdGraphNode*>&	   NodesToMove,
+	const TArray<UEdGraphNode*>&   NodesToMove,
 	float						   ShiftAmountX)
 {
-	ShiftedNodesOriginalPositions.Empty(); // Clear from previous usage
+	ShiftedNodes.Reset(); // Clear from previous usage
+	bNodesWereShifted = false;
 
-	if (NodesToMove.IsEmpty())
-	{
-		bNodesWereShifted = false;
+	UEdGraph* GraphObj = GraphPanel.IsValid() ? GraphPanel->GetGraphObj() : nullptr;
+	if (NodesToMove.IsEmpty() || !GraphObj)
 		return;
-	}
 
-	// Support undo for all shifted nodes
-	const FScopedTransaction Transaction(NSLOCTEXT("VimGraphEditor", "ShiftNodesForSpace", "Shift Nodes for Space"));
+	FVimGraphNavigationIndex& NavIndex = GetNavigationIndex(GraphPanel.ToSharedRef());
+	const int32				  ShiftX = FMath::RoundToInt(ShiftAmountX);
 
-	// We'll collect them into an SNodePanel::SNode::FNodeSet
-	SNodePanel::SNode::FNodeSet NodeFilter;
+	// Support undo for all shifted nodes (as a single step)
+	const FScopedTransaction Transaction(NSLOCTEXT("VimGraphEditor", "ShiftNodesForSpace", "Shift Nodes for Space"));
 
+	ShiftedNodes.Reserve(NodesToMove.Num());
 	for (UEdGraphNode* GraphNode : NodesToMove)
 	{
 		if (!GraphNode)
 			continue;
 
-		// Get the SGraphNode so we can call MoveTo
-		const TSharedPtr<SGraphNode> SNode =
-			GraphPanel->GetNodeWidgetFromGuid(GraphNode->NodeGuid);
-
-		if (!SNode.IsValid())
+		// Like SGraphNode::MoveTo: nodes placed by their connections
+		// (e.g. state machine transitions) aren't moved by hand.
+		const TSharedPtr<SGraphNode> NodeWidget = NavIndex.FindNodeWidget(GraphNode);
+		if (!NodeWidget.IsValid() || NodeWidget->RequiresSecondPassLayout())
 			continue;
 
-		// Cache its original position
-		const FVector2D OriginalPos = SNode->GetPosition();
-		ShiftedNodesOriginalPositions.Add(GraphNode, OriginalPos);
-
-		// Ensure the node is marked for modification
-		GraphNode->Modify();
+		ShiftedNodes.Add({ GraphNode, GraphNode->NodePosX, GraphNode->NodePosY });
 
-		// Add to filter (optional, if you plan to use it)
-		// NodeFilter.Add(SNode);
+		// The node widgets read their position straight from the nodes, so
+		// there's nothing to refresh per node; the package is dirtied once.
+		GraphNode->Modify(/*bAlwaysMarkDirty=*/false);
+		GraphNode->NodePosX += ShiftX;
+		NavIndex.OnNodeModified(GraphNode);
 	}
 
-	// Now apply the shift
-	for (const auto& Pair : ShiftedNodesOriginalPositions)
-	{
-		if (Pair.Key.IsValid())
-		{
-			UEdGraphNode*				 GraphNode = Pair.Key.Get();
-			const TSharedPtr<SGraphNode> SNode =
-				GraphPanel->GetNodeWidgetFromGuid(GraphNode->NodeGuid);
-			if (!SNode.IsValid())
-				continue;
-
-			// Current position
-			const FVector2D CurPos = Pair.Value;
-			// Shift it
-			FVector2D NewPos(CurPos.X + ShiftAmountX, CurPos.Y);
-
-			// SNodePanel::SNode interface
-			SNode->MoveTo(ConvertToNodePosition(NewPos), NodeFilter, /*bMarkDirty=*/true);
-		}
-	}
+	if (ShiftedNodes.IsEmpty())
+		return;
 
-	bNodesWereShifted = !ShiftedNodesOriginalPositions.IsEmpty();
+	GraphObj->MarkPackageDirty();
+	bNodesWereShifted = true;
 }
 
 void UVimGraphEditorSubsystem::RevertShiftedNodes(
@@ -924,41 +1061,24 @@ void UVimGraphEditorSubsystem::RevertShiftedNodes(
 	if (!bNodesWereShifted)
 		return;
 
-	SNodePanel::SNode::FNodeSet NodeFilter;
-
 	// Move them back
-	for (auto& Pair : ShiftedNodesOriginalPositions)
+	for (const FShiftedNode& Shifted : ShiftedNodes)
 	{
-		if (Pair.Key.IsValid())
-		{
-			UEdGraphNode*				 GraphNode = Pair.Key.Get();
-			const TSharedPtr<SGraphNode> SNode =
-				GraphPanel->GetNodeWidgetFromGuid(GraphNode->NodeGuid);
-			if (!SNode.IsValid())
-				continue;
+		UEdGraphNode* GraphNode = Shifted.Node.Get();
+		if (!GraphNode)
+			continue;
 
-			// This is not how you use it!
-			// NodeFilter.Add(SNode);
-		}
+		GraphNode->Modify(/*bAlwaysMarkDirty=*/false);
+		GraphNode->NodePosX = Shifted.OriginalPosX;
+		GraphNode->NodePosY = Shifted.OriginalPosY;
+		NavigationIndex.OnNodeModified(GraphNode);
 	}
 
-	for (auto& Pair : ShiftedNodesOriginalPositions)
-	{
-		if (Pair.Key.IsValid())
-		{
-			UEdGraphNode*				 GraphNode = Pair.Key.Get();
-			const TSharedPtr<SGraphNode> SNode =
-				GraphPanel->GetNodeWidgetFromGuid(GraphNode->NodeGuid);
-			if (!SNode.IsValid())
-				continue;
-
-			const auto OriginalPos = ConvertToNodePosition(Pair.Value);
-			SNode->MoveTo(OriginalPos, NodeFilter, /*bMarkDirty=*/true);
-		}
-	}
+	if (UEdGraph* GraphObj = GraphPanel.IsValid() ? GraphPanel->GetGraphObj() : nullptr)
+		GraphObj->MarkPackageDirty();
 
 	// Cleanup
-	ShiftedNodesOriginalPositions.Empty();
+	ShiftedNodes.Reset();
 	bNodesWereShifted = false;
 }
 
@@ -1286,6 +1406,68 @@ void UVimGraphEditorSubsystem::HandleOnContextBindingChanged(
 void UVimGraphEditorSubsystem::HandleOnGraphChanged(const FEdGraphEditAction& InAction)
 {
 	Logger.Print("On Graph Changed!", ELogVerbosity::Log, true);
+
+	if (InAction.Graph == ExecutionOrder.GetGraph())
+		ExecutionOrder.Invalidate();
+
+	if (InAction.Graph == NodeSearchIndex.GetGraph())
+		NodeSearchIndex.OnGraphChanged(InAction);
+}
+
+void UVimGraphEditorSubsystem::HandleOnNavigationGraphChanged(const FEdGraphEditAction& InAction)
+{
+	NavigationIndex.OnGraphChanged(InAction);
+
+	if (InAction.Graph == ExecutionOrder.GetGraph())
+		ExecutionOrder.Invalidate();
+
+	if (InAction.Graph == NodeSearchIndex.GetGraph())
+		NodeSearchIndex.OnGraphChanged(InAction);
+}
+
+FVimGraphNavigationIndex& UVimGraphEditorSubsystem::GetNavigationIndex(const TSharedRef<SGraphPanel> GraphPanel)
+{
+	if (!NavigationIndex.Bind(GraphPanel))
+		return NavigationIndex; // Same panel; keep what we know
+
+	// Follow the new panel's graph edits instead of the previous one's
+	if (UEdGraph* PrevGraphObj = NavigationIndexGraph.Get())
+		PrevGraphObj->RemoveOnGraphChangedHandler(DelegateHandle_OnNavigationGraphChanged);
+	DelegateHandle_OnNavigationGraphChanged.Reset();
+
+	UEdGraph* GraphObj = GraphPanel->GetGraphObj();
+	NavigationIndexGraph = GraphObj;
+	if (GraphObj)
+		DelegateHandle_OnNavigationGraphChanged = GraphObj->AddOnGraphChangedHandler(
+			FOnGraphChanged::FDelegate::CreateUObject(
+				this, &UVimGraphEditorSubsystem::HandleOnNavigationGraphChanged));
+
+	return NavigationIndex;
+}
+
+void UVimGraphEditorSubsystem::HandleOnObjectModified(UObject* InObject)
+{
+	UEdGraphNode* NodeObj = Cast<UEdGraphNode>(InObject);
+	if (!NodeObj)
+		return;
+
+	if (NavigationIndexGraph.IsValid() && NodeObj->GetOuter() == NavigationIndexGraph.Get())
+		NavigationIndex.OnNodeModified(NodeObj);
+
+	// Linking & unlinking pins modifies their nodes, but isn't broadcast
+	// as a graph change.
+	if (ExecutionOrder.GetGraph() && NodeObj->GetOuter() == ExecutionOrder.GetGraph())
+		ExecutionOrder.Invalidate();
+
+	// Comments & pin defaults are edited in place, also without a broadcast
+	if (NodeSearchIndex.GetGraph() && NodeObj->GetOuter() == NodeSearchIndex.GetGraph())
+		NodeSearchIndex.OnNodeModified(NodeObj);
+}
+
+void UVimGraphEditorSubsystem::HandleOnObjectTransacted(
+	UObject* InObject, const FTransactionObjectEvent& InEvent)
+{
+	HandleOnObjectModified(InObject);
 }
 
 void UVimGraphEditorSubsystem::HandleOnSelectionChanged(
@@ -1316,6 +1498,395 @@ void UVimGraphEditorSubsystem::UnhookFromActiveGraphPanel()
 	OnGraphChangedHandler.Reset();
 }
 
+void UVimGraphEditorSubsystem::HandleVimSpatialNodeNavigation(
+	FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	const TSharedPtr<SGraphPanel> GraphPanel = FUMSlateHelpers::TryGetActiveGraphPanel(SlateApp);
+	if (!GraphPanel.IsValid())
+		return;
+	const TSharedRef<SGraphPanel> GraphPanelRef = GraphPanel.ToSharedRef();
+
+	UEdGraphNode* FromNode = GetCurrentNode(GraphPanelRef);
+	if (!FromNode)
+		return;
+
+	FVimGraphNavigationIndex& NavIndex = GetNavigationIndex(GraphPanelRef);
+	FVimGraphSpatialGrid&	  SpatialGrid = NavIndex.GetSpatialGrid();
+	const int32				  Count = FVimInputProcessor::Get()->ConsumeCountPrefix();
+	const FKey				  InKey = InKeyEvent.GetKey();
+
+	UEdGraphNode* NewNode = nullptr;
+	if (InKey == EKeys::RightBracket || InKey == EKeys::LeftBracket)
+		NewNode = SpatialGrid.FindInReadingOrder(
+			FromNode, InKey == EKeys::RightBracket ? Count : -Count);
+
+	else if (const FVector2D* Direction = PanOffsetByMotion.Find(InKey))
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			UEdGraphNode* NextNode = SpatialGrid.FindNearestInDirection(
+				NewNode ? NewNode : FromNode, *Direction);
+			if (!NextNode)
+				break; // Nothing further that way
+			NewNode = NextNode;
+		}
+	}
+
+	if (!NewNode || NewNode == FromNode)
+		return;
+
+	JumpToNode(SlateApp, GraphPanelRef, NewNode, FromNode);
+}
+
+bool UVimGraphEditorSubsystem::JumpToNode(
+	FSlateApplication&			   SlateApp,
+	const TSharedRef<SGraphPanel>& GraphPanel,
+	UEdGraphNode*				   NewNode,
+	UEdGraphNode*				   FromNode)
+{
+	const TSharedPtr<SGraphNode> NewGraphNode = GetNavigationIndex(GraphPanel).FindNodeWidget(NewNode);
+	if (!NewGraphNode.IsValid())
+		return false;
+
+	// Select the new node (extending the selection in Visual Mode)
+	if (FromNode)
+		GraphSelectionTracker.HandleNodeSelection(NewNode, FromNode, GraphPanel);
+	else
+		GraphPanel->SelectionManager.SelectSingleNode(NewNode);
+	AdjustViewIfNodeOutOfBounds(GraphPanel, NewGraphNode.ToSharedRef());
+
+	// Track & highlight its first pin; pinless nodes (e.g. comments) aren't
+	// tracked, so the next motion starts from the selection instead.
+	const TSharedPtr<SGraphPin> PinWidget = GetFirstVisiblePinWidgetInNode(NewNode, GraphPanel);
+	UEdGraphPin*				PinObj = PinWidget.IsValid() ? PinWidget->GetPinObj() : nullptr;
+	if (!PinObj)
+	{
+		GraphSelectionTracker.GraphNode.Reset();
+		GraphSelectionTracker.PinIndex = INDEX_NONE;
+		return true;
+	}
+
+	GraphSelectionTracker.GraphPanel = GraphPanel;
+	GraphSelectionTracker.GraphNode = NewNode;
+	GraphSelectionTracker.PinIndex = NewNode->GetPinIndex(PinObj);
+
+	FUMInputHelpers::SimulateMouseMoveToPosition(SlateApp,
+		FVector2D(FUMSlateHelpers::GetWidgetCenterScreenSpacePosition(PinWidget.ToSharedRef())));
+	return true;
+}
+
+UEdGraphNode* UVimGraphEditorSubsystem::GetCurrentNode(const TSharedRef<SGraphPanel>& GraphPanel)
+{
+	// The tracked node (where the highlighted pin is) if it's still selected,
+	// else the last selected one.
+	if (GraphSelectionTracker.IsValid() && GraphSelectionTracker.IsTrackedNodeSelected())
+		return GraphSelectionTracker.GraphNode.Get();
+
+	const TArray<UEdGraphNode*> SelNodes = GraphPanel->GetSelectedGraphNodes();
+	return SelNodes.IsEmpty() ? nullptr : SelNodes.Last();
+}
+
+void UVimGraphEditorSubsystem::BeginNodeSearch(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	const TSharedPtr<SGraphPanel> GraphPanel = FUMSlateHelpers::TryGetActiveGraphPanel(SlateApp);
+	if (!GraphPanel.IsValid() || !GraphPanel->GetGraphObj())
+		return;
+	const TSharedRef<SGraphPanel> GraphPanelRef = GraphPanel.ToSharedRef();
+
+	// Follow the graph's edits (through the navigation index's hook)
+	GetNavigationIndex(GraphPanelRef);
+	NodeSearchIndex.Bind(GraphPanel->GetGraphObj());
+
+	// Rank equal matches by their distance from the current node (or from
+	// the middle of the view if there's none).
+	UEdGraphNode* OriginNode = GetCurrentNode(GraphPanelRef);
+	if (OriginNode)
+		NodeSearch.Origin = FVector2D(OriginNode->NodePosX, OriginNode->NodePosY);
+	else
+	{
+		const float Zoom = FMath::Max(GraphPanel->GetZoomAmount(), UE_KINDA_SMALL_NUMBER);
+		NodeSearch.Origin = PanController.GetTargetViewOffset(GraphPanelRef)
+			+ GraphPanel->GetCachedGeometry().GetLocalSize() * 0.5f / Zoom;
+	}
+
+	NodeSearch.OriginNode = OriginNode;
+	NodeSearch.GraphPanel = GraphPanelRef;
+	NodeSearch.PromptPattern.Reset();
+	NodeSearch.bIsPromptActive = true;
+
+	FVimInputProcessor::Get()->Possess(this, &UVimGraphEditorSubsystem::HandleNodeSearchPromptKey);
+
+	// The sequence that got us here hides the buffer visualizer right after
+	// this call, so we bring it back with the prompt on the next tick.
+	GEditor->GetTimerManager()->SetTimerForNextTick([this]() {
+		if (NodeSearch.bIsPromptActive && NodeSearch.PromptPattern.IsEmpty())
+			ShowNodeSearchPrompt(FSlateApplication::Get());
+	});
+}
+
+void UVimGraphEditorSubsystem::HandleNodeSearchPromptKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	if (FUMInputHelpers::IsKeyEventModifierOnly(InKeyEvent))
+		return;
+
+	const FKey& Key = InKeyEvent.GetKey();
+	if (Key == EKeys::Escape
+		|| (Key == EKeys::BackSpace && NodeSearch.PromptPattern.IsEmpty()))
+	{
+		EndNodeSearchPrompt(SlateApp, true /*Restore Node*/);
+		return;
+	}
+
+	if (Key == EKeys::Enter)
+	{
+		// An empty pattern repeats the last one (as in Vim)
+		if (NodeSearch.PromptPattern.IsEmpty())
+		{
+			NodeSearch.PromptPattern = NodeSearch.Pattern;
+			PreviewNodeSearchMatch(SlateApp);
+		}
+		NodeSearch.Pattern = NodeSearch.PromptPattern;
+
+		EndNodeSearchPrompt(SlateApp, NodeSearch.Matches.IsEmpty());
+		return;
+	}
+
+	if (Key == EKeys::BackSpace)
+		NodeSearch.PromptPattern.LeftChopInline(1);
+
+	else
+	{
+		if (InKeyEvent.IsControlDown() || InKeyEvent.IsAltDown())
+			return;
+
+		const TCHAR Char = FUMInputHelpers::GetCharFromKeyEvent(InKeyEvent);
+		if (!FChar::IsPrint(Char))
+			return;
+
+		NodeSearch.PromptPattern.AppendChar(Char);
+	}
+
+	PreviewNodeSearchMatch(SlateApp);
+}
+
+void UVimGraphEditorSubsystem::EndNodeSearchPrompt(FSlateApplication& SlateApp, const bool bRestoreNode)
+{
+	NodeSearch.bIsPromptActive = false;
+
+	const TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
+	VimProc->Unpossess(this);
+	VimProc->ResetBufferVisualizer(SlateApp);
+
+	if (!bRestoreNode)
+		return;
+
+	// Nothing was kept; n & N search the last pattern afresh
+	NodeSearch.Matches.Reset();
+	NodeSearch.MatchIndex = INDEX_NONE;
+
+	const TSharedPtr<SGraphPanel> GraphPanel = NodeSearch.GraphPanel.Pin();
+	if (!GraphPanel.IsValid())
+		return;
+
+	if (UEdGraphNode* OriginNode = NodeSearch.OriginNode.Get())
+		JumpToNode(SlateApp, GraphPanel.ToSharedRef(), OriginNode, nullptr);
+	else
+		GraphPanel->SelectionManager.ClearSelectionSet();
+}
+
+void UVimGraphEditorSubsystem::PreviewNodeSearchMatch(FSlateApplication& SlateApp)
+{
+	const TSharedPtr<SGraphPanel> GraphPanel = NodeSearch.GraphPanel.Pin();
+	if (!GraphPanel.IsValid())
+		return;
+	const TSharedRef<SGraphPanel> GraphPanelRef = GraphPanel.ToSharedRef();
+
+	// Typing on narrows down the previous keystroke's matches (see Search)
+	TArray<UEdGraphNode*> Matches;
+	NodeSearchIndex.Search(NodeSearch.PromptPattern, NodeSearch.Origin, Matches);
+
+	NodeSearch.Matches.Reset(Matches.Num());
+	for (UEdGraphNode* Match : Matches)
+		NodeSearch.Matches.Add(Match);
+	NodeSearch.MatchIndex = Matches.IsEmpty() ? INDEX_NONE : 0;
+
+	UEdGraphNode* OriginNode = NodeSearch.OriginNode.Get();
+	if (!Matches.IsEmpty())
+		JumpToNode(SlateApp, GraphPanelRef, Matches[0], nullptr);
+	else if (OriginNode)
+		JumpToNode(SlateApp, GraphPanelRef, OriginNode, nullptr);
+
+	ShowNodeSearchPrompt(SlateApp);
+}
+
+void UVimGraphEditorSubsystem::ShowNodeSearchPrompt(FSlateApplication& SlateApp)
+{
+	FString Prompt = TEXT("/") + NodeSearch.PromptPattern;
+
+	if (!NodeSearch.PromptPattern.IsEmpty())
+		Prompt += NodeSearch.MatchIndex == INDEX_NONE
+			? FString(TEXT("  [No Matches]"))
+			: FString::Printf(TEXT("  [%d/%d]"), NodeSearch.MatchIndex + 1, NodeSearch.Matches.Num());
+
+	FVimInputProcessor::Get()->ShowInBufferVisualizer(SlateApp, Prompt);
+}
+
+void UVimGraphEditorSubsystem::SearchNextNode(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	const int32 Count = FVimInputProcessor::Get()->ConsumeCountPrefix();
+	if (NodeSearch.Pattern.IsEmpty())
+		return;
+
+	const TSharedPtr<SGraphPanel> GraphPanel = FUMSlateHelpers::TryGetActiveGraphPanel(SlateApp);
+	if (!GraphPanel.IsValid() || !GraphPanel->GetGraphObj())
+		return;
+	const TSharedRef<SGraphPanel> GraphPanelRef = GraphPanel.ToSharedRef();
+
+	UEdGraphNode* FromNode = GetCurrentNode(GraphPanelRef);
+	const int32	  Step = InKeyEvent.IsShiftDown() ? -1 : 1;
+
+	// Matches of another graph (or none kept); rank the pattern's matches
+	// in this one, from the current node.
+	if (NodeSearch.Matches.IsEmpty() || GraphPanel != NodeSearch.GraphPanel.Pin())
+	{
+		GetNavigationIndex(GraphPanelRef);
+		NodeSearchIndex.Bind(GraphPanel->GetGraphObj());
+		if (FromNode)
+			NodeSearch.Origin = FVector2D(FromNode->NodePosX, FromNode->NodePosY);
+
+		TArray<UEdGraphNode*> Matches;
+		NodeSearchIndex.Search(NodeSearch.Pattern, NodeSearch.Origin, Matches);
+
+		NodeSearch.Matches.Reset(Matches.Num());
+		for (UEdGraphNode* Match : Matches)
+			NodeSearch.Matches.Add(Match);
+		NodeSearch.GraphPanel = GraphPanelRef;
+
+		// So that the first step lands on the best (n) or last (N) match
+		NodeSearch.MatchIndex = Step > 0 ? Matches.Num() - 1 : 0;
+	}
+
+	const int32 NumMatches = NodeSearch.Matches.Num();
+	if (NumMatches == 0)
+		return;
+
+	// Step through the ranked matches, wrapping around & skipping deleted ones
+	int32 MatchIndex = NodeSearch.MatchIndex;
+	for (int32 i = 0, Steps = 0; Steps < Count && i < NumMatches * Count; ++i)
+	{
+		MatchIndex = (MatchIndex + Step + NumMatches) % NumMatches;
+		if (NodeSearch.Matches[MatchIndex].IsValid())
+			++Steps;
+	}
+
+	UEdGraphNode* NewNode = NodeSearch.Matches[MatchIndex].Get();
+	if (!NewNode)
+		return; // All gone
+
+	NodeSearch.MatchIndex = MatchIndex;
+	if (NewNode != FromNode)
+		JumpToNode(SlateApp, GraphPanelRef, NewNode, FromNode);
+}
+
+bool UVimGraphEditorSubsystem::HandleVimExecutionFlowNavigation(
+	FSlateApplication&			   SlateApp,
+	const TSharedRef<SGraphPanel>& GraphPanel,
+	UEdGraphNode*				   FromNode,
+	UEdGraphPin*				   FromPin,
+	const TArray<FInputChord>&	   InSequence)
+{
+	const int32 SeqNum = InSequence.Num();
+	const FKey	Key1 = InSequence[0].Key;
+	const FKey	Key2 = SeqNum > 1 ? InSequence[1].Key : EKeys::Section;
+	const bool	bIsShiftDown = InSequence[SeqNum - 1].bShift;
+
+	const bool bIsWordMotion = SeqNum == 1 && (Key1 == EKeys::W || Key1 == EKeys::B || Key1 == EKeys::E);
+	const bool bIsWordEndBackMotion = Key1 == EKeys::G && Key2 == EKeys::E; // ge
+	const bool bIsChainEdgeMotion = (Key1 == EKeys::G && Key2 == EKeys::G)
+		|| (SeqNum == 1 && Key1 == EKeys::G && bIsShiftDown);
+	if (!bIsWordMotion && !bIsWordEndBackMotion && !bIsChainEdgeMotion)
+		return false;
+
+	ExecutionOrder.Bind(GraphPanel->GetGraphObj());
+	if (!FromPin || !ExecutionOrder.Contains(FromNode))
+		return false;
+
+	const int32			 Count = FVimInputProcessor::Get()->ConsumeCountPrefix();
+	const bool			 bIsOnInput = FromPin->Direction == EGPD_Input;
+	UEdGraphNode*		 NewNode = nullptr;
+	EEdGraphPinDirection TargetDir = EGPD_Input;
+
+	if (Key1 == EKeys::W) // Next node's input
+		NewNode = ExecutionOrder.FindInChain(FromNode, Count);
+
+	else if (Key1 == EKeys::B)
+	{
+		// Previous node's input; from an output, the first step is to this
+		// node's own input.
+		NewNode = ExecutionOrder.FindInChain(FromNode, bIsOnInput ? -Count : -(Count - 1));
+	}
+	else if (Key1 == EKeys::E)
+	{
+		// Next node's output; from an input, the first step is to this
+		// node's own output.
+		NewNode = ExecutionOrder.FindInChain(FromNode, bIsOnInput ? Count - 1 : Count);
+		TargetDir = EGPD_Output;
+	}
+	else if (bIsWordEndBackMotion) // Previous node's output
+	{
+		NewNode = ExecutionOrder.FindInChain(FromNode, -Count);
+		TargetDir = EGPD_Output;
+	}
+	else // gg: the chain's entry input, G: its last node's output
+	{
+		NewNode = ExecutionOrder.FindChainEdge(FromNode, !bIsShiftDown);
+		TargetDir = bIsShiftDown ? EGPD_Output : EGPD_Input;
+	}
+
+	if (!NewNode)
+		return true; // Stale node; nothing to move to
+
+	// Land on the node's execution pin of the side (the first pin of the
+	// side otherwise; e.g. Materials).
+	FVimGraphNavigationIndex& NavIndex = GetNavigationIndex(GraphPanel);
+	const FVimGraphNodePins*  NodePins = NavIndex.FindNodePins(NewNode);
+	if (!NodePins)
+		return true;
+
+	const TArray<int32>& PinGroup = NodePins->GetGroup(TargetDir);
+	int32				 PinIndex = PinGroup.IsEmpty() ? INDEX_NONE : PinGroup[0];
+	for (const int32 GroupPin : PinGroup)
+	{
+		if (NodePins->Objs[GroupPin]->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+		{
+			PinIndex = GroupPin;
+			break;
+		}
+	}
+	if (PinIndex == INDEX_NONE || NodePins->Objs[PinIndex] == FromPin)
+		return true; // Already there
+
+	const TSharedPtr<SGraphPin> NewPinWidget = NodePins->Widgets[PinIndex].Pin();
+	if (!NewPinWidget.IsValid())
+		return true;
+
+	if (NewNode != FromNode)
+	{
+		// Select the new node (extending the selection in Visual Mode)
+		GraphSelectionTracker.HandleNodeSelection(NewNode, FromNode, GraphPanel);
+		if (const TSharedPtr<SGraphNode> NewGraphNode = NavIndex.FindNodeWidget(NewNode))
+			AdjustViewIfNodeOutOfBounds(GraphPanel, NewGraphNode.ToSharedRef());
+	}
+
+	GraphSelectionTracker.GraphPanel = GraphPanel;
+	GraphSelectionTracker.GraphNode = NewNode;
+	GraphSelectionTracker.PinIndex = NewNode->GetPinIndex(NodePins->Objs[PinIndex]);
+
+	FUMInputHelpers::SimulateMouseMoveToPosition(SlateApp,
+		FVector2D(FUMSlateHelpers::GetWidgetCenterScreenSpacePosition(NewPinWidget.ToSharedRef())));
+	return true;
+}
+
 void UVimGraphEditorSubsystem::HandleGraphPanelPanning(
 	FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
 {
@@ -1329,42 +1900,24 @@ void UVimGraphEditorSubsystem::HandleGraphPanelPanning(
 	else
 		return; // Invalid navigation key (won't ever really get here)
 
+	const TSharedPtr<SGraphPanel> GraphPanel =
+		FUMSlateHelpers::TryGetActiveGraphPanel(SlateApp);
+	if (!GraphPanel.IsValid())
+	{
+		StopGraphPanelPanning(SlateApp, InKeyEvent);
+		return;
+	}
+	SlateApp.SetAllUserFocus(GraphPanel, EFocusCause::Navigation);
+
+	// Opposite keys cancel out; diagonals are normalized by the controller.
+	PanController.SetHeldDirection(GraphPanel.ToSharedRef(), CurrentPanelOffset);
+
 	if (DelegateHandle_OnKeyUpEvent.IsValid())
 		return; // We're already bound; shouldn't bind multiple times.
 
 	DelegateHandle_OnKeyUpEvent = // Store handle to unbind on key up.
 		FVimInputProcessor::Get()->Delegate_OnKeyUpEvent.AddUObject(
 			this, &UVimGraphEditorSubsystem::StopGraphPanelPanning);
-
-	// Logger.Print("HandleGraphPanelPanning", ELogVerbosity::Log, true);
-
-	GEditor->GetTimerManager()->SetTimer(
-		TimerHandle_GraphPanning,
-		[this, &SlateApp, InKeyEvent]() {
-			const TSharedPtr<SGraphPanel> GraphPanel =
-				FUMSlateHelpers::TryGetActiveGraphPanel(SlateApp);
-			if (GraphPanel.IsValid())
-			{
-				SlateApp.SetAllUserFocus(GraphPanel, EFocusCause::Navigation);
-				UEdGraph* GraphObj = GraphPanel->GetGraphObj();
-				if (GraphObj)
-				{
-					const TSharedPtr<SGraphEditor> GraphEditor =
-						SGraphEditor::FindGraphEditorForGraph(GraphObj);
-					if (GraphEditor.IsValid())
-					{
-						FVector2D Location;
-						float	  ZoomAmount;
-						GraphEditor->GetViewLocation(Location, ZoomAmount);
-						Location += CurrentPanelOffset; // Update location
-						GraphEditor->SetViewLocation(Location, ZoomAmount);
-						return; // Don't stop Panning
-					}
-				}
-			}
-			StopGraphPanelPanning(SlateApp, InKeyEvent);
-		},
-		0.001f, true /* Loop=true */);
 }
 
 void UVimGraphEditorSubsystem::StopGraphPanelPanning(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
@@ -1376,13 +1929,16 @@ void UVimGraphEditorSubsystem::StopGraphPanelPanning(FSlateApplication& SlateApp
 			CurrentPanelOffset -= *PanelOffsetPtr;
 		PressedPanningKeys.RemoveAt(Pos);
 	}
+
+	// Keep going with the keys still held; or let the view slow to a stop.
+	if (const TSharedPtr<SGraphPanel> GraphPanel = FUMSlateHelpers::TryGetActiveGraphPanel(SlateApp))
+		PanController.SetHeldDirection(GraphPanel.ToSharedRef(), CurrentPanelOffset);
+
 	if (!PressedPanningKeys.IsEmpty())
 		return;
 
 	if (DelegateHandle_OnKeyUpEvent.IsValid())
 	{
-		GEditor->GetTimerManager()->ClearTimer(TimerHandle_GraphPanning);
-
 		FVimInputProcessor::Get()->Delegate_OnKeyUpEvent.Remove(
 			DelegateHandle_OnKeyUpEvent);
 		DelegateHandle_OnKeyUpEvent.Reset();
@@ -1402,7 +1958,8 @@ void UVimGraphEditorSubsystem::HandleVimNodeNavigation(
 		TArray<UEdGraphNode*> SelNodes = GraphPanel->GetSelectedGraphNodes();
 		if (SelNodes.IsEmpty() || !SelNodes[0])
 			return;
-		TSharedPtr<SGraphNode> GraphNode = GraphPanel->GetNodeWidgetFromGuid(SelNodes[0]->NodeGuid);
+		TSharedPtr<SGraphNode> GraphNode =
+			GetNavigationIndex(GraphPanel.ToSharedRef()).FindNodeWidget(SelNodes[0]);
 		if (!GraphNode.IsValid())
 			return;
 
@@ -1412,44 +1969,28 @@ void UVimGraphEditorSubsystem::HandleVimNodeNavigation(
 
 	TSharedPtr<SGraphPanel> GraphPanel = GraphSelectionTracker.GraphPanel.Pin();
 	UEdGraphNode*			TrackedNodeObj = GraphSelectionTracker.GraphNode.Get();
-	TSharedPtr<SGraphNode>	GraphNode = GraphPanel->GetNodeWidgetFromGuid(TrackedNodeObj->NodeGuid);
-	if (!GraphNode.IsValid())
-		return;
 
-	UEdGraphPin*		  PinObj = TrackedNodeObj->GetPinAt(GraphSelectionTracker.PinIndex);
-	TSharedPtr<SGraphPin> GraphPin = FindPinWidgetFromObj(PinObj, GraphPanel.ToSharedRef());
-	if (!GraphPin.IsValid())
+	// The node's visible pins (sorted & grouped) come from the panel's index.
+	FVimGraphNavigationIndex& NavIndex = GetNavigationIndex(GraphPanel.ToSharedRef());
+	const FVimGraphNodePins*  NodePins = NavIndex.FindNodePins(TrackedNodeObj);
+	if (!NodePins || NodePins->Num() == 0)
 		return;
 
-	TArray<TSharedRef<SWidget>>	  Pins;
-	TArray<TSharedRef<SGraphPin>> CurrentPinGroup;
-	GraphNode->GetPins(Pins);
+	UEdGraphPin* PinObj = TrackedNodeObj->GetPinAt(GraphSelectionTracker.PinIndex);
+	const int32	 CurrPinIndex = NodePins->FindPin(PinObj);
+	if (CurrPinIndex == INDEX_NONE)
+		return; // Pin not found in the current node's pins array
 
-	// Remove (filter) non‐visible pins as they're not important or useful
-	Pins.RemoveAll([](const TSharedRef<SWidget>& Pin) { return !Pin->GetVisibility().IsVisible(); });
-	if (Pins.IsEmpty())
+	TSharedPtr<SGraphPin> GraphPin = NodePins->Widgets[CurrPinIndex].Pin();
+	if (!GraphPin.IsValid())
 		return;
 
-	// NOTE: Unlike Widget Pins array getter: ObjPins array comes unsorted!
-	// Thus we're constructing the ObjPins array manually (sorted).
-	TArray<UEdGraphPin*> ObjPins;
-	for (const auto& Pin : Pins)
-	{
-		TSharedRef<SGraphPin> AsGraphPin = StaticCastSharedRef<SGraphPin>(Pin);
-		if (GraphPin->GetDirection() == AsGraphPin->GetDirection())
-			CurrentPinGroup.Add(AsGraphPin); // Collect associated group pins
-
-		if (UEdGraphPin* ObjPin = AsGraphPin->GetPinObj())
-			ObjPins.Add(ObjPin);
-	}
-	if (ObjPins.IsEmpty())
-		return; // No useful obj pins found
+	if (HandleVimExecutionFlowNavigation(
+			SlateApp, GraphPanel.ToSharedRef(), TrackedNodeObj, PinObj, InSequence))
+		return;
 
-	const TSharedRef<SGraphPin> GraphPinRef = GraphPin.ToSharedRef();
-	int32						CurrPinIndex = Pins.Find(GraphPinRef);
-	int32						GroupPinIndex = CurrentPinGroup.Find(GraphPinRef);
-	if (CurrPinIndex == INDEX_NONE || GroupPinIndex == INDEX_NONE)
-		return; // Pin not found in the current node's pins array
+	const TArray<int32>& CurrentPinGroup = NodePins->GetGroup(PinObj->Direction);
+	int32				 GroupPinIndex = NodePins->GroupIndices[CurrPinIndex];
 
 	// We should have at most 2 strokes:
 	const int32			SeqNum = InSequence.Num();
@@ -1474,7 +2015,7 @@ void UVimGraphEditorSubsystem::HandleVimNodeNavigation(
 		{
 			// Try find any linked pins if the current highlighted pin isn't
 			// linked and fallback to the nearest linked one.
-			if (PinObj->LinkedTo.IsEmpty() && !TryGetNearestLinkedPin(ObjPins, PinObj, CurrPinIndex, TargetDir))
+			if (PinObj->LinkedTo.IsEmpty() && !TryGetNearestLinkedPin(*NodePins, PinObj, CurrPinIndex, TargetDir))
 				return false; // No links found in any of the other pins
 
 			// Post-found linked pin to go to
@@ -1484,13 +2025,12 @@ void UVimGraphEditorSubsystem::HandleVimNodeNavigation(
 			UEdGraphNode* NewOwningNode = NewPin->GetOwningNode();
 			if (!NewOwningNode)
 				return false; // Invalid New Owning Node Object
-			TSharedPtr<SGraphNode> NewGraphNode =
-				GraphPanel->GetNodeWidgetFromGuid(NewOwningNode->NodeGuid);
+			TSharedPtr<SGraphNode> NewGraphNode = NavIndex.FindNodeWidget(NewOwningNode);
 			if (!NewGraphNode.IsValid())
 				return false; // Invalid New Owning Node Widget
-			TSharedPtr<SGraphPin> NewGraphPin = NewGraphNode->FindWidgetForPin(NewPin);
+			TSharedPtr<SGraphPin> NewGraphPin = NavIndex.FindPinWidget(NewPin);
 			if (!NewGraphPin.IsValid())
-				return false; // Invalid New Pin Widget
+				return false; // Invalid (or hidden) New Pin Widget
 
 			// Update tracking params
 			GraphSelectionTracker.GraphNode = NewOwningNode;
@@ -1511,7 +2051,7 @@ void UVimGraphEditorSubsystem::HandleVimNodeNavigation(
 		else // Move inside the same node; try grab parallel indexed pin:
 		{
 			TSharedPtr<SGraphPin> FoundPin;
-			if (!TryGetParallelPin(Pins, CurrPinIndex, TargetDir, FoundPin))
+			if (!TryGetParallelPin(*NodePins, CurrPinIndex, TargetDir, FoundPin))
 				return false;
 
 			// Highlight the New Pin we're moving into:
@@ -1534,7 +2074,9 @@ void UVimGraphEditorSubsystem::HandleVimNodeNavigation(
 			return false; // Can't move: we're at the edge of the pin group.
 
 		// Go the above or below Pin:
-		TargetPin = CurrentPinGroup[GroupPinIndex + Direction];
+		TargetPin = NodePins->Widgets[CurrentPinGroup[GroupPinIndex + Direction]].Pin();
+		if (!TargetPin.IsValid())
+			return false;
 
 		FUMInputHelpers::SimulateMouseMoveToPosition(SlateApp,
 			FVector2D(FUMSlateHelpers::GetWidgetCenterScreenSpacePosition(TargetPin.ToSharedRef())));
@@ -1630,9 +2172,10 @@ void UVimGraphEditorSubsystem::AdjustViewIfNodeOutOfBounds(
 	if (PanelSize.X <= 0.f || PanelSize.Y <= 0.f)
 		return; // Panel not fully initialized
 
-	// Zoom + offset in graph space
+	// Zoom + offset in graph space. Measured from where the view is already
+	// gliding to, so consecutive moves don't overshoot each other.
 	const float		ZoomAmount = InGraphPanel->GetZoomAmount();
-	const FVector2D ViewOffset = InGraphPanel->GetViewOffset();
+	const FVector2D ViewOffset = PanController.GetTargetViewOffset(InGraphPanel);
 
 	// Convert that top-left to panel space:
 	const FVector2D NodeTopLeftInPanel =
@@ -1678,8 +2221,8 @@ void UVimGraphEditorSubsystem::AdjustViewIfNodeOutOfBounds(
 		// Convert panel-space “Delta” into graph-space
 		const FVector2D GraphSpaceDelta = Delta / ZoomAmount;
 
-		// Shift the view offset so the node is back inside the safe zone
-		GraphEditor->SetViewLocation(ViewOffset + GraphSpaceDelta, ZoomAmount);
+		// Glide the view so the node is back inside the safe zone
+		PanController.GlideTo(InGraphPanel, ViewOffset + GraphSpaceDelta);
 	}
 }
 
@@ -1690,31 +2233,11 @@ UEdGraphPin* UVimGraphEditorSubsystem::GetFirstOrLastLinkedPinFromPin(const TSha
 	if (!OwningNode)
 		return InPin;
 
-	TSharedPtr<SGraphNode> OwningNodeWidget = GraphPanel->GetNodeWidgetFromGuid(OwningNode->NodeGuid);
-	if (!OwningNodeWidget.IsValid())
+	const FVimGraphNodePins* NodePins = GetNavigationIndex(GraphPanel).FindNodePins(OwningNode);
+	if (!NodePins || NodePins->Num() == 0)
 		return InPin;
 
-	TArray<TSharedRef<SWidget>> WidgetPins;
-	OwningNodeWidget->GetPins(WidgetPins);
-
-	// Remove (filter) non‐visible pins as they're not important or useful
-	WidgetPins.RemoveAll([](const TSharedRef<SWidget>& Pin) { return !Pin->GetVisibility().IsVisible(); });
-	if (WidgetPins.IsEmpty())
-		return InPin;
-
-	// NOTE: Unlike Widget Pins array getter: ObjPins array comes unsorted!
-	// Thus we're constructing the ObjPins array manually (sorted).
-	TArray<UEdGraphPin*> ObjPins;
-	for (const auto& Pin : WidgetPins)
-	{
-		TSharedRef<SGraphPin> AsGraphPin = StaticCastSharedRef<SGraphPin>(Pin);
-		if (UEdGraphPin* ObjPin = AsGraphPin->GetPinObj())
-			ObjPins.Add(ObjPin);
-	}
-	if (ObjPins.IsEmpty())
-		return InPin; // No useful obj pins found
-
-	int32 CurrPinIndex = ObjPins.Find(InPin);
+	int32 CurrPinIndex = NodePins->FindPin(InPin);
 	if (CurrPinIndex == INDEX_NONE)
 		return InPin; // Pin not found in the current node's pins array
 
@@ -1722,7 +2245,7 @@ UEdGraphPin* UVimGraphEditorSubsystem::GetFirstOrLastLinkedPinFromPin(const TSha
 	{
 		if (InPin->LinkedTo.IsEmpty())
 		{
-			if (!TryGetNearestLinkedPin(ObjPins, InPin, CurrPinIndex, TargetDir)
+			if (!TryGetNearestLinkedPin(*NodePins, InPin, CurrPinIndex, TargetDir)
 				|| !InPin->LinkedTo[0])
 				return InPin;
 		}
@@ -1732,7 +2255,7 @@ UEdGraphPin* UVimGraphEditorSubsystem::GetFirstOrLastLinkedPinFromPin(const TSha
 	else
 	{
 		TSharedPtr<SGraphPin> FoundPinWidget;
-		if (!TryGetParallelPin(WidgetPins, CurrPinIndex, TargetDir, FoundPinWidget))
+		if (!TryGetParallelPin(*NodePins, CurrPinIndex, TargetDir, FoundPinWidget))
 			return InPin;
 
 		UEdGraphPin* CheckPin = FoundPinWidget->GetPinObj();
@@ -1745,74 +2268,30 @@ UEdGraphPin* UVimGraphEditorSubsystem::GetFirstOrLastLinkedPinFromPin(const TSha
 }
 
 bool UVimGraphEditorSubsystem::TryGetParallelPin(
-	const TArray<TSharedRef<SWidget>> InWidgetPins,
+	const FVimGraphNodePins& InNodePins,
 	int32 BasePinIndex, EEdGraphPinDirection TargetDir,
-	TSharedPtr<SGraphPin>& OutPinWidget, bool bShouldMatchExactIndex)
+	TSharedPtr<SGraphPin>& OutPinWidget)
 {
-	TArray<TSharedRef<SGraphPin>> ParallelPins;
-	for (const auto& Widget : InWidgetPins) // Collect all Parallel Pins
-	{
-		TSharedRef<SGraphPin> PinWidget = StaticCastSharedRef<SGraphPin>(Widget);
-		if (PinWidget->GetDirection() == TargetDir)
-			ParallelPins.Add(PinWidget);
-	}
-	if (ParallelPins.IsEmpty())
+	// The pin on the same row within the target direction's group (or its
+	// last one, if that group is shorter).
+	const int32 ParallelIndex = InNodePins.FindParallelPin(BasePinIndex, TargetDir);
+	if (ParallelIndex == INDEX_NONE)
 		return false; // No pins to navigate to.
 
-	// Because the node's pins are ordered (all inputs first,
-	// then outputs), we can compute the “relative index” as follows:
-	// *For H (TargetDir == EGPD_Input):
-	//     Current pin is output, so subtract total input count.
-	// *For L (TargetDir == EGPD_Output):
-	//     Current pin is input so its index is already relative.
-	int32 RelativeIndex = 0;
-	RelativeIndex = (TargetDir == EGPD_Input)
-		? BasePinIndex - ParallelPins.Num() // Output to Input
-		: BasePinIndex;						// Input to Output
-
-	// if there isn't an exact parallel pin for the currently indexed pin:
-	// Fallback to the last parallel pin.
-	// This is needed only if the current index is above 0.
-	// For 0, it will always return valid and grab the first one because the
-	// array is guaranteed to be not empty.
-	if (!ParallelPins.IsValidIndex(RelativeIndex))
-		RelativeIndex = ParallelPins.Num() - 1;
-
-	OutPinWidget = ParallelPins[RelativeIndex];
-	return true;
+	OutPinWidget = InNodePins.Widgets[ParallelIndex].Pin();
+	return OutPinWidget.IsValid();
 }
 
 bool UVimGraphEditorSubsystem::TryGetNearestLinkedPin(
-	const TArray<UEdGraphPin*>& InSortedObjPins, UEdGraphPin*& OutPin,
+	const FVimGraphNodePins& InNodePins, UEdGraphPin*& OutPin,
 	int32 TrackedPinIndex, EEdGraphPinDirection FollowDir)
 {
-	int32 SearchUp{ TrackedPinIndex - 1 }, // Try find upwards
-		SearchDown{ TrackedPinIndex + 1 }, // Try find downwards
-		TimeOut{ (InSortedObjPins.Num() / 2) + 1 };
-	auto Pred = [&](int32 Index) {
-		return (InSortedObjPins.IsValidIndex(Index)
-			&& InSortedObjPins[Index]
-			&& !InSortedObjPins[Index]->bAdvancedView
-			&& InSortedObjPins[Index]->Direction == FollowDir
-			&& !InSortedObjPins[Index]->LinkedTo.IsEmpty());
-	};
-	while (TimeOut > 0)
-	{
-		if (Pred(SearchUp))
-		{
-			OutPin = InSortedObjPins[SearchUp];
-			return true;
-		}
-		else if (Pred(SearchDown))
-		{
-			OutPin = InSortedObjPins[SearchDown];
-			return true;
-		}
-		--SearchUp;
-		++SearchDown;
-		--TimeOut;
-	}
-	return false; // No links found in any of the other pins
+	const int32 LinkedIndex = InNodePins.FindNearestLinkedPin(TrackedPinIndex, FollowDir);
+	if (LinkedIndex == INDEX_NONE)
+		return false; // No links found in any of the other pins
+
+	OutPin = InNodePins.Objs[LinkedIndex];
+	return true;
 }
 
 void UVimGraphEditorSubsystem::DebugNodeAndPinsTypes()
@@ -1861,13 +2340,15 @@ void UVimGraphEditorSubsystem::AddNodeToPin(
 
 	// Reset both tracking parameters for a clean start (these are also cleaned
 	// in other places, but for safety, we want to reset here too)
-	ShiftedNodesOriginalPositions.Empty();
+	ShiftedNodes.Reset();
 	bNodesWereShifted = false;
 
 	// --------------------------
 	// 1) Collect nodes to shift
 	// --------------------------
-	TSet<UEdGraphNode*> NodesToShift;
+	FVimGraphNavigationIndex& NavIndex = GetNavigationIndex(GraphPanel);
+	TBitArray<>				  Visited(false, NavIndex.NumGraphNodes());
+	TArray<UEdGraphNode*>	  NodesToShift;
 
 	if (bIsAppendingNode)
 	{
@@ -1876,15 +2357,13 @@ void UVimGraphEditorSubsystem::AddNodeToPin(
 		for (UEdGraphPin* LinkedPin : InPin->LinkedTo)
 		{
 			if (LinkedPin && LinkedPin->GetOwningNode())
-			{
-				CollectDownstreamNodes(InPin, LinkedPin->GetOwningNode(), NodesToShift, /*bIsAppending=*/true);
-			}
+				CollectDownstreamNodes(NavIndex, LinkedPin->GetOwningNode(), Visited, NodesToShift);
 		}
 	}
 	else
 	{
 		// For inserting, we shift the "current" node plus anything downstream.
-		CollectDownstreamNodes(InPin, ParentNode, NodesToShift, /*bIsAppending=*/false);
+		CollectDownstreamNodes(NavIndex, ParentNode, Visited, NodesToShift);
 	}
 
 	// Shift nodes if there are any
@@ -1909,6 +2388,13 @@ void UVimGraphEditorSubsystem::AddNodeToPin(
 	NodeCounter = GraphObj->Nodes.Num();
 	// NodeCounter = GraphPanel->GetChildren()->Num();
 
+	// Prefer our own (cached) menu; it hands us the created node directly.
+	if (OpenActionMenuForPin(SlateApp, InPin, GraphPanel, bIsAppendingNode))
+		return;
+
+	// Otherwise, drag off the pin to open the graph's native menu & find out
+	// what it did once it's closed.
+
 	TSharedPtr<SGraphNode> ParentGraphNode =
 		GraphPanel->GetNodeWidgetFromGuid(ParentNode->NodeGuid);
 	if (!ParentGraphNode.IsValid())
@@ -1994,6 +2480,139 @@ void UVimGraphEditorSubsystem::AddNodeToPin(
 	AddNodeToPin(SlateApp, PinObj, ParentNode, GraphPanel.ToSharedRef(), bIsAppendingNode);
 }
 
+bool UVimGraphEditorSubsystem::OpenActionMenuForPin(
+	FSlateApplication&			   SlateApp,
+	UEdGraphPin*				   InPin,
+	const TSharedRef<SGraphPanel>& GraphPanel,
+	bool						   bIsAppendingNode)
+{
+	UEdGraph* GraphObj = GraphPanel->GetGraphObj();
+	if (!GraphObj || !InPin)
+		return false;
+
+	const TSharedRef<const FVimGraphActionList> ActionList =
+		ActionCache.FindOrBuild(GraphObj, InPin);
+	if (ActionList->Actions.IsEmpty())
+		return false;
+
+	// Dismissing the menu after picking isn't a cancellation.
+	const TSharedRef<bool>					 bWasPicked = MakeShared<bool>(false);
+	const TSharedRef<TWeakPtr<IMenu>>		 WeakMenu = MakeShared<TWeakPtr<IMenu>>();
+	TWeakObjectPtr<UVimGraphEditorSubsystem> WeakThis(this);
+
+	const TSharedRef<SVimGraphActionMenu> ActionMenu =
+		SNew(SVimGraphActionMenu)
+			.ActionList(ActionList)
+			.OnActionPicked_Lambda(
+				[WeakThis, &SlateApp, InPin, bIsAppendingNode, bWasPicked, WeakMenu](
+					const TSharedPtr<FVimGraphAction>& InAction) {
+					*bWasPicked = true;
+					if (const TSharedPtr<IMenu> Menu = WeakMenu->Pin())
+						Menu->Dismiss();
+					if (WeakThis.IsValid())
+						WeakThis->CreateNodeFromAction(SlateApp, InAction, InPin, bIsAppendingNode);
+				})
+			.OnDismissed_Lambda([WeakMenu]() {
+				if (const TSharedPtr<IMenu> Menu = WeakMenu->Pin())
+					Menu->Dismiss();
+			});
+
+	// Open it right next to the pin we're adding to
+	FVector2D MenuPosition = SlateApp.GetCursorPos();
+	if (const TSharedPtr<SGraphPin> PinWidget = GetNavigationIndex(GraphPanel).FindPinWidget(InPin))
+	{
+		const FGeometry& PinGeometry = PinWidget->GetCachedGeometry();
+		MenuPosition = FVector2D(bIsAppendingNode
+				? PinGeometry.LocalToAbsolute(FVector2D(PinGeometry.GetLocalSize().X, 0.f))
+				: PinGeometry.LocalToAbsolute(FVector2D::ZeroVector));
+	}
+
+	const TSharedPtr<IMenu> Menu = SlateApp.PushMenu(
+		GraphPanel, FWidgetPath(), ActionMenu, MenuPosition,
+		FPopupTransitionEffect(FPopupTransitionEffect::ContextMenu));
+	if (!Menu.IsValid())
+		return false;
+	*WeakMenu = Menu;
+
+	// Closed without picking (Escape, clicking away...): revert the space
+	// we've made for the node.
+	Menu->GetOnMenuDismissed().AddLambda(
+		[WeakThis, &SlateApp, InPin, bIsAppendingNode, bWasPicked](TSharedRef<IMenu>) {
+			if (!*bWasPicked && WeakThis.IsValid())
+				WeakThis->OnNodeCreationMenuClosed(SlateApp, InPin, bIsAppendingNode);
+		});
+
+	if (const TSharedPtr<SSearchBox> SearchBox = ActionMenu->GetSearchBox())
+		SlateApp.SetKeyboardFocus(SearchBox, EFocusCause::SetDirectly);
+
+	return true;
+}
+
+void UVimGraphEditorSubsystem::CreateNodeFromAction(
+	FSlateApplication&				   SlateApp,
+	const TSharedPtr<FVimGraphAction>& InAction,
+	UEdGraphPin*					   InPin,
+	bool							   bIsAppendingNode)
+{
+	UEdGraphNode* ParentNode = InPin ? InPin->GetOwningNode() : nullptr;
+	UEdGraph*	  GraphObj = ParentNode ? ParentNode->GetGraph() : nullptr;
+	if (!GraphObj || !InAction.IsValid() || !InAction->Action.IsValid())
+	{
+		OnNodeCreationMenuClosed(SlateApp, InPin, bIsAppendingNode);
+		return;
+	}
+
+	// Placed roughly; it's aligned to the parent node once it has a widget.
+	const FVector2D Location(
+		ParentNode->NodePosX + (bIsAppendingNode ? 300.0 : -300.0),
+		ParentNode->NodePosY);
+
+	UEdGraphNode* NewNodeObj = nullptr;
+	{
+		const FScopedTransaction Transaction(NSLOCTEXT("VimGraphEditor", "AddNodeFromMenu", "Add Node"));
+		NewNodeObj = InAction->Action->PerformAction(
+			GraphObj, InPin, ConvertToNodePosition(Location), /*bSelectNewNode=*/true);
+	}
+
+	if (!NewNodeObj)
+	{
+		// Some actions don't spawn nodes (e.g. creating a variable)
+		OnNodeCreationMenuClosed(SlateApp, InPin, bIsAppendingNode);
+		return;
+	}
+	OnActionMenuNodeCreated(SlateApp, NewNodeObj, InPin, bIsAppendingNode, /*TicksLeft=*/5);
+}
+
+void UVimGraphEditorSubsystem::OnActionMenuNodeCreated(
+	FSlateApplication&			 SlateApp,
+	TWeakObjectPtr<UEdGraphNode> NewNode,
+	UEdGraphPin*				 InPin,
+	bool						 bIsAppendingNode,
+	int32						 TicksLeft)
+{
+	UEdGraphNode*				  NewNodeObj = NewNode.Get();
+	const TSharedPtr<SGraphPanel> GraphPanel = FUMSlateHelpers::TryGetActiveGraphPanel(SlateApp);
+	if (!NewNodeObj || !GraphPanel.IsValid())
+	{
+		FVimInputProcessor::Get()->SetVimMode(SlateApp, EVimMode::Normal);
+		return;
+	}
+
+	if (!GraphPanel->GetNodeWidgetFromGuid(NewNodeObj->NodeGuid).IsValid() && TicksLeft > 0)
+	{
+		TWeakObjectPtr<UVimGraphEditorSubsystem> WeakThis(this);
+		GEditor->GetTimerManager()->SetTimerForNextTick(
+			[WeakThis, &SlateApp, NewNode, InPin, bIsAppendingNode, TicksLeft]() {
+				if (WeakThis.IsValid())
+					WeakThis->OnActionMenuNodeCreated(
+						SlateApp, NewNode, InPin, bIsAppendingNode, TicksLeft - 1);
+			});
+		return;
+	}
+
+	OnNodeCreationMenuClosed(SlateApp, InPin, bIsAppendingNode, NewNodeObj);
+}
+
 void UVimGraphEditorSubsystem::Log_AddNodeToPin(bool bIsAppendingNode)
 {
 	Logger.Print(FString::Printf(TEXT("bIsAppendingNode: %s"),
@@ -2001,7 +2620,7 @@ void UVimGraphEditorSubsystem::Log_AddNodeToPin(bool bIsAppendingNode)
 		ELogVerbosity::Log, true);
 
 	Logger.Print(FString::Printf(TEXT("Node Positions Stored: %d"),
-					 ShiftedNodesOriginalPositions.Num()),
+					 ShiftedNodes.Num()),
 		ELogVerbosity::Log, true);
 }
 
@@ -2572,23 +3191,23 @@ void UVimGraphEditorSubsystem::DebugSelectedNode(FSlateApplication& SlateApp, co
 
 TSharedPtr<SGraphPin> UVimGraphEditorSubsystem::FindPinWidgetFromObj(UEdGraphPin* InPin, TSharedRef<SGraphPanel> InGraphPanel)
 {
-	if (UEdGraphNode* OwningNode = InPin->GetOwningNode())
-	{
-		if (TSharedPtr<SGraphNode> NodeWidget =
-				InGraphPanel->GetNodeWidgetFromGuid(OwningNode->NodeGuid))
-			return NodeWidget->FindWidgetForPin(InPin);
-	}
+	if (!InPin)
+		return nullptr;
+
+	FVimGraphNavigationIndex& NavIndex = GetNavigationIndex(InGraphPanel);
+	if (TSharedPtr<SGraphPin> PinWidget = NavIndex.FindPinWidget(InPin))
+		return PinWidget;
+
+	// Not among the visible pins; ask the node widget directly
+	if (TSharedPtr<SGraphNode> NodeWidget = NavIndex.FindNodeWidget(InPin->GetOwningNode()))
+		return NodeWidget->FindWidgetForPin(InPin);
 	return nullptr;
 }
 
 TSharedPtr<SGraphPin> UVimGraphEditorSubsystem::FindPinWidgetFromObj(UEdGraphPin* InPin, UEdGraphNode* InNode, TSharedRef<SGraphPanel> InGraphPanel)
 {
 	if (InNode && InPin)
-	{
-		if (TSharedPtr<SGraphNode> NodeWidget =
-				InGraphPanel->GetNodeWidgetFromGuid(InNode->NodeGuid))
-			return NodeWidget->FindWidgetForPin(InPin);
-	}
+		return FindPinWidgetFromObj(InPin, InGraphPanel);
 	return nullptr;
 }
 
@@ -2602,14 +3221,12 @@ UEdGraphPin* UVimGraphEditorSubsystem::GetFirstVisiblePinInNode(UEdGraphNode* In
 
 TSharedPtr<SGraphPin> UVimGraphEditorSubsystem::GetFirstVisiblePinWidgetInNode(UEdGraphNode* InNode, const TSharedRef<SGraphPanel> InGraphPanel)
 {
-	TArray<TSharedRef<SWidget>> PinWidgets;
-	if (TSharedPtr<SGraphNode> NodeWidget = InGraphPanel->GetNodeWidgetFromGuid(InNode->NodeGuid))
+	if (const FVimGraphNodePins* NodePins = GetNavigationIndex(InGraphPanel).FindNodePins(InNode))
 	{
-		NodeWidget->GetPins(PinWidgets);
-		for (const auto& Pin : PinWidgets)
+		for (const TWeakPtr<SGraphPin>& Pin : NodePins->Widgets)
 		{
-			TSharedRef<SGraphPin> GraphPin = StaticCastSharedRef<SGraphPin>(Pin);
-			if (GraphPin->IsPinVisibleAsAdvanced().IsVisible())
+			TSharedPtr<SGraphPin> GraphPin = Pin.Pin();
+			if (GraphPin.IsValid() && GraphPin->IsPinVisibleAsAdvanced().IsVisible())
 				return GraphPin;
 		}
 	}
@@ -0,0 +1,246 @@
+#include "VimGraphExecutionOrder.h"
+#include "Algo/Reverse.h"
+#include "EdGraphSchema_K2.h"
+
+void FVimGraphExecutionOrder::Bind(UEdGraph* InGraph)
+{
+	if (Graph.Get() == InGraph)
+		return;
+
+	Graph = InGraph;
+	bIsDirty = true;
+}
+
+bool FVimGraphExecutionOrder::Contains(const UEdGraphNode* InNode)
+{
+	return FindNodeIndex(InNode) != INDEX_NONE;
+}
+
+UEdGraphNode* FVimGraphExecutionOrder::FindInChain(
+	const UEdGraphNode* FromNode, const int32 Offset)
+{
+	const int32 NodeIndex = FindNodeIndex(FromNode);
+	if (NodeIndex == INDEX_NONE)
+		return nullptr;
+
+	const FChain& Chain = Chains[ChainOfNode[NodeIndex]];
+	const int32	  LastIndex = Chain.Start + Chain.Num - 1;
+
+	return Nodes[Order[FMath::Clamp(OrderIndex[NodeIndex] + Offset, Chain.Start, LastIndex)]].Get();
+}
+
+UEdGraphNode* FVimGraphExecutionOrder::FindChainEdge(
+	const UEdGraphNode* FromNode, const bool bFindFirstNode)
+{
+	const int32 NodeIndex = FindNodeIndex(FromNode);
+	if (NodeIndex == INDEX_NONE)
+		return nullptr;
+
+	const FChain& Chain = Chains[ChainOfNode[NodeIndex]];
+	return Nodes[Order[bFindFirstNode ? Chain.Start : Chain.Start + Chain.Num - 1]].Get();
+}
+
+int32 FVimGraphExecutionOrder::FindNodeIndex(const UEdGraphNode* InNode)
+{
+	if (bIsDirty)
+		Rebuild();
+
+	const int32* Index = IndexByNode.Find(InNode);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void FVimGraphExecutionOrder::Rebuild()
+{
+	bIsDirty = false;
+
+	Nodes.Reset();
+	IndexByNode.Reset();
+	SuccessorOffsets.Reset();
+	Successors.Reset();
+	PredecessorOffsets.Reset();
+	Predecessors.Reset();
+	Order.Reset();
+	OrderIndex.Reset();
+	ChainOfNode.Reset();
+	Chains.Reset();
+
+	UEdGraph* GraphObj = Graph.Get();
+	if (!GraphObj)
+		return;
+
+	// Graphs with execution pins flow through them only; others through all.
+	bool bHasExecPins = false;
+	for (const UEdGraphNode* Node : GraphObj->Nodes)
+	{
+		if (!Node)
+			continue;
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+			{
+				bHasExecPins = true;
+				break;
+			}
+		}
+		if (bHasExecPins)
+			break;
+	}
+
+	auto IsFlowPin = [bHasExecPins](const UEdGraphPin* Pin) {
+		return Pin && (!bHasExecPins || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec);
+	};
+
+	// ~ Nodes ~
+	//
+	for (UEdGraphNode* Node : GraphObj->Nodes)
+	{
+		if (!Node || !Node->Pins.ContainsByPredicate(IsFlowPin))
+			continue;
+		if (!bHasExecPins && !Node->Pins.ContainsByPredicate([](const UEdGraphPin* Pin) {
+				return Pin && !Pin->LinkedTo.IsEmpty();
+			}))
+			continue; // Without execution pins, only linked nodes flow anywhere
+
+		IndexByNode.Add(Node, Nodes.Num());
+		Nodes.Add(Node);
+	}
+
+	const int32 NumNodes = Nodes.Num();
+	if (NumNodes == 0)
+		return;
+
+	// ~ Successors ~ (outputs in pin order, each node once)
+	//
+	SuccessorOffsets.SetNumUninitialized(NumNodes + 1);
+	TArray<int32> InDegrees;
+	InDegrees.SetNumZeroed(NumNodes);
+
+	for (int32 i = 0; i < NumNodes; ++i)
+	{
+		SuccessorOffsets[i] = Successors.Num();
+		for (const UEdGraphPin* Pin : Nodes[i]->Pins)
+		{
+			if (!IsFlowPin(Pin) || Pin->Direction != EGPD_Output)
+				continue;
+
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				const int32* Successor = LinkedPin
+					? IndexByNode.Find(LinkedPin->GetOwningNode())
+					: nullptr;
+				if (!Successor || *Successor == i)
+					continue;
+
+				// Nodes have a handful of links; a linear check is cheapest.
+				const TArrayView<const int32> NodeSuccessors(
+					Successors.GetData() + SuccessorOffsets[i], Successors.Num() - SuccessorOffsets[i]);
+				if (NodeSuccessors.Contains(*Successor))
+					continue;
+
+				Successors.Add(*Successor);
+				++InDegrees[*Successor];
+			}
+		}
+	}
+	SuccessorOffsets[NumNodes] = Successors.Num();
+
+	// ~ Predecessors ~ (the successor lists, inverted)
+	//
+	PredecessorOffsets.SetNumUninitialized(NumNodes + 1);
+	PredecessorOffsets[0] = 0;
+	for (int32 i = 0; i < NumNodes; ++i)
+		PredecessorOffsets[i + 1] = PredecessorOffsets[i] + InDegrees[i];
+
+	Predecessors.SetNumUninitialized(Successors.Num());
+	TArray<int32> Filled = PredecessorOffsets;
+	for (int32 i = 0; i < NumNodes; ++i)
+	{
+		for (int32 s = SuccessorOffsets[i]; s < SuccessorOffsets[i + 1]; ++s)
+			Predecessors[Filled[Successors[s]]++] = i;
+	}
+
+	// ~ Chains ~
+	//
+	// Entries first, top to bottom (then left to right), like they're read.
+	TArray<int32> Roots;
+	for (int32 i = 0; i < NumNodes; ++i)
+	{
+		if (PredecessorOffsets[i] == PredecessorOffsets[i + 1])
+			Roots.Add(i);
+	}
+	auto ByPosition = [this](const int32 A, const int32 B) {
+		const UEdGraphNode* NodeA = Nodes[A].Get();
+		const UEdGraphNode* NodeB = Nodes[B].Get();
+		if (NodeA->NodePosY != NodeB->NodePosY)
+			return NodeA->NodePosY < NodeB->NodePosY;
+		return NodeA->NodePosX < NodeB->NodePosX;
+	};
+	Roots.Sort(ByPosition);
+
+	Order.Reserve(NumNodes);
+	OrderIndex.Init(INDEX_NONE, NumNodes);
+	ChainOfNode.Init(INDEX_NONE, NumNodes);
+	TBitArray<> Visited(false, NumNodes);
+
+	for (const int32 Root : Roots)
+		AddChain(Root, Visited);
+
+	// Whatever is left is only reachable through cycles; enter each at its
+	// first node by position.
+	if (Order.Num() < NumNodes)
+	{
+		TArray<int32> Remaining;
+		for (int32 i = 0; i < NumNodes; ++i)
+		{
+			if (!Visited[i])
+				Remaining.Add(i);
+		}
+		Remaining.Sort(ByPosition);
+
+		for (const int32 Root : Remaining)
+		{
+			if (!Visited[Root])
+				AddChain(Root, Visited);
+		}
+	}
+}
+
+void FVimGraphExecutionOrder::AddChain(const int32 RootIndex, TBitArray<>& Visited)
+{
+	// Reverse post-order of a depth-first walk is a topological order (back
+	// edges of cycles aside). Walking the successors last to first leaves the
+	// first branch first once reversed.
+	const int32 ChainStart = Order.Num();
+
+	TArray<TPair<int32, int32>> Stack; // Node, successors left to walk
+	Visited[RootIndex] = true;
+	Stack.Emplace(RootIndex, SuccessorOffsets[RootIndex + 1] - SuccessorOffsets[RootIndex]);
+
+	while (!Stack.IsEmpty())
+	{
+		TPair<int32, int32>& Top = Stack.Last();
+		if (Top.Value == 0)
+		{
+			Order.Add(Top.Key); // Post-order
+			Stack.Pop();
+			continue;
+		}
+
+		const int32 Successor = Successors[SuccessorOffsets[Top.Key] + --Top.Value];
+		if (Visited[Successor])
+			continue;
+
+		Visited[Successor] = true;
+		Stack.Emplace(Successor, SuccessorOffsets[Successor + 1] - SuccessorOffsets[Successor]);
+	}
+
+	const int32 ChainNum = Order.Num() - ChainStart;
+	Algo::Reverse(MakeArrayView(Order.GetData() + ChainStart, ChainNum));
+
+	const int32 ChainIndex = Chains.Add({ ChainStart, ChainNum });
+	for (int32 i = ChainStart; i < Order.Num(); ++i)
+	{
+		OrderIndex[Order[i]] = i;
+		ChainOfNode[Order[i]] = ChainIndex;
+	}
+}
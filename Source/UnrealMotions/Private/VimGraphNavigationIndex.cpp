@@ -0,0 +1,342 @@
+#include "VimGraphNavigationIndex.h"
+
+///////////////////////////////////////////////////////////////////////////////
+//						~ FVimGraphNodePins ~
+//
+int32 FVimGraphNodePins::FindPin(const UEdGraphPin* InPin) const
+{
+	const int32* Index = IndexByPin.Find(const_cast<UEdGraphPin*>(InPin));
+	return Index ? *Index : INDEX_NONE;
+}
+
+int32 FVimGraphNodePins::FindParallelPin(
+	const int32 PinIndex, const EEdGraphPinDirection TargetDir) const
+{
+	const TArray<int32>& ParallelPins = GetGroup(TargetDir);
+	if (ParallelPins.IsEmpty() || !GroupIndices.IsValidIndex(PinIndex))
+		return INDEX_NONE; // No pins to navigate to.
+
+	// Fallback to the last parallel pin if there isn't an exact parallel one.
+	return ParallelPins[FMath::Min(GroupIndices[PinIndex], ParallelPins.Num() - 1)];
+}
+
+int32 FVimGraphNodePins::FindNearestLinkedPin(
+	const int32 PinIndex, const EEdGraphPinDirection FollowDir) const
+{
+	auto IsLinked = [this, FollowDir](const int32 Index) {
+		const UEdGraphPin* Pin = Objs[Index];
+		return Pin && !Pin->bAdvancedView && Pin->Direction == FollowDir
+			&& !Pin->LinkedTo.IsEmpty();
+	};
+
+	for (int32 Up = PinIndex - 1, Down = PinIndex + 1;
+		Up >= 0 || Down < Objs.Num(); --Up, ++Down)
+	{
+		if (Up >= 0 && IsLinked(Up))
+			return Up;
+		if (Down < Objs.Num() && IsLinked(Down))
+			return Down;
+	}
+	return INDEX_NONE; // No links found in any of the other pins
+}
+//
+//						~ FVimGraphNodePins ~
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+//						~ FVimGraphNavigationIndex ~
+//
+bool FVimGraphNavigationIndex::Bind(const TSharedRef<SGraphPanel>& InPanel)
+{
+	if (Panel.HasSameObject(&InPanel.Get()))
+		return false;
+
+	Reset();
+	Panel = InPanel;
+	return true;
+}
+
+void FVimGraphNavigationIndex::Reset()
+{
+	Panel.Reset();
+	NodeWidgets.Reset();
+	NodePins.Reset();
+	bAreNodeWidgetsDirty = true;
+	LastCollectFrame = MAX_uint64;
+	NodeIndices.Reset();
+	bAreNodeIndicesDirty = true;
+	SpatialGrid.Reset();
+	DirtySpatialNodes.Reset();
+	bIsSpatialGridDirty = true;
+}
+
+TSharedPtr<SGraphNode> FVimGraphNavigationIndex::FindNodeWidget(const UEdGraphNode* InNode)
+{
+	if (!InNode)
+		return nullptr;
+
+	if (bAreNodeWidgetsDirty)
+		CollectNodeWidgets();
+
+	if (const TWeakPtr<SGraphNode>* NodeWidget = NodeWidgets.Find(InNode))
+	{
+		if (TSharedPtr<SGraphNode> Pinned = NodeWidget->Pin())
+			return Pinned;
+	}
+
+	// Missing or stale: the panel may have (re)created widgets without the
+	// graph telling us. Recollect, though at most once a frame.
+	if (LastCollectFrame == GFrameCounter)
+		return nullptr;
+
+	CollectNodeWidgets();
+	const TWeakPtr<SGraphNode>* NodeWidget = NodeWidgets.Find(InNode);
+	return NodeWidget ? NodeWidget->Pin() : nullptr;
+}
+
+int32 FVimGraphNavigationIndex::FindNodeIndex(const UEdGraphNode* InNode)
+{
+	if (bAreNodeIndicesDirty)
+		CollectNodeIndices();
+
+	const int32* Index = NodeIndices.Find(InNode);
+	return Index ? *Index : INDEX_NONE;
+}
+
+int32 FVimGraphNavigationIndex::NumGraphNodes()
+{
+	if (bAreNodeIndicesDirty)
+		CollectNodeIndices();
+
+	return NodeIndices.Num();
+}
+
+const FVimGraphNodePins* FVimGraphNavigationIndex::FindNodePins(UEdGraphNode* InNode)
+{
+	const TSharedPtr<SGraphNode> NodeWidget = FindNodeWidget(InNode);
+	if (!NodeWidget.IsValid())
+		return nullptr;
+
+	TUniquePtr<FVimGraphNodePins>& Pins = NodePins.FindOrAdd(InNode);
+	if (!Pins.IsValid())
+		Pins = MakeUnique<FVimGraphNodePins>();
+
+	TArray<TSharedRef<SWidget>> PinWidgets;
+	NodeWidget->GetPins(PinWidgets);
+
+	// Rebuilt if the node got another widget, other pins, its pin widgets
+	// were regenerated (these all go at once, so checking the first will do)
+	// or some of them were shown or hidden.
+	if (!Pins->NodeWidget.HasSameObject(NodeWidget.Get())
+		|| Pins->NumNodePins != InNode->Pins.Num()
+		|| Pins->AdvancedPinDisplay != InNode->AdvancedPinDisplay
+		|| (Pins->Num() > 0 && !Pins->Widgets[0].IsValid())
+		|| Pins->PinVisibilityHash != HashPinVisibility(PinWidgets))
+		BuildNodePins(NodeWidget.ToSharedRef(), PinWidgets, *Pins);
+
+	return Pins.Get();
+}
+
+TSharedPtr<SGraphPin> FVimGraphNavigationIndex::FindPinWidget(UEdGraphPin* InPin)
+{
+	if (!InPin)
+		return nullptr;
+
+	if (const FVimGraphNodePins* Pins = FindNodePins(InPin->GetOwningNode()))
+	{
+		const int32 Index = Pins->FindPin(InPin);
+		if (Index != INDEX_NONE)
+			return Pins->Widgets[Index].Pin();
+	}
+	return nullptr;
+}
+
+FVimGraphSpatialGrid& FVimGraphNavigationIndex::GetSpatialGrid()
+{
+	const TSharedPtr<SGraphPanel> GraphPanel = Panel.Pin();
+	UEdGraph*					  GraphObj = GraphPanel.IsValid() ? GraphPanel->GetGraphObj() : nullptr;
+	if (!GraphObj)
+	{
+		SpatialGrid.Reset();
+		return SpatialGrid;
+	}
+
+	if (bIsSpatialGridDirty)
+	{
+		bIsSpatialGridDirty = false;
+		DirtySpatialNodes.Reset();
+		SpatialGrid.Reset();
+		SpatialGrid.Reserve(GraphObj->Nodes.Num());
+		for (UEdGraphNode* Node : GraphObj->Nodes)
+		{
+			if (!Node)
+				continue;
+
+			FBox2D Bounds;
+			if (!GetNodeBounds(Node, Bounds))
+				DirtySpatialNodes.Add(Node); // Size it once laid out
+			SpatialGrid.Update(Node, Bounds);
+		}
+		return SpatialGrid;
+	}
+
+	TArray<TWeakObjectPtr<UEdGraphNode>> NodesToUpdate = DirtySpatialNodes.Array();
+	DirtySpatialNodes.Reset();
+	for (const TWeakObjectPtr<UEdGraphNode>& WeakNode : NodesToUpdate)
+	{
+		UEdGraphNode* Node = WeakNode.Get();
+		if (!Node)
+			continue; // Destroyed; it'll be skipped until the next rebuild
+
+		// Indexed nodes were only moved or edited (removed ones have left the
+		// grid already). Others are checked to be new, rather than modified on
+		// their way out of the graph.
+		if (!SpatialGrid.Contains(Node) && !GraphObj->Nodes.Contains(Node))
+			continue;
+
+		FBox2D Bounds;
+		if (!GetNodeBounds(Node, Bounds))
+			DirtySpatialNodes.Add(Node);
+		SpatialGrid.Update(Node, Bounds);
+	}
+	return SpatialGrid;
+}
+
+void FVimGraphNavigationIndex::OnGraphChanged(const FEdGraphEditAction& InAction)
+{
+	if (InAction.Action == GRAPHACTION_SelectNode)
+		return; // Nothing we index
+
+	if (InAction.Nodes.IsEmpty()) // Unspecified; forget all about it
+	{
+		NodePins.Reset();
+		bAreNodeWidgetsDirty = true;
+		bAreNodeIndicesDirty = true;
+		bIsSpatialGridDirty = true;
+		return;
+	}
+
+	const bool bIsRemovingNodes = (InAction.Action & GRAPHACTION_RemoveNode) != 0;
+	for (const UEdGraphNode* Node : InAction.Nodes)
+	{
+		UEdGraphNode* MutableNode = const_cast<UEdGraphNode*>(Node);
+		NodePins.Remove(Node);
+		if (bIsRemovingNodes)
+		{
+			SpatialGrid.Remove(Node);
+			DirtySpatialNodes.Remove(MutableNode);
+		}
+		else if (!bIsSpatialGridDirty)
+			DirtySpatialNodes.Add(MutableNode);
+	}
+
+	// The panel creates & destroys their widgets on its next update.
+	if (InAction.Action & (GRAPHACTION_AddNode | GRAPHACTION_RemoveNode))
+	{
+		bAreNodeWidgetsDirty = true;
+		bAreNodeIndicesDirty = true;
+	}
+}
+
+void FVimGraphNavigationIndex::OnNodeModified(UEdGraphNode* InNode)
+{
+	if (!bIsSpatialGridDirty)
+		DirtySpatialNodes.Add(InNode);
+}
+
+void FVimGraphNavigationIndex::CollectNodeWidgets()
+{
+	NodeWidgets.Reset();
+	bAreNodeWidgetsDirty = false;
+	LastCollectFrame = GFrameCounter;
+
+	const TSharedPtr<SGraphPanel> GraphPanel = Panel.Pin();
+	FChildren*					  Children = GraphPanel.IsValid() ? GraphPanel->GetChildren() : nullptr;
+	if (!Children)
+		return;
+
+	NodeWidgets.Reserve(Children->Num());
+	for (int32 i = 0; i < Children->Num(); ++i)
+	{
+		// The panel's children are all node widgets
+		const TSharedRef<SGraphNode> NodeWidget =
+			StaticCastSharedRef<SGraphNode>(Children->GetChildAt(i));
+		if (UEdGraphNode* NodeObj = NodeWidget->GetNodeObj())
+			NodeWidgets.Add(NodeObj, NodeWidget);
+	}
+}
+
+void FVimGraphNavigationIndex::CollectNodeIndices()
+{
+	NodeIndices.Reset();
+	bAreNodeIndicesDirty = false;
+
+	const TSharedPtr<SGraphPanel> GraphPanel = Panel.Pin();
+	UEdGraph*					  GraphObj = GraphPanel.IsValid() ? GraphPanel->GetGraphObj() : nullptr;
+	if (!GraphObj)
+		return;
+
+	NodeIndices.Reserve(GraphObj->Nodes.Num());
+	for (UEdGraphNode* Node : GraphObj->Nodes)
+	{
+		if (Node && !NodeIndices.Contains(Node))
+			NodeIndices.Add(Node, NodeIndices.Num());
+	}
+}
+
+void FVimGraphNavigationIndex::BuildNodePins(const TSharedRef<SGraphNode>& InNodeWidget,
+	const TArray<TSharedRef<SWidget>>& InPinWidgets, FVimGraphNodePins& OutPins)
+{
+	OutPins = FVimGraphNodePins();
+	OutPins.NodeWidget = InNodeWidget;
+	OutPins.PinVisibilityHash = HashPinVisibility(InPinWidgets);
+	if (UEdGraphNode* NodeObj = InNodeWidget->GetNodeObj())
+	{
+		OutPins.NumNodePins = NodeObj->Pins.Num();
+		OutPins.AdvancedPinDisplay = NodeObj->AdvancedPinDisplay;
+	}
+
+	// NOTE: Unlike the widget pins, the node's obj pins come unsorted!
+	// Thus we're going by the widgets and take their obj pins.
+	for (const TSharedRef<SWidget>& Widget : InPinWidgets)
+	{
+		// Skip non-visible pins as they're not important or useful
+		if (!Widget->GetVisibility().IsVisible())
+			continue;
+
+		const TSharedRef<SGraphPin> PinWidget = StaticCastSharedRef<SGraphPin>(Widget);
+		UEdGraphPin*				PinObj = PinWidget->GetPinObj();
+		if (!PinObj)
+			continue;
+
+		TArray<int32>& Group = PinObj->Direction == EGPD_Input ? OutPins.Inputs : OutPins.Outputs;
+		const int32	   Index = OutPins.Objs.Add(PinObj);
+		OutPins.Widgets.Add(PinWidget);
+		OutPins.GroupIndices.Add(Group.Add(Index));
+		OutPins.IndexByPin.Add(PinObj, Index);
+	}
+}
+
+uint32 FVimGraphNavigationIndex::HashPinVisibility(
+	const TArray<TSharedRef<SWidget>>& InPinWidgets)
+{
+	uint32 Hash = GetTypeHash(InPinWidgets.Num());
+	for (const TSharedRef<SWidget>& Widget : InPinWidgets)
+		Hash = HashCombine(Hash, Widget->GetVisibility().IsVisible() ? 1 : 0);
+	return Hash;
+}
+
+bool FVimGraphNavigationIndex::GetNodeBounds(UEdGraphNode* InNode, FBox2D& OutBounds)
+{
+	const FVector2D Position(InNode->NodePosX, InNode->NodePosY);
+
+	FVector2D Size(InNode->NodeWidth, InNode->NodeHeight); // Resizable nodes only
+	if (const TSharedPtr<SGraphNode> NodeWidget = FindNodeWidget(InNode))
+		Size = FVector2D(NodeWidget->GetDesiredSize());
+
+	OutBounds = FBox2D(Position, Position + Size);
+	return !Size.IsNearlyZero();
+}
+//
+//						~ FVimGraphNavigationIndex ~
+///////////////////////////////////////////////////////////////////////////////
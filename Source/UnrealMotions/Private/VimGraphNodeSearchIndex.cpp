@@ -0,0 +1,238 @@
+#include "VimGraphNodeSearchIndex.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraphSchema_K2.h"
+#include "UMTabRegistry.h"
+
+void FVimGraphNodeSearchIndex::Bind(UEdGraph* InGraph)
+{
+	if (Graph.Get() == InGraph)
+		return;
+
+	Reset();
+	Graph = InGraph;
+}
+
+void FVimGraphNodeSearchIndex::Reset()
+{
+	Graph.Reset();
+	Entries.Reset();
+	IndexByNode.Reset();
+	DirtyNodes.Reset();
+	bIsDirty = true;
+	LastQueryLower.Reset();
+	LastMatches.Reset();
+	bAreLastMatchesValid = false;
+}
+
+void FVimGraphNodeSearchIndex::Search(
+	const FString& InQuery, const FVector2D& InOrigin, TArray<UEdGraphNode*>& OutMatches)
+{
+	OutMatches.Reset();
+	Refresh();
+
+	const FString QueryLower = InQuery.TrimStartAndEnd().ToLower();
+	if (QueryLower.IsEmpty())
+	{
+		bAreLastMatchesValid = false;
+		return;
+	}
+
+	// Whatever matches the longer query matched the shorter one too.
+	const bool bIsNarrowing = bAreLastMatchesValid
+		&& !LastQueryLower.IsEmpty() && QueryLower.StartsWith(LastQueryLower);
+
+	struct FMatch
+	{
+		int32  Score;
+		double DistanceSquared;
+		int32  EntryIndex;
+	};
+	TArray<FMatch> Matches;
+
+	auto TryMatch = [&](const int32 EntryIndex) {
+		const FEntry& Entry = Entries[EntryIndex];
+		UEdGraphNode* Node = Entry.Node.Get();
+		if (!Node)
+			return;
+
+		const int32 Score = ScoreEntry(Entry, QueryLower);
+		if (Score == INDEX_NONE)
+			return;
+
+		const FVector2D Position(Node->NodePosX, Node->NodePosY);
+		Matches.Add({ Score, FVector2D::DistSquared(Position, InOrigin), EntryIndex });
+	};
+
+	if (bIsNarrowing)
+	{
+		for (const int32 EntryIndex : LastMatches)
+			TryMatch(EntryIndex);
+	}
+	else
+	{
+		for (int32 i = 0; i < Entries.Num(); ++i)
+			TryMatch(i);
+	}
+
+	LastQueryLower = QueryLower;
+	LastMatches.Reset(Matches.Num());
+	for (const FMatch& Match : Matches)
+		LastMatches.Add(Match.EntryIndex);
+	bAreLastMatchesValid = true;
+
+	Matches.Sort([](const FMatch& A, const FMatch& B) {
+		if (A.Score != B.Score)
+			return A.Score > B.Score;
+		return A.DistanceSquared < B.DistanceSquared;
+	});
+
+	OutMatches.Reserve(Matches.Num());
+	for (const FMatch& Match : Matches)
+		OutMatches.Add(Entries[Match.EntryIndex].Node.Get());
+}
+
+void FVimGraphNodeSearchIndex::OnGraphChanged(const FEdGraphEditAction& InAction)
+{
+	if (InAction.Action == GRAPHACTION_SelectNode || bIsDirty)
+		return; // Nothing we index, or we'll rebuild anyway
+
+	if (InAction.Nodes.IsEmpty()) // Unspecified; forget all about it
+	{
+		bIsDirty = true;
+		return;
+	}
+
+	const bool bIsRemovingNodes = (InAction.Action & GRAPHACTION_RemoveNode) != 0;
+	for (const UEdGraphNode* Node : InAction.Nodes)
+	{
+		if (bIsRemovingNodes)
+		{
+			RemoveNode(Node);
+			DirtyNodes.Remove(const_cast<UEdGraphNode*>(Node));
+		}
+		else // Added or edited; read on the next search
+			DirtyNodes.Add(const_cast<UEdGraphNode*>(Node));
+	}
+}
+
+void FVimGraphNodeSearchIndex::OnNodeModified(UEdGraphNode* InNode)
+{
+	if (!bIsDirty)
+		DirtyNodes.Add(InNode);
+}
+
+void FVimGraphNodeSearchIndex::Rebuild()
+{
+	bIsDirty = false;
+	Entries.Reset();
+	IndexByNode.Reset();
+	DirtyNodes.Reset();
+	bAreLastMatchesValid = false;
+
+	UEdGraph* GraphObj = Graph.Get();
+	if (!GraphObj)
+		return;
+
+	Entries.Reserve(GraphObj->Nodes.Num());
+	IndexByNode.Reserve(GraphObj->Nodes.Num());
+	for (UEdGraphNode* Node : GraphObj->Nodes)
+		AddNode(Node);
+}
+
+void FVimGraphNodeSearchIndex::Refresh()
+{
+	if (bIsDirty)
+	{
+		Rebuild();
+		return;
+	}
+	if (DirtyNodes.IsEmpty())
+		return;
+
+	UEdGraph* GraphObj = Graph.Get();
+	for (const TWeakObjectPtr<UEdGraphNode>& WeakNode : DirtyNodes)
+	{
+		UEdGraphNode* Node = WeakNode.Get();
+		if (!Node || Node->GetGraph() != GraphObj)
+			continue; // Destroyed or moved elsewhere; pruned as they're found
+
+		if (const int32* Index = IndexByNode.Find(Node))
+			ReadEntry(Node, Entries[*Index]);
+		else
+			AddNode(Node);
+	}
+	DirtyNodes.Reset();
+	bAreLastMatchesValid = false; // Texts may have changed under the matches
+}
+
+void FVimGraphNodeSearchIndex::AddNode(UEdGraphNode* InNode)
+{
+	if (!InNode || IndexByNode.Contains(InNode))
+		return;
+
+	const int32 Index = Entries.AddDefaulted();
+	ReadEntry(InNode, Entries[Index]);
+	IndexByNode.Add(InNode, Index);
+	bAreLastMatchesValid = false;
+}
+
+void FVimGraphNodeSearchIndex::RemoveNode(const UEdGraphNode* InNode)
+{
+	int32 Index;
+	if (!IndexByNode.RemoveAndCopyValue(InNode, Index))
+		return;
+
+	// Swap the last entry into the hole, re-pointing its lookup at it (even
+	// if its node was destroyed, so that lookup never points past the end).
+	const int32 LastIndex = Entries.Num() - 1;
+	if (Index != LastIndex)
+		IndexByNode.Add(Entries[LastIndex].Key, Index);
+	Entries.RemoveAtSwap(Index);
+	bAreLastMatchesValid = false;
+}
+
+void FVimGraphNodeSearchIndex::ReadEntry(UEdGraphNode* InNode, FEntry& OutEntry) const
+{
+	OutEntry.Node = InNode;
+	OutEntry.Key = InNode;
+	OutEntry.TitleLower = InNode->GetNodeTitle(ENodeTitleType::ListView).ToString().ToLower();
+	OutEntry.CommentLower = InNode->NodeComment.ToLower();
+
+	// Values typed into the node (e.g. a Print String's text)
+	OutEntry.DefaultsLower.Reset();
+	for (const UEdGraphPin* Pin : InNode->Pins)
+	{
+		if (!Pin || Pin->Direction != EGPD_Input || !Pin->LinkedTo.IsEmpty()
+			|| Pin->bHidden || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+			continue;
+
+		const FString Value = !Pin->DefaultTextValue.IsEmpty()
+			? Pin->DefaultTextValue.ToString()
+			: Pin->DefaultObject ? Pin->DefaultObject->GetName()
+								 : Pin->DefaultValue;
+		if (Value.IsEmpty())
+			continue;
+
+		if (!OutEntry.DefaultsLower.IsEmpty())
+			OutEntry.DefaultsLower.AppendChar(TEXT(' '));
+		OutEntry.DefaultsLower += Value.ToLower();
+	}
+}
+
+int32 FVimGraphNodeSearchIndex::ScoreEntry(const FEntry& InEntry, const FString& QueryLower) const
+{
+	// Highest tier first; the first field matching decides.
+	auto TryField = [&QueryLower](const FString& FieldLower, const int32 Tier) {
+		const int32 Score = FUMTabRegistry::ScoreFuzzyMatch(QueryLower, FieldLower);
+		if (Score == INDEX_NONE)
+			return INDEX_NONE;
+		return Tier * TierStride + FMath::Clamp(Score, 0, TierStride - 1);
+	};
+
+	int32 Score = TryField(InEntry.TitleLower, TitleTier);
+	if (Score == INDEX_NONE)
+		Score = TryField(InEntry.CommentLower, CommentTier);
+	if (Score == INDEX_NONE)
+		Score = TryField(InEntry.DefaultsLower, DefaultsTier);
+	return Score;
+}
@@ -0,0 +1,136 @@
+#include "VimGraphPanController.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GraphEditor.h"
+
+namespace
+{
+	FVector2D MoveTowards(const FVector2D& InCurrent, const FVector2D& InTarget, const double MaxStep)
+	{
+		const FVector2D Delta = InTarget - InCurrent;
+		const double	Distance = Delta.Size();
+		if (Distance <= MaxStep || Distance <= UE_SMALL_NUMBER)
+			return InTarget;
+		return InCurrent + Delta / Distance * MaxStep;
+	}
+} // namespace
+
+FVimGraphPanController::~FVimGraphPanController()
+{
+	Stop();
+}
+
+void FVimGraphPanController::SetHeldDirection(
+	const TSharedRef<SGraphPanel>& InPanel, const FVector2D& InDirection)
+{
+	if (Panel.Pin() != InPanel)
+	{
+		Stop(); // Whatever moved the previous panel doesn't carry over
+		Panel = InPanel;
+	}
+
+	HeldDirection = InDirection.GetSafeNormal();
+	if (!HeldDirection.IsZero())
+		StartTicking(); // Else, we're already ticking until we slow down
+}
+
+void FVimGraphPanController::GlideTo(
+	const TSharedRef<SGraphPanel>& InPanel, const FVector2D& InTargetOffset)
+{
+	if (Panel.Pin() != InPanel)
+	{
+		Stop();
+		Panel = InPanel;
+	}
+
+	GlideRemaining = InTargetOffset - InPanel->GetViewOffset();
+	if (!GlideRemaining.IsNearlyZero())
+		StartTicking();
+}
+
+FVector2D FVimGraphPanController::GetTargetViewOffset(
+	const TSharedRef<SGraphPanel>& InPanel) const
+{
+	const FVector2D ViewOffset = InPanel->GetViewOffset();
+	return Panel.Pin() == InPanel ? ViewOffset + GlideRemaining : ViewOffset;
+}
+
+void FVimGraphPanController::Stop()
+{
+	HeldDirection = Velocity = GlideRemaining = FVector2D::ZeroVector;
+
+	if (DelegateHandle_OnPreTick.IsValid())
+	{
+		if (FSlateApplication::IsInitialized())
+			FSlateApplication::Get().OnPreTick().Remove(DelegateHandle_OnPreTick);
+		DelegateHandle_OnPreTick.Reset();
+	}
+}
+
+void FVimGraphPanController::StartTicking()
+{
+	if (!DelegateHandle_OnPreTick.IsValid() && FSlateApplication::IsInitialized())
+		DelegateHandle_OnPreTick = FSlateApplication::Get().OnPreTick().AddRaw(
+			this, &FVimGraphPanController::OnPreTick);
+}
+
+void FVimGraphPanController::OnPreTick(float DeltaTime)
+{
+	const TSharedPtr<SGraphPanel> PanelPtr = Panel.Pin();
+	if (!PanelPtr.IsValid())
+	{
+		Stop();
+		return;
+	}
+
+	// Don't leap across the graph after a hitch
+	DeltaTime = FMath::Min(DeltaTime, 0.1f);
+
+	// Accelerate towards the held direction's top speed, or brake to a stop
+	const float Rate = HeldDirection.IsZero() ? Deceleration : Acceleration;
+	Velocity = MoveTowards(Velocity, HeldDirection * MaxSpeed, Rate * DeltaTime);
+
+	// Speed is in panel space, so it feels the same at any zoom
+	const float Zoom = FMath::Max(PanelPtr->GetZoomAmount(), UE_KINDA_SMALL_NUMBER);
+	FVector2D	GraphDelta = Velocity * DeltaTime / Zoom;
+
+	if (!GlideRemaining.IsZero())
+	{
+		// Covers the same share of what's left per second at any frame rate
+		FVector2D Step = GlideRemaining * (1.0 - FMath::Exp(-GlideSharpness * DeltaTime));
+		if ((GlideRemaining - Step).Size() * Zoom < 0.5) // Less than half a pixel
+			Step = GlideRemaining;
+
+		GlideRemaining -= Step;
+		GraphDelta += Step;
+	}
+
+	if (!GraphDelta.IsZero() && !ApplyViewDelta(GraphDelta))
+	{
+		Stop();
+		return;
+	}
+
+	if (HeldDirection.IsZero() && Velocity.IsZero() && GlideRemaining.IsZero())
+		Stop(); // Settled; nothing to tick for until the next move
+}
+
+bool FVimGraphPanController::ApplyViewDelta(const FVector2D& InGraphDelta)
+{
+	const TSharedPtr<SGraphPanel> PanelPtr = Panel.Pin();
+	if (!PanelPtr.IsValid())
+		return false;
+
+	UEdGraph* GraphObj = PanelPtr->GetGraphObj();
+	if (!GraphObj)
+		return false;
+
+	const TSharedPtr<SGraphEditor> GraphEditor = SGraphEditor::FindGraphEditorForGraph(GraphObj);
+	if (!GraphEditor.IsValid())
+		return false;
+
+	FVector2D Location;
+	float	  ZoomAmount;
+	GraphEditor->GetViewLocation(Location, ZoomAmount);
+	GraphEditor->SetViewLocation(Location + InGraphDelta, ZoomAmount);
+	return true;
+}
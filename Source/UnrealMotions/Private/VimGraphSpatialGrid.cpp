@@ -0,0 +1,224 @@
+#include "VimGraphSpatialGrid.h"
+
+void FVimGraphSpatialGrid::Reset()
+{
+	Entries.Reset();
+	IndexByNode.Reset();
+	Cells.Reset();
+	MinCell = MaxCell = FIntPoint(0, 0);
+	ReadingOrder.Reset();
+	bIsReadingOrderDirty = true;
+}
+
+void FVimGraphSpatialGrid::Reserve(const int32 InNum)
+{
+	Entries.Reserve(InNum);
+	IndexByNode.Reserve(InNum);
+}
+
+void FVimGraphSpatialGrid::Update(UEdGraphNode* InNode, const FBox2D& InBounds)
+{
+	if (!InNode)
+		return;
+
+	const FIntPoint Cell = GetCell(InBounds.GetCenter());
+	if (const int32* Index = IndexByNode.Find(InNode))
+	{
+		FEntry& Entry = Entries[*Index];
+		if (Entry.Bounds == InBounds)
+			return; // Didn't move
+
+		if (Entry.Cell != Cell)
+		{
+			RemoveFromCell(Entry.Cell, *Index);
+			AddToCell(Cell, *Index);
+			Entry.Cell = Cell;
+		}
+		Entry.Bounds = InBounds;
+	}
+	else
+	{
+		const int32 NewIndex = Entries.AddDefaulted();
+		FEntry&		Entry = Entries[NewIndex];
+		Entry.Node = InNode;
+		Entry.Bounds = InBounds;
+		Entry.Cell = Cell;
+
+		IndexByNode.Add(InNode, NewIndex);
+		AddToCell(Cell, NewIndex);
+	}
+	bIsReadingOrderDirty = true;
+}
+
+void FVimGraphSpatialGrid::Remove(const UEdGraphNode* InNode)
+{
+	int32 Index;
+	if (!IndexByNode.RemoveAndCopyValue(InNode, Index))
+		return;
+
+	RemoveFromCell(Entries[Index].Cell, Index);
+
+	// Swap the last entry into the hole, re-pointing its cell & lookup at it.
+	const int32 LastIndex = Entries.Num() - 1;
+	if (Index != LastIndex)
+	{
+		const FEntry& LastEntry = Entries[LastIndex];
+		RemoveFromCell(LastEntry.Cell, LastIndex);
+		AddToCell(LastEntry.Cell, Index);
+		IndexByNode.Add(LastEntry.Node, Index);
+	}
+	Entries.RemoveAtSwap(Index);
+	bIsReadingOrderDirty = true;
+}
+
+UEdGraphNode* FVimGraphSpatialGrid::FindNearestInDirection(
+	const UEdGraphNode* FromNode, const FVector2D& Direction) const
+{
+	const int32* FromIndex = IndexByNode.Find(FromNode);
+	if (!FromIndex)
+		return nullptr;
+
+	const FVector2D Origin = Entries[*FromIndex].Bounds.GetCenter();
+	const FIntPoint OriginCell = Entries[*FromIndex].Cell;
+	const FVector2D Side(-Direction.Y, Direction.X);
+
+	int32  BestIndex = INDEX_NONE;
+	double BestScore = TNumericLimits<double>::Max();
+
+	auto ScoreCell = [&](const FIntPoint& InCell) {
+		const TArray<int32>* CellEntries = Cells.Find(InCell);
+		if (!CellEntries)
+			return;
+
+		for (const int32 Index : *CellEntries)
+		{
+			if (Index == *FromIndex)
+				continue;
+
+			const FVector2D Delta = Entries[Index].Bounds.GetCenter() - Origin;
+			const double	Ahead = Delta | Direction;
+			if (Ahead <= KINDA_SMALL_NUMBER)
+				continue; // Beside or behind us
+
+			const double Score = Ahead + 2.0 * FMath::Abs(Delta | Side);
+			if (Score < BestScore && Entries[Index].Node.ResolveObjectPtr())
+			{
+				BestScore = Score;
+				BestIndex = Index;
+			}
+		}
+	};
+
+	// Walk the rings of cells around the origin, skipping those that lie
+	// behind it, until nothing further out can beat the best match.
+	const FIntPoint ToMin = OriginCell - MinCell;
+	const FIntPoint ToMax = MaxCell - OriginCell;
+	const int32		MaxRing = FMath::Max(
+		FMath::Max(ToMin.X, ToMin.Y), FMath::Max(ToMax.X, ToMax.Y));
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// A score is never below the distance, and every node in this ring is
+		// at least (Ring - 1) cells away.
+		if (BestIndex != INDEX_NONE && (Ring - 1) * CellSize > BestScore)
+			break;
+
+		for (int32 Y = -Ring; Y <= Ring; ++Y)
+		{
+			// Only the ring's edges; its inside was covered by previous rings.
+			const bool	bIsEdgeRow = FMath::Abs(Y) == Ring;
+			const int32 Step = bIsEdgeRow ? 1 : FMath::Max(2 * Ring, 1);
+			for (int32 X = -Ring; X <= Ring; X += Step)
+			{
+				if ((FVector2D(X, Y) | Direction) < 0.0)
+					continue; // The entire cell is behind the origin
+
+				ScoreCell(OriginCell + FIntPoint(X, Y));
+			}
+		}
+	}
+
+	return BestIndex != INDEX_NONE ? Entries[BestIndex].Node.ResolveObjectPtr() : nullptr;
+}
+
+UEdGraphNode* FVimGraphSpatialGrid::FindInReadingOrder(
+	const UEdGraphNode* FromNode, const int32 Offset)
+{
+	const int32* FromIndex = IndexByNode.Find(FromNode);
+	if (!FromIndex)
+		return nullptr;
+
+	if (bIsReadingOrderDirty)
+		SortReadingOrder();
+
+	const int32 Rank = Entries[*FromIndex].Rank;
+	const int32 Step = Offset >= 0 ? 1 : -1;
+	int32		Remaining = FMath::Abs(Offset);
+
+	// Step over (not yet pruned) destroyed nodes without counting them.
+	UEdGraphNode* Found = nullptr;
+	for (int32 i = Rank + Step; Remaining > 0 && ReadingOrder.IsValidIndex(i); i += Step)
+	{
+		if (UEdGraphNode* Node = Entries[ReadingOrder[i]].Node.ResolveObjectPtr())
+		{
+			Found = Node;
+			--Remaining;
+		}
+	}
+	return Found;
+}
+
+FIntPoint FVimGraphSpatialGrid::GetCell(const FVector2D& InPoint) const
+{
+	return FIntPoint(
+		FMath::FloorToInt(InPoint.X / CellSize),
+		FMath::FloorToInt(InPoint.Y / CellSize));
+}
+
+void FVimGraphSpatialGrid::AddToCell(const FIntPoint& InCell, const int32 EntryIndex)
+{
+	if (Cells.IsEmpty())
+		MinCell = MaxCell = InCell;
+	else
+	{
+		MinCell = MinCell.ComponentMin(InCell);
+		MaxCell = MaxCell.ComponentMax(InCell);
+	}
+	Cells.FindOrAdd(InCell).Add(EntryIndex);
+}
+
+void FVimGraphSpatialGrid::RemoveFromCell(const FIntPoint& InCell, const int32 EntryIndex)
+{
+	TArray<int32>* CellEntries = Cells.Find(InCell);
+	if (!CellEntries)
+		return;
+
+	CellEntries->RemoveSingleSwap(EntryIndex);
+	if (CellEntries->IsEmpty())
+		Cells.Remove(InCell);
+}
+
+void FVimGraphSpatialGrid::SortReadingOrder()
+{
+	ReadingOrder.SetNumUninitialized(Entries.Num());
+	for (int32 i = 0; i < Entries.Num(); ++i)
+		ReadingOrder[i] = i;
+
+	ReadingOrder.Sort([this](const int32 A, const int32 B) {
+		const FVector2D& TopLeftA = Entries[A].Bounds.Min;
+		const FVector2D& TopLeftB = Entries[B].Bounds.Min;
+
+		const int32 RowA = FMath::FloorToInt(TopLeftA.Y / ReadingRowBand);
+		const int32 RowB = FMath::FloorToInt(TopLeftB.Y / ReadingRowBand);
+		if (RowA != RowB)
+			return RowA < RowB;
+		if (TopLeftA.X != TopLeftB.X)
+			return TopLeftA.X < TopLeftB.X;
+		return TopLeftA.Y < TopLeftB.Y;
+	});
+
+	for (int32 i = 0; i < ReadingOrder.Num(); ++i)
+		Entries[ReadingOrder[i]].Rank = i;
+
+	bIsReadingOrderDirty = false;
+}
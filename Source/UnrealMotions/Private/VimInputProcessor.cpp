@@ -10,6 +10,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogUMInputPreProcessor, Log, All); // Dev
 EVimMode FVimInputProcessor::VimMode{ EVimMode::Insert };
 
 bool FVimInputProcessor::bNativeInputHandling{ false };
+uint32 FVimInputProcessor::SimulatedKeyPressCount{ 0 };
 
 FVimInputProcessor::FVimInputProcessor()
 {
@@ -161,23 +162,24 @@ bool FVimInputProcessor::ProcessKeySequence(
 		&& MatchedNode->CallbackType != EUMKeyBindingCallbackType::None)
 	{
 		const int32 CountPrefix = GetCountBuffer();
+		bIsCountPrefixConsumed = false;
 		switch (MatchedNode->CallbackType)
 		{
 			case EUMKeyBindingCallbackType::NoParam:
 				if (MatchedNode->NoParamCallback)
-					for (int32 i{ 0 }; i < CountPrefix; ++i)
+					for (int32 i{ 0 }; i < CountPrefix && !bIsCountPrefixConsumed; ++i)
 						MatchedNode->NoParamCallback();
 				break;
 
 			case EUMKeyBindingCallbackType::KeyEventParam:
 				if (MatchedNode->KeyEventCallback)
-					for (int32 i{ 0 }; i < CountPrefix; ++i)
+					for (int32 i{ 0 }; i < CountPrefix && !bIsCountPrefixConsumed; ++i)
 						MatchedNode->KeyEventCallback(SlateApp, InKeyEvent);
 				break;
 
 			case EUMKeyBindingCallbackType::SequenceParam:
 				if (MatchedNode->SequenceCallback)
-					for (int32 i{ 0 }; i < CountPrefix; ++i)
+					for (int32 i{ 0 }; i < CountPrefix && !bIsCountPrefixConsumed; ++i)
 						MatchedNode->SequenceCallback(SlateApp, CurrentSequence);
 				break;
 
@@ -328,6 +330,12 @@ bool FVimInputProcessor::HandleKeyDownEvent(
 	if (IsSimulateEscapeKey(SlateApp, InKeyEvent))
 		return true;
 
+	// A key that isn't continuing anything (a sequence, a count, a possessed
+	// command or Insert mode typing) starts a new command.
+	if (VimMode != EVimMode::Insert && CurrentSequence.IsEmpty()
+		&& CountBuffer.IsEmpty() && !Delegate_OnKeyDown.IsBound())
+		OnCommandBoundary.Broadcast();
+
 	// In case any outside class is currently possessing our Vim Processor to
 	// handle input manually (e.g. Vimium implementation in the Vim Navigation
 	// Subsystem); We'll return true and broadcast the InKeyEvent to them for
@@ -582,6 +590,7 @@ void FVimInputProcessor::SimulateKeyPress(
 		ModifierKeys,
 		0 /*UserIndex*/, false /*bIsRepeat*/, 0, 0);
 
+	++SimulatedKeyPressCount;
 	bNativeInputHandling = bSetNativeInputHandling;
 	SlateApp.ProcessKeyDownEvent(SimulatedEvent);
 	SlateApp.ProcessKeyUpEvent(SimulatedEvent);
@@ -630,6 +639,13 @@ void FVimInputProcessor::UpdateBufferAndVisualizer(const FKey& InKey)
 	}
 }
 
+void FVimInputProcessor::ShowInBufferVisualizer(FSlateApplication& SlateApp, const FString& InText)
+{
+	CheckCreateBufferVisualizer(SlateApp, EKeys::Invalid);
+	if (const TSharedPtr<SUMBufferVisualizer> PinBufVis = BufferVisualizer.Pin())
+		PinBufVis->UpdateBuffer(InText);
+}
+
 void FVimInputProcessor::Unpossess(UObject* InObject)
 {
 	if (PossessedObjects.Contains(InObject))
@@ -654,6 +670,12 @@ int32 FVimInputProcessor::GetCountBuffer()
 	return MIN_REPEAT_COUNT;
 }
 
+int32 FVimInputProcessor::ConsumeCountPrefix()
+{
+	bIsCountPrefixConsumed = true;
+	return GetCountBuffer();
+}
+
 void FVimInputProcessor::DebugInvalidWeakPtr(EUMKeyBindingCallbackType CallbackType)
 {
 	FString Log = "Invalid";
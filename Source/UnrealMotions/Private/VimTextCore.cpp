@@ -0,0 +1,1208 @@
+#include "VimTextCore.h"
+
+//------------------------------------------------------------------------------
+// Char Classification
+//------------------------------------------------------------------------------
+
+namespace
+{
+	/** A range of code points that aren't word chars. */
+	struct FCharClassRange
+	{
+		uint32_t	First;
+		uint32_t	Last; // Inclusive
+		EUMCharType Type;
+	};
+
+	// Past Latin-1, sorted. Whitespace is Unicode's White_Space set, as
+	// FChar::IsWhitespace treats it; the rest are the punctuation & symbol
+	// blocks (as Vim classes them). Whatever isn't listed is a word char:
+	// letters, digits & ideographs of any script, independent of the locale.
+	constexpr FCharClassRange NonWordRanges[] = {
+		{ 0x037E, 0x037E, EUMCharType::Symbol },	 // Greek question mark
+		{ 0x0387, 0x0387, EUMCharType::Symbol },	 // Greek ano teleia
+		{ 0x055A, 0x055F, EUMCharType::Symbol },	 // Armenian punctuation
+		{ 0x0589, 0x058A, EUMCharType::Symbol },	 // Armenian full stop & hyphen
+		{ 0x05BE, 0x05BE, EUMCharType::Symbol },	 // Hebrew punctuation
+		{ 0x05C0, 0x05C0, EUMCharType::Symbol },
+		{ 0x05C3, 0x05C3, EUMCharType::Symbol },
+		{ 0x05F3, 0x05F4, EUMCharType::Symbol },
+		{ 0x060C, 0x060D, EUMCharType::Symbol },	 // Arabic punctuation
+		{ 0x061B, 0x061B, EUMCharType::Symbol },
+		{ 0x061F, 0x061F, EUMCharType::Symbol },
+		{ 0x066A, 0x066D, EUMCharType::Symbol },
+		{ 0x06D4, 0x06D4, EUMCharType::Symbol },
+		{ 0x0700, 0x070D, EUMCharType::Symbol },	 // Syriac punctuation
+		{ 0x0964, 0x0965, EUMCharType::Symbol },	 // Devanagari dandas
+		{ 0x0970, 0x0970, EUMCharType::Symbol },
+		{ 0x0DF4, 0x0DF4, EUMCharType::Symbol },
+		{ 0x0E4F, 0x0E4F, EUMCharType::Symbol },	 // Thai punctuation
+		{ 0x0E5A, 0x0E5B, EUMCharType::Symbol },
+		{ 0x0F04, 0x0F12, EUMCharType::Symbol },	 // Tibetan punctuation
+		{ 0x0F3A, 0x0F3D, EUMCharType::Symbol },
+		{ 0x0F85, 0x0F85, EUMCharType::Symbol },
+		{ 0x104A, 0x104F, EUMCharType::Symbol },	 // Myanmar punctuation
+		{ 0x10FB, 0x10FB, EUMCharType::Symbol },	 // Georgian punctuation
+		{ 0x1361, 0x1368, EUMCharType::Symbol },	 // Ethiopic punctuation
+		{ 0x166D, 0x166E, EUMCharType::Symbol },	 // Canadian syllabics punctuation
+		{ 0x1680, 0x1680, EUMCharType::Whitespace }, // Ogham space mark
+		{ 0x169B, 0x169C, EUMCharType::Symbol },
+		{ 0x16EB, 0x16ED, EUMCharType::Symbol },	 // Runic punctuation
+		{ 0x1735, 0x1736, EUMCharType::Symbol },
+		{ 0x17D4, 0x17DC, EUMCharType::Symbol },	 // Khmer punctuation
+		{ 0x1800, 0x180A, EUMCharType::Symbol },	 // Mongolian punctuation
+		{ 0x2000, 0x200A, EUMCharType::Whitespace }, // En quad .. hair space
+		{ 0x200B, 0x2027, EUMCharType::Symbol },	 // General punctuation
+		{ 0x2028, 0x2029, EUMCharType::Whitespace }, // Line & paragraph separators
+		{ 0x202A, 0x202E, EUMCharType::Symbol },
+		{ 0x202F, 0x202F, EUMCharType::Whitespace }, // Narrow no-break space
+		{ 0x2030, 0x205E, EUMCharType::Symbol },
+		{ 0x205F, 0x205F, EUMCharType::Whitespace }, // Medium math space
+		{ 0x2060, 0x206F, EUMCharType::Symbol },
+		{ 0x20A0, 0x20CF, EUMCharType::Symbol },	 // Currency symbols
+		{ 0x2190, 0x23FF, EUMCharType::Symbol },	 // Arrows, math operators & technical
+		{ 0x2500, 0x27FF, EUMCharType::Symbol },	 // Box drawing .. dingbats & arrows
+		{ 0x2900, 0x2BFF, EUMCharType::Symbol },	 // Arrows, math & misc symbols
+		{ 0x2E00, 0x2E7F, EUMCharType::Symbol },	 // Supplemental punctuation
+		{ 0x3000, 0x3000, EUMCharType::Whitespace }, // Ideographic space
+		{ 0x3001, 0x3020, EUMCharType::Symbol },	 // CJK punctuation
+		{ 0x3030, 0x3030, EUMCharType::Symbol },
+		{ 0x303D, 0x303D, EUMCharType::Symbol },
+		{ 0xFD3E, 0xFD3F, EUMCharType::Symbol },	 // Ornate parentheses
+		{ 0xFE30, 0xFE6B, EUMCharType::Symbol },	 // CJK compatibility & small forms
+		{ 0xFF00, 0xFF0F, EUMCharType::Symbol },	 // Fullwidth ASCII punctuation
+		{ 0xFF1A, 0xFF20, EUMCharType::Symbol },
+		{ 0xFF3B, 0xFF40, EUMCharType::Symbol },
+		{ 0xFF5B, 0xFF65, EUMCharType::Symbol },
+		{ 0x1D000, 0x1D24F, EUMCharType::Symbol }, // Musical notation
+		{ 0x1F000, 0x1FAFF, EUMCharType::Symbol }, // Game pieces, emoji & pictographs
+	};
+} // namespace
+
+template <typename CharType>
+EUMCharType TVimTextCore<CharType>::ClassifyCharSlow(const uint32_t Code)
+{
+	// Binary search for the last range starting at or before the code
+	int32_t Low = 0;
+	int32_t High = static_cast<int32_t>(sizeof(NonWordRanges) / sizeof(NonWordRanges[0])) - 1;
+	while (Low <= High)
+	{
+		const int32_t		   Mid = (Low + High) / 2;
+		const FCharClassRange& Range = NonWordRanges[Mid];
+		if (Code < Range.First)
+			High = Mid - 1;
+		else if (Code > Range.Last)
+			Low = Mid + 1;
+		else
+			return Range.Type;
+	}
+	return EUMCharType::Word;
+}
+
+template <typename CharType>
+EUMCharType TVimTextCore<CharType>::GetCharType(const FView Text, int32_t Position)
+{
+	if (Position < 0 || Position >= Text.Len)
+		return EUMCharType::Whitespace; // Default for out-of-bounds
+
+	return ClassifyChar(Text[Position]);
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::ScanCharRun(const FView Text, int32_t StartPos,
+	int32_t Direction, EUMCharType Type, bool bNegate)
+{
+	const CharType* Data = Text.Data;
+	const int32_t	Len = Text.Len;
+
+	// Lanes of a block are classified independently & folded without
+	// branching, so the lookups pipeline (and may vectorize). Only the block
+	// holding the end of the run is then walked char by char.
+	constexpr int32_t BlockSize = 8;
+
+	const auto IsInRun = [Type, bNegate](const CharType Char) {
+		return (ClassifyChar(Char) == Type) != bNegate;
+	};
+
+	if (Direction > 0)
+	{
+		int32_t Pos = StartPos > 0 ? StartPos : 0;
+		while (Pos + BlockSize <= Len)
+		{
+			bool bIsBlockInRun = true;
+			for (int32_t i = 0; i < BlockSize; ++i)
+				bIsBlockInRun &= IsInRun(Data[Pos + i]);
+
+			if (!bIsBlockInRun)
+				break;
+			Pos += BlockSize;
+		}
+		while (Pos < Len && IsInRun(Data[Pos]))
+			++Pos;
+
+		return Pos;
+	}
+
+	int32_t Pos = StartPos < Len ? StartPos : Len;
+	while (Pos >= BlockSize)
+	{
+		bool bIsBlockInRun = true;
+		for (int32_t i = 1; i <= BlockSize; ++i)
+			bIsBlockInRun &= IsInRun(Data[Pos - i]);
+
+		if (!bIsBlockInRun)
+			break;
+		Pos -= BlockSize;
+	}
+	while (Pos > 0 && IsInRun(Data[Pos - 1]))
+		--Pos;
+
+	return Pos;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::SkipCharType(const FView Text, int32_t StartPos, int32_t Direction, EUMCharType TypeToSkip)
+{
+	return ScanCharRun(Text, StartPos, Direction, TypeToSkip);
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::SkipNonWhitespace(const FView Text, int32_t StartPos, int32_t Direction)
+{
+	return ScanCharRun(Text, StartPos, Direction,
+		EUMCharType::Whitespace, true /*Negate*/);
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::SkipWhitespace(const FView Text, int32_t StartPos, int32_t Direction)
+{
+	return SkipCharType(Text, StartPos, Direction, EUMCharType::Whitespace);
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindNextWordBoundary(const FView Text, int32_t CurrentPos, bool bBigWord)
+{
+	if (bBigWord)
+		return FindNextBigWordBoundary(Text, CurrentPos);
+	else
+		return FindNextSmallWordBoundary(Text, CurrentPos);
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindPreviousWordBoundary(const FView Text, int32_t CurrentPos, bool bBigWord)
+{
+	if (bBigWord)
+		return FindPreviousBigWordBoundary(Text, CurrentPos);
+	else
+		return FindPreviousSmallWordBoundary(Text, CurrentPos);
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindNextBigWordBoundary(const FView Text, int32_t CurrentPos)
+{
+	const int32_t Len = Text.Len;
+
+	// Handle boundary cases
+	if (CurrentPos >= Len - 1)
+		return Len;
+
+	int32_t NewPos = CurrentPos + 1; // Always make progress
+
+	// For big words, only care about whitespace vs. non-whitespace
+	bool bCurrentIsWhitespace = (CurrentPos < Len)
+		&& IsWhitespaceChar(Text[CurrentPos]);
+
+	if (bCurrentIsWhitespace)
+	{
+		// Skip all consecutive whitespace
+		NewPos = SkipWhitespace(Text, NewPos, 1);
+	}
+	else
+	{
+		// Skip all consecutive non-whitespace, then any whitespace that follows
+		NewPos = SkipNonWhitespace(Text, NewPos, 1);
+		NewPos = SkipWhitespace(Text, NewPos, 1);
+	}
+
+	return NewPos;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindPreviousBigWordBoundary(const FView Text, int32_t CurrentPos)
+{
+	// Handle boundary cases
+	if (CurrentPos <= 0)
+		return 0;
+
+	int32_t NewPos = CurrentPos;
+
+	// Skip any whitespace backwards
+	NewPos = SkipWhitespace(Text, NewPos, -1);
+
+	// If we're now on a non-whitespace character, find the start of this word
+	if (NewPos > 0 && !IsWhitespaceChar(Text[NewPos - 1]))
+	{
+		NewPos = SkipNonWhitespace(Text, NewPos, -1);
+	}
+
+	return NewPos;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindNextSmallWordBoundary(const FView Text, int32_t CurrentPos)
+{
+	const int32_t Len = Text.Len;
+
+	// Handle boundary cases
+	if (CurrentPos >= Len - 1)
+		return Len;
+
+	int32_t NewPos = CurrentPos + 1; // Always make progress
+
+	// Determine current character type
+	EUMCharType CurrentType = GetCharType(Text, CurrentPos);
+	EUMCharType NextType = GetCharType(Text, NewPos);
+
+	// If transitioning to a different type, that's a word boundary
+	if (CurrentType != NextType)
+	{
+		// If moving to whitespace, skip all consecutive whitespace
+		if (NextType == EUMCharType::Whitespace)
+		{
+			NewPos = SkipWhitespace(Text, NewPos, 1);
+		}
+	}
+	else
+	{
+		// Still in same type, skip all characters of this type
+		NewPos = SkipCharType(Text, NewPos, 1, CurrentType);
+
+		// Skip any trailing whitespace
+		NewPos = SkipWhitespace(Text, NewPos, 1);
+	}
+
+	return NewPos;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindPreviousSmallWordBoundary(const FView Text, int32_t CurrentPos)
+{
+	// Handle boundary cases
+	if (CurrentPos <= 0)
+		return 0;
+
+	int32_t NewPos = CurrentPos;
+
+	// Skip any trailing whitespace
+	NewPos = SkipWhitespace(Text, NewPos, -1);
+
+	// If we reached the beginning after skipping whitespace, return 0
+	if (NewPos == 0)
+		return 0;
+
+	// Determine the type of character we're on now
+	EUMCharType CurrentType = GetCharType(Text, NewPos - 1);
+
+	// Find the beginning of this character group
+	NewPos = SkipCharType(Text, NewPos, -1, CurrentType);
+
+	return NewPos;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindNextWordEnd(const FView Text, int32_t CurrentPos, bool bBigWord)
+{
+	if (bBigWord)
+		return FindNextBigWordEnd(Text, CurrentPos);
+	else
+		return FindNextSmallWordEnd(Text, CurrentPos);
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindPreviousWordEnd(const FView Text, int32_t CurrentPos, bool bBigWord)
+{
+	if (bBigWord)
+		return FindPreviousBigWordEnd(Text, CurrentPos);
+	else
+		return FindPreviousSmallWordEnd(Text, CurrentPos);
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindNextBigWordEnd(const FView Text, int32_t CurrentPos)
+{
+	const int32_t Len = Text.Len;
+
+	// Handle boundary cases
+	if (CurrentPos >= Len - 1)
+		return Len - 1;
+
+	int32_t NewPos = CurrentPos + 1; // Always make progress from current position
+
+	// Skip any whitespace ahead
+	NewPos = SkipWhitespace(Text, NewPos, 1);
+
+	// If we're not at the end of the text
+	if (NewPos < Len)
+	{
+		// Find the end of the next non-whitespace chunk
+		const int32_t EndPos = SkipNonWhitespace(Text, NewPos, 1);
+
+		// If we found a non-whitespace chunk, position at its last character
+		if (EndPos > NewPos)
+			NewPos = EndPos - 1;
+	}
+	else
+	{
+		// If we're at the end, back up to the last non-whitespace character
+		NewPos = Len - 1;
+		while (NewPos > CurrentPos && IsWhitespaceChar(Text[NewPos]))
+			NewPos--;
+	}
+
+	return NewPos;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindPreviousBigWordEnd(const FView Text, int32_t CurrentPos)
+{
+	// Handle boundary cases
+	if (CurrentPos <= 0)
+		return 0;
+
+	int32_t NewPos = CurrentPos;
+
+	// Skip whitespace backward if we're currently in whitespace
+	if (NewPos < Text.Len && IsWhitespaceChar(Text[NewPos]))
+		NewPos = SkipWhitespace(Text, NewPos, -1);
+
+	// If we're at a non-whitespace character, we need to find the previous word
+	if (NewPos > 0)
+	{
+		// First go back to the beginning of the current word (if we're in a word)
+		if (NewPos < Text.Len && !IsWhitespaceChar(Text[NewPos]))
+		{
+			// If we're in a word, move to its beginning
+			int32_t WordBegin = SkipNonWhitespace(Text, NewPos, -1);
+
+			// If we're already at the beginning of a word, we need to find the previous word
+			if (WordBegin == NewPos)
+			{
+				// Skip any whitespace backwards
+				NewPos = SkipWhitespace(Text, WordBegin, -1);
+
+				// Find the beginning of the previous word
+				if (NewPos > 0)
+				{
+					int32_t PrevWordBegin = SkipNonWhitespace(Text, NewPos, -1);
+
+					// Now find the end of that word
+					NewPos = PrevWordBegin;
+					while (NewPos < Text.Len - 1 && !IsWhitespaceChar(Text[NewPos + 1]))
+						NewPos++;
+				}
+			}
+			else
+			{
+				// If we moved to the beginning, go back to find the previous word
+				NewPos = SkipWhitespace(Text, WordBegin, -1);
+
+				// Find the beginning of the previous word
+				if (NewPos > 0)
+				{
+					int32_t PrevWordBegin = SkipNonWhitespace(Text, NewPos, -1);
+
+					// Now find the end of that word
+					NewPos = PrevWordBegin;
+					while (NewPos < Text.Len - 1 && !IsWhitespaceChar(Text[NewPos + 1]))
+						NewPos++;
+				}
+			}
+		}
+		else
+		{
+			// We're on whitespace or at end of string, find the previous non-whitespace character
+			NewPos = SkipWhitespace(Text, NewPos, -1);
+
+			// If we found non-whitespace, find the beginning of that word
+			if (NewPos > 0)
+			{
+				int32_t WordBegin = SkipNonWhitespace(Text, NewPos, -1);
+
+				// Position at the end of this word
+				NewPos = WordBegin;
+				while (NewPos < Text.Len - 1 && !IsWhitespaceChar(Text[NewPos + 1]))
+					NewPos++;
+			}
+		}
+	}
+
+	return NewPos;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindNextSmallWordEnd(const FView Text, int32_t CurrentPos)
+{
+	const int32_t Len = Text.Len;
+
+	// Handle boundary cases
+	if (CurrentPos >= Len - 1)
+		return Len - 1;
+
+	int32_t NewPos = CurrentPos + 1; // Always make progress from current position
+
+	// Skip any whitespace ahead
+	NewPos = SkipWhitespace(Text, NewPos, 1);
+
+	// If we're not at the end of the text
+	if (NewPos < Len)
+	{
+		// Get the type of the character at our new position
+		EUMCharType CurrentType = GetCharType(Text, NewPos);
+
+		// Find the last character of this type
+		int32_t EndPos = NewPos;
+		while (EndPos < Len - 1 && GetCharType(Text, EndPos + 1) == CurrentType)
+			EndPos++;
+
+		NewPos = EndPos;
+	}
+	else
+	{
+		// If we're at the end, back up to the last non-whitespace character
+		NewPos = Len - 1;
+		while (NewPos > CurrentPos && IsWhitespaceChar(Text[NewPos]))
+			NewPos--;
+	}
+
+	return NewPos;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::FindPreviousSmallWordEnd(const FView Text, int32_t CurrentPos)
+{
+	if (CurrentPos <= 0)
+		return 0;
+
+	int32_t Pos = CurrentPos;
+
+	// If the cursor is within the text and is on whitespace,
+	// or if we're at the very end, back up over any trailing whitespace.
+	if ((Pos < Text.Len && IsWhitespaceChar(Text[Pos])) || Pos == Text.Len)
+	{
+		Pos = SkipWhitespace(Text, Pos, -1);
+		if (Pos <= 0)
+			return 0;
+		return Pos - 1;
+	}
+
+	// Determine the start of the "current" word.
+	// If the character immediately left of the cursor is whitespace,
+	// then we are already at a word boundary.
+	int32_t CurrentWordStart;
+	if (Pos > 0 && IsWhitespaceChar(Text[Pos - 1]))
+	{
+		CurrentWordStart = Pos;
+	}
+	else
+	{
+		// We're in the middle or at the end of a word.
+		// Get the type of the character immediately left of pos.
+		EUMCharType LeftCharType = GetCharType(Text, Pos - 1);
+
+		// Get the type of the current char we're at, if it doesn't match the
+		// type to the left, that's a word boundary.
+		EUMCharType CurrCharType = GetCharType(Text, Pos);
+		if (LeftCharType != CurrCharType)
+			return Pos - 1;
+
+		// Move backward over characters of this same type.
+		CurrentWordStart = SkipCharType(Text, Pos, -1, LeftCharType);
+	}
+
+	// Now skip backwards over any whitespace preceding the current word.
+	int32_t PrevBoundary = SkipWhitespace(Text, CurrentWordStart, -1);
+	if (PrevBoundary <= 0)
+		return 0;
+
+	// The previous word is the one whose last character is just before PrevBoundary.
+	// Get that word's type.
+	EUMCharType PrevType = GetCharType(Text, PrevBoundary - 1);
+	// Find the beginning of the previous word group.
+	int32_t PrevWordStart = SkipCharType(Text, PrevBoundary, -1, PrevType);
+
+	// Scan forward from PrevWordStart until the character type changes to get its end.
+	int32_t PrevWordEnd = PrevWordStart;
+	while (PrevWordEnd < Text.Len && GetCharType(Text, PrevWordEnd) == PrevType)
+	{
+		PrevWordEnd++;
+	}
+
+	// Return the index of the last character of the previous word.
+	return PrevWordEnd - 1;
+}
+
+template <typename CharType>
+bool TVimTextCore<CharType>::GetAbsWordBoundaries(const FView Text, int32_t CurrentPos, int32_t& OutStart, int32_t& OutEnd)
+{
+	const int32_t TextLen = Text.Len;
+	if (CurrentPos <= 0 || CurrentPos >= TextLen || TextLen <= 0)
+		return false;
+
+	int32_t Pos = CurrentPos;
+
+	// if currently on whitespace, the boundaries are until the next and previous
+	// non-space characters
+	const EUMCharType PosType = ClassifyChar(Text[Pos]);
+	if (PosType == EUMCharType::Whitespace)
+	{
+		OutStart = SkipWhitespace(Text, Pos, -1);
+		OutEnd = SkipWhitespace(Text, Pos, 1);
+		return true;
+	}
+	else if (PosType == EUMCharType::Word)
+	{
+		OutStart = SkipCharType(Text, Pos, -1, EUMCharType::Word);
+		OutEnd = SkipCharType(Text, Pos, 1, EUMCharType::Word);
+		return true;
+	}
+	else // Symbol
+	{
+		OutStart = SkipCharType(Text, Pos, -1, EUMCharType::Symbol);
+		OutEnd = SkipCharType(Text, Pos, 1, EUMCharType::Symbol);
+		return true;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Text Objects
+//------------------------------------------------------------------------------
+
+template <typename CharType>
+bool TVimTextCore<CharType>::GetTextObject(const FView Text, const int32_t Pos,
+	const EUMTextObjectType Type, const bool bAround, const CharType Delimiter,
+	int32_t& OutStart, int32_t& OutEnd)
+{
+	switch (Type)
+	{
+		case EUMTextObjectType::Word:
+			return GetWordObject(Text, Pos, false, bAround, OutStart, OutEnd);
+
+		case EUMTextObjectType::BigWord:
+			return GetWordObject(Text, Pos, true, bAround, OutStart, OutEnd);
+
+		case EUMTextObjectType::Quote:
+			return GetQuoteObject(Text, Pos, Delimiter, bAround, OutStart, OutEnd);
+
+		case EUMTextObjectType::Bracket:
+		{
+			CharType Open, Close;
+			return GetBracketPair(Delimiter, Open, Close)
+				&& GetBracketObject(Text, Pos, Open, Close, bAround, OutStart, OutEnd);
+		}
+		case EUMTextObjectType::Paragraph:
+			return GetParagraphObject(Text, Pos, bAround, OutStart, OutEnd);
+	}
+	return false;
+}
+
+template <typename CharType>
+bool TVimTextCore<CharType>::GetWordObject(const FView Text, const int32_t Pos,
+	const bool bBigWord, const bool bAround, int32_t& OutStart, int32_t& OutEnd)
+{
+	if (Pos < 0 || Pos >= Text.Len)
+		return false;
+
+	if (Text[Pos] == '\n') // Line end or empty line: just the line break
+	{
+		OutStart = Pos;
+		OutEnd = Pos + 1;
+		return true;
+	}
+
+	// Runs are scanned within the line: blanks stop at the line break.
+	const auto ScanWordRun = [&Text, bBigWord](const int32_t From, const int32_t Direction) {
+		const EUMCharType Type = ClassifyChar(Text[From]);
+		if (bBigWord)
+			return ScanCharRun(Text, From, Direction, EUMCharType::Whitespace, true /*Negate*/);
+		return ScanCharRun(Text, From, Direction, Type);
+	};
+
+	if (IsBlankChar(Text[Pos]))
+	{
+		OutStart = SkipBlanks(Text, Pos, -1);
+		OutEnd = SkipBlanks(Text, Pos, 1);
+
+		// "aw" on blanks takes the following word as well
+		if (bAround && OutEnd < Text.Len && !IsWhitespaceChar(Text[OutEnd]))
+			OutEnd = ScanWordRun(OutEnd, 1);
+		return true;
+	}
+
+	OutStart = ScanWordRun(Pos, -1);
+	OutEnd = ScanWordRun(Pos, 1);
+
+	if (bAround)
+		ExtendOverBlanks(Text, OutStart, OutEnd);
+	return true;
+}
+
+template <typename CharType>
+bool TVimTextCore<CharType>::GetQuoteObject(const FView Text, const int32_t Pos,
+	const CharType Quote, const bool bAround, int32_t& OutStart, int32_t& OutEnd)
+{
+	if (Pos < 0 || Pos >= Text.Len)
+		return false;
+
+	const int32_t LineStart = GetLineStart(Text, Pos);
+	const int32_t LineEnd = GetLineEnd(Text, Pos);
+
+	// Pair the quotes up from the line's start, picking the first pair that
+	// ends at or after the position: the one it's on or in, else the next one.
+	int32_t OpenPos = -1;
+	for (int32_t i = LineStart; i < LineEnd; ++i)
+	{
+		if (Text[i] != Quote || (i > LineStart && Text[i - 1] == '\\'))
+			continue;
+
+		if (OpenPos < 0)
+		{
+			OpenPos = i;
+			continue;
+		}
+
+		if (Pos <= i)
+		{
+			if (bAround)
+			{
+				OutStart = OpenPos;
+				OutEnd = i + 1;
+				ExtendOverBlanks(Text, OutStart, OutEnd);
+			}
+			else
+			{
+				OutStart = OpenPos + 1;
+				OutEnd = i;
+			}
+			return true;
+		}
+		OpenPos = -1;
+	}
+	return false;
+}
+
+template <typename CharType>
+bool TVimTextCore<CharType>::GetBracketObject(const FView Text, const int32_t Pos,
+	const CharType Open, const CharType Close, const bool bAround,
+	int32_t& OutStart, int32_t& OutEnd, const int32_t MaxScan)
+{
+	int32_t OpenPos, ClosePos;
+	if (!FindEnclosingBrackets(Text, Pos, Open, Close, MaxScan, OpenPos, ClosePos))
+		return false;
+
+	if (bAround)
+	{
+		OutStart = OpenPos;
+		OutEnd = ClosePos + 1;
+		return true;
+	}
+
+	OutStart = OpenPos + 1;
+	OutEnd = ClosePos;
+
+	// Like Vim, a block spanning lines keeps its brackets' lines intact:
+	// skip the line break after the opening bracket & the closing one's indent.
+	if (OutStart < OutEnd && Text[OutStart] == '\n')
+	{
+		++OutStart;
+		const int32_t CloseLineStart = GetLineStart(Text, OutEnd);
+		if (CloseLineStart > OutStart && SkipBlanks(Text, CloseLineStart, 1) == OutEnd)
+			OutEnd = CloseLineStart;
+	}
+	return true;
+}
+
+template <typename CharType>
+bool TVimTextCore<CharType>::GetParagraphObject(const FView Text, const int32_t Pos,
+	const bool bAround, int32_t& OutStart, int32_t& OutEnd)
+{
+	if (Text.Len <= 0 || Pos < 0 || Pos > Text.Len)
+		return false;
+
+	const int32_t FirstLine = GetLineStart(Text, Pos < Text.Len ? Pos : Text.Len - 1);
+	const bool	  bIsBlank = IsBlankLine(Text, FirstLine);
+
+	// Walks whole lines of the same blankness, returning the run's bounds.
+	const auto ScanLinesUp = [&Text](int32_t LineStart, const bool bBlank) {
+		while (LineStart > 0)
+		{
+			const int32_t PrevLine = GetLineStart(Text, LineStart - 1);
+			if (IsBlankLine(Text, PrevLine) != bBlank)
+				break;
+			LineStart = PrevLine;
+		}
+		return LineStart;
+	};
+	const auto ScanLinesDown = [&Text](int32_t LineStart, const bool bBlank) {
+		while (LineStart < Text.Len && IsBlankLine(Text, LineStart) == bBlank)
+		{
+			const int32_t LineEnd = GetLineEnd(Text, LineStart);
+			LineStart = LineEnd < Text.Len ? LineEnd + 1 : Text.Len;
+		}
+		return LineStart; // Past the run's last line break
+	};
+
+	OutStart = ScanLinesUp(FirstLine, bIsBlank);
+	OutEnd = ScanLinesDown(FirstLine, bIsBlank);
+
+	if (bAround)
+	{
+		// "ap" takes in the blank lines after the paragraph (or those before it
+		// if there are none); on blank lines, the paragraph that follows.
+		const int32_t AroundEnd = ScanLinesDown(OutEnd, !bIsBlank);
+		if (AroundEnd > OutEnd || bIsBlank)
+			OutEnd = AroundEnd;
+		else if (OutStart > 0)
+			OutStart = ScanLinesUp(GetLineStart(Text, OutStart - 1), true);
+	}
+	return OutEnd > OutStart;
+}
+
+template <typename CharType>
+bool TVimTextCore<CharType>::FindEnclosingBrackets(const FView Text, const int32_t Pos,
+	const CharType Open, const CharType Close, const int32_t MaxScan,
+	int32_t& OutOpenPos, int32_t& OutClosePos)
+{
+	if (Pos < 0 || Pos >= Text.Len)
+		return false;
+
+	// On a closing bracket, scanning back from the char before it finds its
+	// own opening bracket (the pairs nested in between balance out).
+	OutOpenPos = Text[Pos] == Open
+		? Pos
+		: ScanForBracket(Text, Pos - 1, -1, Open, Close, MaxScan);
+	if (OutOpenPos < 0)
+		return false;
+
+	OutClosePos = ScanForBracket(Text, OutOpenPos + 1, 1, Close, Open, MaxScan);
+	return OutClosePos >= 0;
+}
+
+template <typename CharType>
+bool TVimTextCore<CharType>::GetBracketPair(const CharType Bracket, CharType& OutOpen, CharType& OutClose)
+{
+	switch (Bracket)
+	{
+		case '(':
+		case ')':
+			OutOpen = '(';
+			OutClose = ')';
+			return true;
+
+		case '{':
+		case '}':
+			OutOpen = '{';
+			OutClose = '}';
+			return true;
+
+		case '[':
+		case ']':
+			OutOpen = '[';
+			OutClose = ']';
+			return true;
+
+		case '<':
+		case '>':
+			OutOpen = '<';
+			OutClose = '>';
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::ScanForBracket(const FView Text, const int32_t StartPos,
+	const int32_t Direction, const CharType Target, const CharType Opposite,
+	const int32_t MaxScan)
+{
+	const CharType* Data = Text.Data;
+	const int32_t	Len = Text.Len;
+
+	// Most of the text between two brackets holds neither of them; such
+	// blocks are ruled out with a branch-free fold & skipped as a whole.
+	constexpr int32_t BlockSize = 8;
+
+	const int32_t Limit = Direction > 0
+		? (MaxScan < Len - StartPos ? StartPos + MaxScan : Len)
+		: (MaxScan < StartPos + 1 ? StartPos - MaxScan : -1);
+
+	int32_t Depth = 0;
+	int32_t Pos = StartPos;
+	while (Direction > 0 ? Pos < Limit : Pos > Limit)
+	{
+		const int32_t BlockFirst = Direction > 0 ? Pos : Pos - BlockSize + 1;
+		if (Direction > 0 ? Pos + BlockSize <= Limit : BlockFirst > Limit)
+		{
+			bool bHasBracket = false;
+			for (int32_t i = 0; i < BlockSize; ++i)
+			{
+				const CharType Char = Data[BlockFirst + i];
+				bHasBracket |= (Char == Target) | (Char == Opposite);
+			}
+			if (!bHasBracket)
+			{
+				Pos += Direction * BlockSize;
+				continue;
+			}
+		}
+
+		const CharType Char = Data[Pos];
+		if (Char == Opposite)
+			++Depth;
+		else if (Char == Target && Depth-- == 0)
+			return Pos;
+
+		Pos += Direction;
+	}
+	return -1;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::SkipBlanks(const FView Text, const int32_t StartPos, const int32_t Direction)
+{
+	int32_t Pos = StartPos;
+	if (Direction > 0)
+	{
+		while (Pos < Text.Len && IsBlankChar(Text[Pos]))
+			++Pos;
+	}
+	else
+	{
+		while (Pos > 0 && IsBlankChar(Text[Pos - 1]))
+			--Pos;
+	}
+	return Pos;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::GetLineStart(const FView Text, const int32_t Pos)
+{
+	int32_t LineStart = Pos;
+	while (LineStart > 0 && Text[LineStart - 1] != '\n')
+		--LineStart;
+	return LineStart;
+}
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::GetLineEnd(const FView Text, const int32_t Pos)
+{
+	int32_t LineEnd = Pos;
+	while (LineEnd < Text.Len && Text[LineEnd] != '\n')
+		++LineEnd;
+	return LineEnd;
+}
+
+template <typename CharType>
+bool TVimTextCore<CharType>::IsBlankLine(const FView Text, const int32_t LineStart)
+{
+	const int32_t Pos = SkipBlanks(Text, LineStart, 1);
+	return Pos >= Text.Len || Text[Pos] == '\n' || Text[Pos] == '\r';
+}
+
+template <typename CharType>
+void TVimTextCore<CharType>::ExtendOverBlanks(const FView Text, int32_t& InOutStart, int32_t& InOutEnd)
+{
+	const int32_t TrailingEnd = SkipBlanks(Text, InOutEnd, 1);
+	if (TrailingEnd > InOutEnd)
+		InOutEnd = TrailingEnd;
+	else
+		InOutStart = SkipBlanks(Text, InOutStart, -1);
+}
+
+//------------------------------------------------------------------------------
+// Operator Motions
+//------------------------------------------------------------------------------
+
+template <typename CharType>
+bool TVimTextCore<CharType>::GetMotionRange(const FView Text, const int32_t Pos,
+	const EUMTextMotion Motion, const int32_t Count, const CharType Target,
+	const bool bIsChange, FVimTextRange& OutRange)
+{
+	const int32_t Len = Text.Len;
+	if (Len <= 0)
+		return false;
+
+	const int32_t Cur = Pos < 0 ? 0 : (Pos >= Len ? Len - 1 : Pos);
+	const int32_t N = Count > 1 ? Count : 1;
+	const int32_t LineStart = GetLineStart(Text, Cur);
+	const int32_t LineEnd = GetLineEnd(Text, Cur);
+
+	// Walks N lines from the current one; returns that line's start.
+	const auto WalkLines = [&Text, Len](int32_t From, int32_t Lines) {
+		for (; Lines > 0; --Lines)
+		{
+			const int32_t End = GetLineEnd(Text, From);
+			if (End >= Len)
+				break;
+			From = End + 1;
+		}
+		for (; Lines < 0 && From > 0; ++Lines)
+			From = GetLineStart(Text, From - 1);
+		return From;
+	};
+
+	// Linewise ranges span the lines from the first line's start.
+	const auto SetLines = [&Text, &OutRange](const int32_t FirstLine, const int32_t LastLine) {
+		OutRange.Start = FirstLine;
+		OutRange.End = GetLineEnd(Text, LastLine);
+		OutRange.bLinewise = true;
+	};
+
+	OutRange = FVimTextRange{ Cur, Cur, false };
+	switch (Motion)
+	{
+		case EUMTextMotion::Left:
+			OutRange.Start = Cur - N > LineStart ? Cur - N : LineStart;
+			break;
+
+		case EUMTextMotion::Right:
+			OutRange.End = Cur + N < LineEnd ? Cur + N : LineEnd;
+			break;
+
+		case EUMTextMotion::LinesUp:
+			if (LineStart == 0)
+				return false;
+			SetLines(WalkLines(LineStart, -N), LineStart);
+			return true;
+
+		case EUMTextMotion::LinesDown:
+			if (LineEnd >= Len)
+				return false;
+			SetLines(LineStart, WalkLines(LineStart, N));
+			return true;
+
+		case EUMTextMotion::CurrentLine:
+			SetLines(LineStart, WalkLines(LineStart, N - 1));
+			return true;
+
+		case EUMTextMotion::FirstLine:
+			SetLines(0, LineStart);
+			return true;
+
+		case EUMTextMotion::LastLine:
+			SetLines(LineStart, GetLineStart(Text, Len));
+			return true;
+
+		case EUMTextMotion::LineStart:
+			OutRange.Start = LineStart;
+			break;
+
+		case EUMTextMotion::LineEnd:
+			OutRange.End = GetLineEnd(Text, WalkLines(LineStart, N - 1));
+			break;
+
+		case EUMTextMotion::WordStart:
+		case EUMTextMotion::BigWordStart:
+		{
+			const bool bBigWord = Motion == EUMTextMotion::BigWordStart;
+			if (bIsChange && !IsWhitespaceChar(Text[Cur]))
+			{
+				// "cw" stops at the end of the (current, then next) word
+				int32_t WordEnd = bBigWord
+					? ScanCharRun(Text, Cur, 1, EUMCharType::Whitespace, true /*Negate*/)
+					: ScanCharRun(Text, Cur, 1, ClassifyChar(Text[Cur]));
+				for (int32_t i = 1; i < N && WordEnd < Len; ++i)
+					WordEnd = FindNextWordEnd(Text, WordEnd - 1, bBigWord) + 1;
+
+				OutRange.End = WordEnd;
+				break;
+			}
+
+			int32_t Next = Cur;
+			int32_t Prev = Cur;
+			for (int32_t i = 0; i < N && Next < Len; ++i)
+			{
+				Prev = Next;
+				Next = FindNextWordBoundary(Text, Next, bBigWord);
+			}
+
+			// Like Vim, the last word of a line doesn't take the line break along
+			const int32_t PrevLineEnd = GetLineEnd(Text, Prev);
+			OutRange.End = Next > PrevLineEnd && PrevLineEnd > Cur ? PrevLineEnd : Next;
+			break;
+		}
+		case EUMTextMotion::WordEnd:
+		case EUMTextMotion::BigWordEnd:
+		{
+			int32_t WordEnd = Cur;
+			for (int32_t i = 0; i < N; ++i)
+				WordEnd = FindNextWordEnd(Text, WordEnd, Motion == EUMTextMotion::BigWordEnd);
+
+			OutRange.End = WordEnd + 1; // Inclusive
+			break;
+		}
+		case EUMTextMotion::WordBack:
+		case EUMTextMotion::BigWordBack:
+		{
+			int32_t WordStart = Cur;
+			for (int32_t i = 0; i < N; ++i)
+				WordStart = FindPreviousWordBoundary(Text, WordStart, Motion == EUMTextMotion::BigWordBack);
+
+			OutRange.Start = WordStart;
+			break;
+		}
+		case EUMTextMotion::PrevWordEnd:
+		case EUMTextMotion::PrevBigWordEnd:
+		{
+			int32_t WordEnd = Cur;
+			for (int32_t i = 0; i < N; ++i)
+				WordEnd = FindPreviousWordEnd(Text, WordEnd, Motion == EUMTextMotion::PrevBigWordEnd);
+
+			OutRange.Start = WordEnd;
+			OutRange.End = Cur + 1; // Inclusive on both ends
+			break;
+		}
+		case EUMTextMotion::FindChar:
+		case EUMTextMotion::TillChar:
+		case EUMTextMotion::FindCharBack:
+		case EUMTextMotion::TillCharBack:
+		{
+			const bool bForward = Motion == EUMTextMotion::FindChar
+				|| Motion == EUMTextMotion::TillChar;
+			const bool bTill = Motion == EUMTextMotion::TillChar
+				|| Motion == EUMTextMotion::TillCharBack;
+
+			// The Nth occurrence within the line
+			int32_t Found = -1;
+			int32_t Matches = 0;
+			for (int32_t i = Cur + (bForward ? 1 : -1);
+				bForward ? i < LineEnd : i >= LineStart; i += bForward ? 1 : -1)
+			{
+				if (Text[i] == Target && ++Matches == N)
+				{
+					Found = i;
+					break;
+				}
+			}
+			if (Found < 0)
+				return false;
+
+			if (bForward)
+				OutRange.End = bTill ? Found : Found + 1;
+			else
+				OutRange.Start = bTill ? Found + 1 : Found;
+			break;
+		}
+	}
+	return OutRange.End > OutRange.Start;
+}
+
+//------------------------------------------------------------------------------
+// Search
+//------------------------------------------------------------------------------
+
+template <typename CharType>
+bool TVimTextCore<CharType>::IsWholeWord(const FView Text, const int32_t Start, const int32_t End)
+{
+	return Start >= 0 && Start < End && End <= Text.Len
+		&& (Start == 0 || !IsWordChar(Text[Start - 1]))
+		&& (End == Text.Len || !IsWordChar(Text[End]));
+}
+
+template <typename CharType>
+TVimLiteralSearcher<CharType>::TVimLiteralSearcher(const FView InPattern, const bool bInIgnoreCase)
+	: Pattern(InPattern)
+	, bIgnoreCase(bInIgnoreCase)
+{
+	for (int32_t& Shift : Shifts)
+		Shift = Pattern.Len;
+
+	// Later chars overwrite earlier ones with smaller skips, so colliding
+	// buckets always end up with the safest (smallest) of them.
+	for (int32_t i = 0; i < Pattern.Len - 1; ++i)
+		Shifts[Bucket(Fold(Pattern[i]))] = Pattern.Len - 1 - i;
+}
+
+template <typename CharType>
+int32_t TVimLiteralSearcher<CharType>::FindNext(const FView Text, const int32_t From) const
+{
+	const int32_t Last = Pattern.Len - 1;
+	if (Last < 0)
+		return -1;
+
+	const CharType LastChar = Fold(Pattern[Last]);
+	for (int32_t Pos = From < 0 ? 0 : From; Pos + Last < Text.Len;)
+	{
+		// Compare right to left, starting with the char that also drives the skip
+		const CharType Tail = Fold(Text[Pos + Last]);
+		if (Tail == LastChar && MatchesAt(Text, Pos))
+			return Pos;
+
+		Pos += Shifts[Bucket(Tail)];
+	}
+	return -1;
+}
+
+template <typename CharType>
+bool TVimLiteralSearcher<CharType>::MatchesAt(const FView Text, const int32_t Pos) const
+{
+	if (Pos < 0 || Pos + Pattern.Len > Text.Len)
+		return false;
+
+	for (int32_t i = Pattern.Len - 1; i >= 0; --i)
+	{
+		if (Fold(Text[Pos + i]) != Fold(Pattern[i]))
+			return false;
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Positions
+//------------------------------------------------------------------------------
+
+template <typename CharType>
+int32_t TVimTextCore<CharType>::PositionToAbsoluteOffset(const FView Text, const FVimTextPosition Position)
+{
+	int32_t Line = 0;
+	int32_t LineStart = 0;
+	for (int32_t i = 0; i < Text.Len && Line < Position.Line; ++i)
+	{
+		if (Text[i] == '\n')
+		{
+			++Line;
+			LineStart = i + 1;
+		}
+	}
+	return LineStart + Position.Offset;
+}
+
+template <typename CharType>
+FVimTextPosition TVimTextCore<CharType>::AbsoluteOffsetToPosition(const FView Text, const int32_t AbsoluteOffset)
+{
+	const int32_t Target = AbsoluteOffset < 0
+		? 0
+		: (AbsoluteOffset > Text.Len ? Text.Len : AbsoluteOffset);
+
+	FVimTextPosition Position;
+	int32_t			 LineStart = 0;
+	for (int32_t i = 0; i < Target; ++i)
+	{
+		if (Text[i] == '\n')
+		{
+			++Position.Line;
+			LineStart = i + 1;
+		}
+	}
+	Position.Offset = Target - LineStart;
+	return Position;
+}
+
+template class TVimTextCore<char>;
+template class TVimTextCore<wchar_t>;
+template class TVimTextCore<char16_t>;
+
+template class TVimLiteralSearcher<char>;
+template class TVimLiteralSearcher<wchar_t>;
+template class TVimLiteralSearcher<char16_t>;
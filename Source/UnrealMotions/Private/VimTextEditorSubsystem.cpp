@@ -9,10 +9,34 @@
 #include "VimTextEditorUtils.h"
 #include "UMSlateHelpers.h"
 #include "VimTextTypes.h"
+#include "UMEditorCommands.h"
 
 // DEFINE_LOG_CATEGORY_STATIC(LogVimTextEditorSubsystem, NoLogging, All);
 DEFINE_LOG_CATEGORY_STATIC(LogVimTextEditorSubsystem, Log, All);
 
+/**
+ * Logs how many synthetic key presses the scoped motion has issued.
+ * Run `log LogVimTextEditorSubsystem Verbose` to see them.
+ */
+struct FUMScopedSyntheticKeyCount
+{
+	FUMScopedSyntheticKeyCount(const TCHAR* InMotionName)
+		: MotionName(InMotionName)
+		, StartCount(FVimInputProcessor::GetSimulatedKeyPressCount())
+	{
+	}
+
+	~FUMScopedSyntheticKeyCount()
+	{
+		UE_LOG(LogVimTextEditorSubsystem, Verbose,
+			TEXT("%s: %u synthetic key press(es)"), MotionName,
+			FVimInputProcessor::GetSimulatedKeyPressCount() - StartCount);
+	}
+
+	const TCHAR* MotionName;
+	const uint32 StartCount;
+};
+
 bool UVimTextEditorSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 {
 	return FUMConfig::Get()->IsVimEnabled();
@@ -112,19 +136,32 @@ void UVimTextEditorSubsystem::AssignEditableBorder(bool bAssignDefaultBorder, co
 		? CurrentVimMode
 		: OptVimModeOverride;
 
+	const FSlateBrush* Brush = &GetBorderBrush(VimMode);
+	FUMEditableState*  State = GetActiveEditableState();
+	if (State && State->AppliedBorder == Brush)
+		return; // Already wearing it
+
 	switch (EditableWidgetsFocusState)
 	{
 		case EUMEditableWidgetsFocusState::SingleLine:
 		{
 			if (const auto TextBox = ActiveEditableTextBox.Pin())
-				TextBox->SetBorderImage(&GetBorderBrush(VimMode));
+			{
+				TextBox->SetBorderImage(Brush);
+				if (State)
+					State->AppliedBorder = Brush;
+			}
 			return;
 		}
 		case EUMEditableWidgetsFocusState::MultiLine:
 		{
 			if (const TSharedPtr<SMultiLineEditableTextBox> MultiTextBox =
 					ActiveMultiLineEditableTextBox.Pin())
-				MultiTextBox->SetBorderImage(&GetBorderBrush(VimMode));
+			{
+				MultiTextBox->SetBorderImage(Brush);
+				if (State)
+					State->AppliedBorder = Brush;
+			}
 			return;
 		}
 		default:
@@ -161,75 +198,67 @@ void UVimTextEditorSubsystem::OnFocusChanged(
 	if (!NewWidget.IsValid())
 		return;
 
-	const TSharedRef<SWidget> NewWidgetRef = NewWidget.ToSharedRef();
-	Logger.Print("On Focus Changed -> Editable");
-	// Check if Single-Line Editable Text & Track
-	if (NewWidget->GetType().ToString().Equals(SingleEditableTextType))
+	// Type names compare by index; most focus changes end here.
+	const FName NewWidgetType = NewWidget->GetType();
+	const bool	bIsSingleLine = NewWidgetType == SingleEditableTextTypeName;
+	if (!bIsSingleLine && NewWidgetType != MultiEditableTextTypeName)
 	{
-		Logger.Print("Found SingleLine");
-		if (IsNewEditableText(NewWidgetRef))
+		// Check if any editables we're focused before, and handle them.
+		if (EditableWidgetsFocusState != EUMEditableWidgetsFocusState::None)
 		{
-			Logger.Print("New SingleLine");
 			OnEditableFocusLost();
-			ActiveEditableGeneric = NewWidget; // Track as Generic
-			EditableWidgetsFocusState =
-				EUMEditableWidgetsFocusState::SingleLine; // Track Mode
-
-			TSharedPtr<SEditableText> EditableText =
-				StaticCastSharedPtr<SEditableText>(NewWidget);
-			ActiveEditableText = EditableText; // Track Editable
-
-			Logger.Print("SEditableText Found", ELogVerbosity::Verbose);
-		}
-		else
-		{
-			Logger.Print("Same SingleLine");
-			return;
+			EditableWidgetsFocusState = EUMEditableWidgetsFocusState::None;
+			Logger.Print("None-Editable");
 		}
+		return; // Early return Non-Editables.
 	}
-	// Check if Multi-Line Editable Text & Track
-	else if (NewWidget->GetType().ToString().Equals(MultiEditableTextType))
-	{
-		if (IsNewEditableText(NewWidgetRef))
-		{
-			OnEditableFocusLost();
 
-			ActiveEditableGeneric = NewWidget; // Track as Generic
-			EditableWidgetsFocusState =
-				EUMEditableWidgetsFocusState::MultiLine; // Track Mode
+	const TSharedRef<SWidget> NewWidgetRef = NewWidget.ToSharedRef();
+	if (!IsNewEditableText(NewWidgetRef))
+		return; // Same editable
 
-			TSharedPtr<SMultiLineEditableText> MultiEditableText =
-				StaticCastSharedPtr<SMultiLineEditableText>(NewWidget);
-			ActiveMultiLineEditableText = MultiEditableText; // Track Editable
+	Logger.Print("On Focus Changed -> Editable");
+	OnEditableFocusLost();
+	ActiveEditableGeneric = NewWidget; // Track as Generic
 
-			Logger.Print("SMultiLineEditableText Found", ELogVerbosity::Verbose);
-		}
-		else
-			return;
+	// Check if Single-Line Editable Text & Track
+	if (bIsSingleLine)
+	{
+		EditableWidgetsFocusState =
+			EUMEditableWidgetsFocusState::SingleLine; // Track Mode
+		ActiveEditableText = StaticCastSharedPtr<SEditableText>(NewWidget);
+		Logger.Print("SEditableText Found", ELogVerbosity::Verbose);
 	}
-	else // No Editables found:
+	// Multi-Line Editable Text & Track
+	else
 	{
-		// Check if any editables we're focused before, and handle them.
-		OnEditableFocusLost();
-		EditableWidgetsFocusState = EUMEditableWidgetsFocusState::None;
-		Logger.Print("None-Editable");
-		return; // Early return Non-Editables.
+		EditableWidgetsFocusState =
+			EUMEditableWidgetsFocusState::MultiLine; // Track Mode
+		ActiveMultiLineEditableText =
+			StaticCastSharedPtr<SMultiLineEditableText>(NewWidget);
+		Logger.Print("SMultiLineEditableText Found", ELogVerbosity::Verbose);
 	}
 
-	// Climb to the EditableTextBox parent
-	TSharedPtr<SWidget> Parent =
-		NewWidget->GetParentWidget(); // Usually SBox or some wrapper
-	if (!Parent.IsValid())
-		return;
-	Parent = Parent->GetParentWidget(); // Usually SHorizontalBox
-	if (!Parent.IsValid())
-		return;
-	// The actual SEditableTextBox or SMultiLineEditableTextBoxs
-	Parent = Parent->GetParentWidget();
-	if (!Parent.IsValid())
-		return;
+	FUMEditableState&	State = FindOrAddEditableState(NewWidgetRef);
+	TSharedPtr<SWidget> Parent = State.Box.Pin();
+	if (!Parent.IsValid()) // First encounter (or rebuilt); climb & remember
+	{
+		// Climb to the EditableTextBox parent
+		Parent = NewWidget->GetParentWidget(); // Usually SBox or some wrapper
+		if (!Parent.IsValid())
+			return;
+		Parent = Parent->GetParentWidget(); // Usually SHorizontalBox
+		if (!Parent.IsValid())
+			return;
+		// The actual SEditableTextBox or SMultiLineEditableTextBoxs
+		Parent = Parent->GetParentWidget();
+		if (!Parent.IsValid())
+			return;
 
-	Logger.Print("Climbed to parent");
+		Logger.Print("Climbed to parent");
+		if (Parent->GetWidgetClass().GetWidgetType() == BorderTypeName)
+			State.Box = Parent;
+	}
 
 	// NOTE: We can not look up the specific types, as they aren't represented
 	// as Multi/SingleEditText, but by some other wrappers like "SSearchBox",
@@ -248,9 +277,14 @@ void UVimTextEditorSubsystem::OnFocusChanged(
 	// end up with 1 regular stroke instead of 2.
 	bIsFirstSingleLineKeyStroke = true;
 
+	// Whatever we've set up on this box before is still in place, so only
+	// first encounters pay for the handler, hint text & console lookups.
+	const bool bIsFirstEncounter = !State.bIsKeyDownHandlerBound;
+	State.bIsKeyDownHandlerBound = State.Box.IsValid();
+
 	if (EditableWidgetsFocusState == EUMEditableWidgetsFocusState::SingleLine)
 	{
-		if (Parent->GetWidgetClass().GetWidgetType().IsEqual("SBorder"))
+		if (State.Box.IsValid())
 		{
 			FVimTextEditorUtils::DetermineVimModeForSingleLineEncounter();
 
@@ -258,11 +292,12 @@ void UVimTextEditorSubsystem::OnFocusChanged(
 				StaticCastSharedPtr<SEditableTextBox>(Parent);
 			ActiveEditableTextBox = TextBox;
 
-			TextBox->SetOnKeyDownHandler(OnSingleLineEditableKeyDown);
-
-			FText HintText = TextBox->GetHintText();
-			if (!HintText.IsEmpty())
-				DefaultHintText = HintText;
+			if (bIsFirstEncounter)
+			{
+				TextBox->SetOnKeyDownHandler(OnSingleLineEditableKeyDown);
+				State.DefaultHintText = TextBox->GetHintText();
+			}
+			DefaultHintText = State.DefaultHintText;
 
 			// I think that for SingleLine it's a better UX to leave these off
 			// TextBox->SetSelectAllTextWhenFocused(false);
@@ -272,19 +307,12 @@ void UVimTextEditorSubsystem::OnFocusChanged(
 	}
 	else // Multi-Line
 	{
-		if (Parent->GetWidgetClass().GetWidgetType().IsEqual("SBorder"))
+		if (State.Box.IsValid())
 		{
 			TSharedPtr<SMultiLineEditableTextBox> MultiTextBox =
 				StaticCastSharedPtr<SMultiLineEditableTextBox>(Parent);
 			ActiveMultiLineEditableTextBox = MultiTextBox;
 
-			const TSharedPtr<SMultiLineEditableText>
-				MultiText = GetMultilineEditableFromBox(MultiTextBox.ToSharedRef());
-			if (MultiText.IsValid())
-			{
-				MultiText->SetClearTextSelectionOnFocusLoss(false);
-			}
-
 			// NOTE:
 			// In one hand this solves the annoying unexpected behavior of Enter
 			// in MultiLine text by intercepting the Enter key and sending a
@@ -293,17 +321,30 @@ void UVimTextEditorSubsystem::OnFocusChanged(
 			// So, either we'll need to detect when we're at a console vs. an
 			// editable, or...
 			// Are there any other places like Console that need this commision?
-			bIsCurrMultiLineChildOfConsole = IsMultiChildOfConsole(MultiTextBox.ToSharedRef());
-			MultiTextBox->SetOnKeyDownHandler(OnMultiLineEditableKeyDown);
+			if (bIsFirstEncounter)
+			{
+				// The focused widget is the box's own editable.
+				StaticCastSharedPtr<SMultiLineEditableText>(NewWidget)
+					->SetClearTextSelectionOnFocusLoss(false);
 
-			FText HintText = MultiTextBox->GetHintText();
-			if (!HintText.IsEmpty())
-				DefaultHintText = HintText;
+				State.bIsChildOfConsole = IsMultiChildOfConsole(MultiTextBox.ToSharedRef());
+				MultiTextBox->SetOnKeyDownHandler(OnMultiLineEditableKeyDown);
+				State.DefaultHintText = MultiTextBox->GetHintText();
+			}
+			bIsCurrMultiLineChildOfConsole = State.bIsChildOfConsole;
+			DefaultHintText = State.DefaultHintText;
 
 			Logger.Print("Set Active MultiEditable Text Box");
 		}
 	}
 
+	// Open a group right away, so typing before the first command is undoable
+	if (State.Box.IsValid())
+	{
+		if (const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex())
+			State.UndoHistory.BeginGroup(*LineIndex);
+	}
+
 	SetEditableUnifiedStyle();
 	AssignEditableBorder();
 	HandleEditableUX(); // We early return if Non-Editables, so this is safe.
@@ -324,6 +365,12 @@ void UVimTextEditorSubsystem::SetEditableUnifiedStyle(const float InDelay)
 }
 void UVimTextEditorSubsystem::SetEditableUnifiedStyle()
 {
+	FUMEditableState* State = GetActiveEditableState();
+	if (State && State->bIsStyled)
+		return; // The style is the same for all; nothing resets it
+	if (State)
+		State->bIsStyled = true;
+
 	switch (EditableWidgetsFocusState)
 	{
 		case EUMEditableWidgetsFocusState::SingleLine:
@@ -382,6 +429,8 @@ void UVimTextEditorSubsystem::ToggleReadOnlySingle(bool bNegateCurrentState, boo
 	{
 		if (bNegateCurrentState)
 			TextBox->SetIsReadOnly(!TextBox->IsReadOnly());
+		else if (TextBox->IsReadOnly() == (CurrentVimMode != EVimMode::Insert))
+			return; // Already so (& the cursor blinks accordingly)
 		else
 			TextBox->SetIsReadOnly(CurrentVimMode != EVimMode::Insert);
 
@@ -422,7 +471,15 @@ void UVimTextEditorSubsystem::ToggleReadOnlyMulti(bool bNegateCurrentState, bool
 			MultiTextBox->SetIsReadOnly(!MultiLine->IsTextReadOnly());
 		}
 		else
+		{
+			// The tracked inner editable spares us the traversal above
+			const TSharedPtr<SMultiLineEditableText> MultiLine = ActiveMultiLineEditableText.Pin();
+			if (MultiLine.IsValid()
+				&& MultiLine->IsTextReadOnly() == (CurrentVimMode != EVimMode::Insert))
+				return; // Already so (& the cursor blinks accordingly)
+
 			MultiTextBox->SetIsReadOnly(CurrentVimMode != EVimMode::Insert);
+		}
 
 		// NOTE:
 		// We set this dummy GoTo to refresh the cursor blinking to ON / OFF
@@ -446,11 +503,12 @@ const FSlateRoundedBoxBrush& UVimTextEditorSubsystem::GetBorderBrush(EVimMode In
 
 	// Define color map for different modes
 	static const TMap<EVimMode, FLinearColor> ModeColors = {
-		{ EVimMode::Any, FLinearColor(0.1f, 0.1f, 0.1f, 1.0f) },		// Grey
-		{ EVimMode::Normal, FLinearColor(0.0f, 0.5f, 1.0f, 1.0f) },		// Cyan
-		{ EVimMode::Visual, FLinearColor(1.0f, 0.25f, 1.0f, 1.0f) },	// Purple
-		{ EVimMode::VisualLine, FLinearColor(1.0f, 0.0f, 0.0f, 1.0f) }, // Red
-		{ EVimMode::Insert, FLinearColor(0.75f, 0.5f, 0.0f, 1.0f) }		// Orange
+		{ EVimMode::Any, FLinearColor(0.1f, 0.1f, 0.1f, 1.0f) },		 // Grey
+		{ EVimMode::Normal, FLinearColor(0.0f, 0.5f, 1.0f, 1.0f) },		 // Cyan
+		{ EVimMode::Visual, FLinearColor(1.0f, 0.25f, 1.0f, 1.0f) },	 // Purple
+		{ EVimMode::VisualLine, FLinearColor(1.0f, 0.0f, 0.0f, 1.0f) },	 // Red
+		{ EVimMode::VisualBlock, FLinearColor(1.0f, 0.0f, 0.5f, 1.0f) }, // Pink
+		{ EVimMode::Insert, FLinearColor(0.75f, 0.5f, 0.0f, 1.0f) }		 // Orange
 	};
 
 	// Define and initialize brushes only once
@@ -491,6 +549,7 @@ bool UVimTextEditorSubsystem::TrySetHintTextForVimMode()
 
 		case EVimMode::Visual:
 		case EVimMode::VisualLine:
+		case EVimMode::VisualBlock:
 		case EVimMode::Normal:
 			return SetActiveEditableHintText(NormalModeHintText,
 				true /* Only set Hint Text if editable had one initially */);
@@ -677,9 +736,24 @@ bool UVimTextEditorSubsystem::ForceFocusActiveEditable(FSlateApplication& SlateA
 
 void UVimTextEditorSubsystem::OnEditableFocusLost()
 {
+	// Record what was typed since the last command; the history is kept with
+	// the editable, so u still reaches it when we're back.
+	if (FVimTextUndoHistory* UndoHistory = GetActiveUndoHistory())
+	{
+		if (const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex())
+			UndoHistory->EndGroup(*LineIndex);
+	}
+	ActiveEditableLineIndex.Invalidate();
 	ResetEditableHintText(true /*Clear Tracked Hint Text for next run*/);
 	AssignEditableBorder(true /*Assign Default Border -> Focus Lost*/);
 	FVimInputProcessor::Get()->Unpossess(this); // In case aborting while replace
+	if (TextSearch.bIsPromptActive) // Or while typing a search pattern
+		EndSearchPrompt(FSlateApplication::Get(), false);
+	if (VisualBlock.bIsActive) // Or while in Visual Block
+	{
+		VisualBlock.bIsActive = false;
+		FVimInputProcessor::Get()->ResetBufferVisualizer(FSlateApplication::Get());
+	}
 
 	switch (EditableWidgetsFocusState)
 	{
@@ -746,6 +820,9 @@ void UVimTextEditorSubsystem::ResetEditableHintText(bool bResetTrackedHintText)
 			break;
 	}
 
+	if (FUMEditableState* State = GetActiveEditableState())
+		State->AppliedHintText = FText::GetEmpty(); // Back to its own
+
 	if (bResetTrackedHintText)
 		DefaultHintText = FText::GetEmpty();
 }
@@ -763,6 +840,44 @@ bool UVimTextEditorSubsystem::IsNewEditableText(
 		return true;
 }
 
+FUMEditableState& UVimTextEditorSubsystem::FindOrAddEditableState(
+	const TSharedRef<SWidget> InEditable)
+{
+	FUMEditableState& State = EditableStates.FindOrAdd(InEditable->GetId());
+	if (State.Editable.IsValid())
+		return State;
+
+	// New (or an Id reused by a new widget): start over. Adding is the only
+	// time the map grows, so it's also when we reclaim destroyed editables.
+	State = FUMEditableState();
+	State.Editable = InEditable;
+	if (EditableStates.Num() <= EditableStatesPruneThreshold)
+		return State;
+
+	const uint64 Id = InEditable->GetId();
+	for (auto It = EditableStates.CreateIterator(); It; ++It)
+	{
+		if (It.Key() != Id && !It.Value().Editable.IsValid())
+			It.RemoveCurrent();
+	}
+	// Mostly alive? Wait for twice as many before walking them again.
+	EditableStatesPruneThreshold = FMath::Max(
+		MinEditableStatesPruneThreshold, EditableStates.Num() * 2);
+	return EditableStates.FindChecked(Id);
+}
+
+FUMEditableState* UVimTextEditorSubsystem::GetActiveEditableState()
+{
+	const TSharedPtr<SWidget> Editable = ActiveEditableGeneric.Pin();
+	return Editable.IsValid() ? EditableStates.Find(Editable->GetId()) : nullptr;
+}
+
+FVimTextUndoHistory* UVimTextEditorSubsystem::GetActiveUndoHistory()
+{
+	FUMEditableState* State = GetActiveEditableState();
+	return State ? &State->UndoHistory : nullptr;
+}
+
 bool UVimTextEditorSubsystem::IsDefaultEditableBuffer(const FString& InBuffer)
 {
 	return (InBuffer.Len() == 2 && InBuffer == "  ");
@@ -774,6 +889,8 @@ void UVimTextEditorSubsystem::HandleVimTextNavigation(FSlateApplication& SlateAp
 		|| IsEditableTextWithDefaultBuffer()) // Preserve default buffer sel
 		return;
 
+	FUMScopedSyntheticKeyCount SyntheticKeyCount(TEXT("HJKL"));
+
 	// DebugMultiLineCursorLocation(true /*Pre-Navigation*/);
 
 	FKey ArrowKeyToSimulate;
@@ -795,7 +912,16 @@ void UVimTextEditorSubsystem::HandleVimTextNavigation(FSlateApplication& SlateAp
 	else
 	{
 		if (EditableWidgetsFocusState == EUMEditableWidgetsFocusState::MultiLine)
-			HandleUpDownMultiLine(SlateApp, ArrowKeyToSimulate);
+		{
+			// Normal Mode lands on the counted line directly (e.g. 5j)
+			if (!bIsVimModeVisualBased)
+			{
+				const int32 Count = FVimInputProcessor::Get()->ConsumeCountPrefix();
+				MoveBlockCursorByLines(ArrowKeyToSimulate == EKeys::Up ? -Count : Count);
+			}
+			else
+				HandleUpDownMultiLine(SlateApp, ArrowKeyToSimulate);
+		}
 
 		else // Single-line -> Just go up or down
 			FVimInputProcessor::Get()->SimulateKeyPress(
@@ -852,6 +978,16 @@ void UVimTextEditorSubsystem::HandleRightNavigation(FSlateApplication& SlateApp)
 	}
 	else // Normal Mode
 	{
+		if (const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex())
+		{
+			const int32 CharAbs = GetBlockCursorAbsOffset(*LineIndex);
+			if (CharAbs != INDEX_NONE)
+			{
+				PlaceBlockCursor(*LineIndex, CharAbs + 1);
+				return;
+			}
+		}
+		// Single-Line: no selection to read, walk there with keys.
 		ClearTextSelection();							// Break from curr sel
 		Input->SimulateKeyPress(SlateApp, Right);		// GoTo next char
 		Input->SimulateKeyPress(SlateApp, EKeys::Left); // Prep right alignment
@@ -907,6 +1043,15 @@ void UVimTextEditorSubsystem::HandleLeftNavigation(FSlateApplication& SlateApp)
 	}
 	else // Normal Mode
 	{
+		if (const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex())
+		{
+			const int32 CharAbs = GetBlockCursorAbsOffset(*LineIndex);
+			if (CharAbs != INDEX_NONE)
+			{
+				PlaceBlockCursor(*LineIndex, CharAbs - 1);
+				return;
+			}
+		}
 		ClearTextSelection(); // Break from current selection
 
 		// Because we're right aligned, we need to sim left to go to
@@ -1238,12 +1383,19 @@ void UVimTextEditorSubsystem::JumpUpOrDown(FSlateApplication& SlateApp, const TA
 	if (const TSharedPtr<SMultiLineEditableTextBox> MultiTextBox =
 			ActiveMultiLineEditableTextBox.Pin())
 	{
-		const FKey NavUpOrDownKey = InSequence.Last().Key == EKeys::U
-			? EKeys::Up
-			: EKeys::Down;
+		FUMScopedSyntheticKeyCount SyntheticKeyCount(TEXT("JumpUpOrDown"));
 
+		const bool	bJumpUp = InSequence.Last().Key == EKeys::U;
 		const int32 NumOfLinesToJump = 6;
 
+		// Normal Mode lands directly on the target line.
+		if (!bIsVimModeVisualBased)
+		{
+			MoveBlockCursorByLines(bJumpUp ? -NumOfLinesToJump : NumOfLinesToJump);
+			return;
+		}
+
+		const FKey NavUpOrDownKey = bJumpUp ? EKeys::Up : EKeys::Down;
 		for (int32 i{ 0 }; i < NumOfLinesToJump; ++i)
 			HandleUpDownMultiLine(SlateApp, NavUpOrDownKey);
 	}
@@ -1251,6 +1403,30 @@ void UVimTextEditorSubsystem::JumpUpOrDown(FSlateApplication& SlateApp, const TA
 
 void UVimTextEditorSubsystem::SetCursorSelectionToDefaultLocation(FSlateApplication& SlateApp, bool bAlignCursorRight)
 {
+	// Multi-Lines: resolve the char the key sequences below would end up
+	// highlighting and select it directly.
+	if (const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex())
+	{
+		FTextLocation Anchor;
+		FTextLocation Cursor;
+		if (GetMultiLineAnchorAndCursor(Anchor, Cursor))
+		{
+			const int32 AnchorAbs = LineIndex->ToAbsoluteOffset(Anchor);
+			const int32 CursorAbs = LineIndex->ToAbsoluteOffset(Cursor);
+
+			int32 CharAbs;
+			if (AnchorAbs != CursorAbs) // Collapses to the selection's edge
+				CharAbs = bAlignCursorRight
+					? FMath::Min(AnchorAbs, CursorAbs)
+					: FMath::Max(AnchorAbs, CursorAbs) - 1;
+			else
+				CharAbs = bAlignCursorRight ? CursorAbs - 1 : CursorAbs;
+
+			PlaceBlockCursor(*LineIndex, CharAbs, bAlignCursorRight);
+			return;
+		}
+	}
+
 	TSharedRef<FVimInputProcessor> InputProcessor = FVimInputProcessor::Get();
 	if (bAlignCursorRight)
 	{ // Right Align: for most cases
@@ -1266,6 +1442,141 @@ void UVimTextEditorSubsystem::SetCursorSelectionToDefaultLocation(FSlateApplicat
 	}
 }
 
+bool UVimTextEditorSubsystem::GetMultiLineAnchorAndCursor(FTextLocation& OutAnchor, FTextLocation& OutCursor)
+{
+	if (EditableWidgetsFocusState != EUMEditableWidgetsFocusState::MultiLine)
+		return false;
+
+	const TSharedPtr<SMultiLineEditableTextBox> MultiTextBox =
+		ActiveMultiLineEditableTextBox.Pin();
+	if (!MultiTextBox.IsValid())
+		return false;
+
+	OutCursor = MultiTextBox->GetCursorLocation();
+	if (!OutCursor.IsValid())
+		return false;
+
+	OutAnchor = OutCursor;
+	if (MultiTextBox->AnyTextSelected())
+	{
+		const TSharedPtr<SMultiLineEditableText> MultiText =
+			GetMultilineEditableFromBox(MultiTextBox.ToSharedRef());
+		if (!MultiText.IsValid())
+			return false;
+
+		// LocationA is where the selection began (see DebugSelectionRange)
+		OutAnchor = MultiText->GetSelection().LocationA;
+	}
+	return true;
+}
+
+int32 UVimTextEditorSubsystem::GetBlockCursorAbsOffset(const FVimTextLineIndex& LineIndex)
+{
+	FTextLocation Anchor;
+	FTextLocation Cursor;
+	if (!GetMultiLineAnchorAndCursor(Anchor, Cursor))
+		return INDEX_NONE;
+
+	const int32 AnchorAbs = LineIndex.ToAbsoluteOffset(Anchor);
+	const int32 CursorAbs = LineIndex.ToAbsoluteOffset(Cursor);
+	if (AnchorAbs != CursorAbs)
+		return FMath::Min(AnchorAbs, CursorAbs);
+
+	// Nothing selected: we're right aligned, so the char is behind the cursor.
+	return FMath::Max(CursorAbs - 1, 0);
+}
+
+bool UVimTextEditorSubsystem::PlaceBlockCursor(
+	const FVimTextLineIndex& LineIndex, int32 AbsCharOffset, bool bAlignRight)
+{
+	const FString& Text = LineIndex.GetText();
+	if (Text.IsEmpty())
+		return SelectTextNative(FTextLocation(0, 0), FTextLocation(0, 0));
+
+	// Empty lines have no char of their own, so we highlight a line break:
+	// - Last line: the one before it, right aligned onto the last line.
+	// - Otherwise: their own, left aligned to stay on the empty line.
+	if (AbsCharOffset >= Text.Len())
+		bAlignRight = true;
+	else if (AbsCharOffset >= 0
+		&& Text[AbsCharOffset] == TEXT('\n')
+		&& (AbsCharOffset == 0 || Text[AbsCharOffset - 1] == TEXT('\n')))
+		bAlignRight = false;
+
+	AbsCharOffset = FMath::Clamp(AbsCharOffset, 0, Text.Len() - 1);
+
+	const FTextLocation CharStart = LineIndex.ToTextLocation(AbsCharOffset);
+	const FTextLocation CharEnd = LineIndex.ToTextLocation(AbsCharOffset + 1);
+	return bAlignRight
+		? SelectTextNative(CharStart, CharEnd)
+		: SelectTextNative(CharEnd, CharStart);
+}
+
+bool UVimTextEditorSubsystem::SelectTextNative(const FTextLocation& InAnchor, const FTextLocation& InCursor)
+{
+	switch (EditableWidgetsFocusState)
+	{
+		case EUMEditableWidgetsFocusState::SingleLine:
+			if (const auto EditTextBox = ActiveEditableTextBox.Pin())
+			{
+				const TSharedPtr<SEditableText> EditableText = GetSingleEditableFromBox(EditTextBox.ToSharedRef());
+				if (EditableText.IsValid())
+				{
+					EditableText->SelectText(
+						FTextLocation(0, InAnchor.GetOffset()),
+						FTextLocation(0, InCursor.GetOffset()));
+					return true;
+				}
+			}
+			break;
+
+		case EUMEditableWidgetsFocusState::MultiLine:
+			if (const TSharedPtr<SMultiLineEditableTextBox> MultiTextBox =
+					ActiveMultiLineEditableTextBox.Pin())
+			{
+				MultiTextBox->SelectText(InAnchor, InCursor);
+				return true;
+			}
+			break;
+
+		default:
+			break;
+	}
+	return false;
+}
+
+bool UVimTextEditorSubsystem::MoveBlockCursorByLines(const int32 LineDelta)
+{
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return false;
+
+	FTextLocation Anchor;
+	FTextLocation Cursor;
+	if (!GetMultiLineAnchorAndCursor(Anchor, Cursor))
+		return false;
+
+	// The cursor is always on the current line, even when the highlighted
+	// char is a line break (empty lines).
+	const int32			CurrLineIndex = Cursor.GetLineIndex();
+	const FTextLocation CharLocation = Anchor < Cursor ? Anchor : Cursor;
+	int32				Column = 0;
+	if (CharLocation.GetLineIndex() == CurrLineIndex)
+		Column = Anchor == Cursor
+			? FMath::Max(Cursor.GetOffset() - 1, 0)
+			: CharLocation.GetOffset();
+
+	const int32 NewLineIndex = FMath::Clamp(
+		CurrLineIndex + LineDelta, 0, LineIndex->GetLineCount() - 1);
+	if (NewLineIndex == CurrLineIndex)
+		return true; // Top or bottom of the document
+
+	const int32 NewLineLen = LineIndex->GetLineLength(NewLineIndex);
+	const int32 NewColumn = FMath::Min(Column, FMath::Max(NewLineLen - 1, 0));
+
+	return PlaceBlockCursor(*LineIndex, LineIndex->GetLineStart(NewLineIndex) + NewColumn);
+}
+
 bool UVimTextEditorSubsystem::DoesActiveEditableHasAnyTextSelected()
 {
 	switch (EditableWidgetsFocusState)
@@ -1313,6 +1624,34 @@ bool UVimTextEditorSubsystem::GetActiveEditableTextContent(FString& OutText, con
 	return false;
 }
 
+const FVimTextLineIndex* UVimTextEditorSubsystem::GetActiveEditableLineIndex()
+{
+	FText CurrentText;
+	switch (EditableWidgetsFocusState)
+	{
+		case EUMEditableWidgetsFocusState::SingleLine:
+			if (const TSharedPtr<SEditableTextBox> EditTextBox = ActiveEditableTextBox.Pin())
+				CurrentText = EditTextBox->GetText();
+			else
+				return nullptr;
+			break;
+
+		case EUMEditableWidgetsFocusState::MultiLine:
+			if (const TSharedPtr<SMultiLineEditableTextBox> MultiTextBox =
+					ActiveMultiLineEditableTextBox.Pin())
+				CurrentText = MultiTextBox->GetText();
+			else
+				return nullptr;
+			break;
+
+		default:
+			return nullptr;
+	}
+
+	ActiveEditableLineIndex.Update(CurrentText);
+	return &ActiveEditableLineIndex;
+}
+
 bool UVimTextEditorSubsystem::GetSelectedText(FString& OutText)
 {
 	switch (EditableWidgetsFocusState)
@@ -1411,6 +1750,7 @@ void UVimTextEditorSubsystem::DebugSelectionRange(const FTextSelection& InSelect
 
 bool UVimTextEditorSubsystem::SetActiveEditableText(const FText& InText)
 {
+	ActiveEditableLineIndex.Invalidate();
 	switch (EditableWidgetsFocusState)
 	{
 		case EUMEditableWidgetsFocusState::None:
@@ -1439,6 +1779,10 @@ bool UVimTextEditorSubsystem::SetActiveEditableHintText(const FText& InText, boo
 	if (bConsiderDefaultHintText && DefaultHintText.IsEmpty())
 		return false;
 
+	FUMEditableState* State = GetActiveEditableState();
+	if (State && State->AppliedHintText.IdenticalTo(InText))
+		return true; // Already showing it
+
 	switch (EditableWidgetsFocusState)
 	{
 		case EUMEditableWidgetsFocusState::None:
@@ -1448,6 +1792,8 @@ bool UVimTextEditorSubsystem::SetActiveEditableHintText(const FText& InText, boo
 			if (const auto EditTextBox = ActiveEditableTextBox.Pin())
 			{
 				EditTextBox->SetHintText(InText);
+				if (State)
+					State->AppliedHintText = InText;
 				return true;
 			}
 
@@ -1456,6 +1802,8 @@ bool UVimTextEditorSubsystem::SetActiveEditableHintText(const FText& InText, boo
 					ActiveMultiLineEditableTextBox.Pin())
 			{
 				MultiTextBox->SetHintText(InText);
+				if (State)
+					State->AppliedHintText = InText;
 				return true;
 			}
 	}
@@ -1559,65 +1907,7 @@ bool UVimTextEditorSubsystem::HandleUpDownMultiLine(FSlateApplication& SlateApp,
 
 bool UVimTextEditorSubsystem::HandleUpDownMultiLineNormalMode(FSlateApplication& SlateApp, const FKey& InKeyDir)
 {
-	const TSharedPtr<SMultiLineEditableTextBox> MultiTextBox =
-		ActiveMultiLineEditableTextBox.Pin();
-	if (!MultiTextBox.IsValid())
-		return false;
-
-	TSharedRef<FVimInputProcessor> InputProc = FVimInputProcessor::Get();
-	const bool					   bMoveUp = InKeyDir == EKeys::Up;
-
-	// Get current cursor location to determine how we should navigate
-	FTextLocation TextLocation = MultiTextBox->GetCursorLocation();
-	if (!TextLocation.IsValid())
-		return false;
-	const int32 CurrLineIndex = TextLocation.GetLineIndex();
-	const int32 StartCharOffset = TextLocation.GetOffset();
-	FString		StartLineText;
-	MultiTextBox->GetCurrentTextLine(StartLineText);
-	const bool bStartLineEmpty = StartLineText.IsEmpty();
-
-	ClearTextSelection();
-
-	const int32 NewLineIndex = bMoveUp
-		? CurrLineIndex - 1	 // Previous line index
-		: CurrLineIndex + 1; // Next line index
-	MultiTextBox->GoTo(FTextLocation(NewLineIndex, 0));
-
-	// Check if we've entered an empty line to determine proper navigation
-	FString NewLineText;
-	MultiTextBox->GetCurrentTextLine(NewLineText);
-	if (NewLineText.IsEmpty())
-	{ // Empty Line Flow:
-		// This sequence of right then left+Shift here is important
-		// to both highlight the cursor yet stay in the empty line itself
-		// for further navigation
-		// TODO: Refactor this
-		if (IsMultiLineCursorAtEndOfDocument(SlateApp, MultiTextBox.ToSharedRef()))
-			SetCursorSelectionToDefaultLocation(SlateApp,
-				// false /*Left Align*/); // Right Align isn't working here too
-				true /*Right Align*/);
-		else
-			SetCursorSelectionToDefaultLocation(SlateApp,
-				false /*Left Align*/);
-	}
-	else // Non-empty lines
-	{
-		if (StartCharOffset > NewLineText.Len())
-		{
-			InputProc->SimulateKeyPress(SlateApp, EKeys::End);
-			SetCursorSelectionToDefaultLocation(SlateApp);
-		}
-		else
-		{
-			MultiTextBox->GoTo(FTextLocation(NewLineIndex, StartCharOffset));
-			if (bStartLineEmpty)
-				InputProc->SimulateKeyPress(SlateApp, EKeys::Right, FUMInputHelpers::GetShiftDownModKeys());
-			else
-				SetCursorSelectionToDefaultLocation(SlateApp);
-		}
-	}
-	return true;
+	return MoveBlockCursorByLines(InKeyDir == EKeys::Up ? -1 : 1);
 }
 
 bool UVimTextEditorSubsystem::HandleUpDownMultiLineVisualMode(FSlateApplication& SlateApp, const FKey& InKeyDir)
@@ -2029,6 +2319,11 @@ bool UVimTextEditorSubsystem::IsMultiLineCursorAtBeginningOfLine(bool bForceZero
 // correctly.
 bool UVimTextEditorSubsystem::IsCursorAlignedRight(FSlateApplication& SlateApp)
 {
+	FTextLocation Anchor;
+	FTextLocation Cursor;
+	if (GetMultiLineAnchorAndCursor(Anchor, Cursor))
+		return !(Cursor < Anchor);
+
 	FString	   OriginSelText = "";
 	const bool bWasAnyTextSelected = GetSelectedText(OriginSelText);
 	if (!bWasAnyTextSelected)
@@ -2251,115 +2546,17 @@ void UVimTextEditorSubsystem::ShiftDeleteNormalMode(FSlateApplication& SlateApp,
 	HandleEditableUX();
 }
 
-void UVimTextEditorSubsystem::DeleteUpOrDown(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
+void UVimTextEditorSubsystem::AppendNewLine(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
 {
-	const TSharedPtr<SMultiLineEditableTextBox> MultiTextBox =
-		ActiveMultiLineEditableTextBox.Pin();
-	if (!MultiTextBox.IsValid())
-		return;
-
-	// Get the MultiLine itself to quick access line count
-	const TSharedPtr<SMultiLineEditableText> MultiLine = GetMultilineEditableFromBox(MultiTextBox.ToSharedRef());
-	if (!MultiLine.IsValid())
-		return;
-
-	FTextLocation TextLocation = MultiLine->GetCursorLocation();
-	if (!TextLocation.IsValid())
-		return;
-	const int32 LineIndex = TextLocation.GetLineIndex();
-	const int32 LineCount = MultiLine->GetTextLineCount();
-
-	// Logger.Print(FString::Printf(TEXT("Line Index: %d\nLine Count: %d"), LineIndex, LineCount), true);
+	// Only in MultiLine we want to simulate \n (break line)
+	const bool bIsMultiLine = EditableWidgetsFocusState == EUMEditableWidgetsFocusState::MultiLine;
 
-	const bool bIsUp = InSequence.Last().Key == EKeys::K;
-	if (bIsUp && LineIndex == 0)
-		return; // Invalid: At the first line
-	else if (!bIsUp && LineIndex + 1 == LineCount)
-		return; // Invalid: At the last line.
+	TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
+	VimProc->SetVimMode(SlateApp, EVimMode::Insert);
 
-	FString TextGetter;
-	FString TextToYank;
-	if (bIsUp)
+	if (InKeyEvent.IsShiftDown())
 	{
-		HandleUpDownMultiLineNormalMode(SlateApp, EKeys::Up);
-		GetCursorLocation(SlateApp, TextLocation);
-	}
-
-	// Prepare lines for yanking
-	MultiLine->GetTextLine(TextLocation.GetLineIndex(), TextGetter);
-	TextToYank.Append(TextGetter + '\n');
-	MultiLine->GetTextLine(TextLocation.GetLineIndex() + 1, TextGetter);
-	TextToYank.Append(TextGetter);
-
-	DeleteLine(SlateApp, FKeyEvent());
-	DeleteLine(SlateApp, FKeyEvent());
-	YankData.SetData(TextToYank, EUMYankType::Linewise); // Manually yank lines
-}
-
-void UVimTextEditorSubsystem::ActionToMotion(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
-{
-	if (InSequence.Num() < 2)
-		return; // We expect at least 2 elements (e.g. dw, de, etc.)
-
-	const FKey Action = InSequence[0].Key; // i.e. Delete / Change / Yank
-
-	// Create a sub-array skipping the first element (d)
-	// (Should be done before switching to Visual Mode as switching Vim Modes
-	// resets the InSequence ref)
-	TArray<FInputChord> SubSequence;
-	for (int32 i = 1; i < InSequence.Num(); i++)
-		SubSequence.Add(InSequence[i]);
-
-	FTextLocation OriginTextLocation;
-	if (!GetCursorLocation(SlateApp, OriginTextLocation))
-		return;
-	FTextLocation						 NewTextLocation;
-	const TSharedRef<FVimInputProcessor> InputProc = FVimInputProcessor::Get();
-	InputProc->SetVimMode(SlateApp, EVimMode::Visual);
-
-	// Pass the newly created array containing the pure word motions (dw vs. w)
-	NavigateWordMotion(SlateApp, SubSequence);
-
-	if (!GetCursorLocation(SlateApp, NewTextLocation))
-		return;
-
-	if (NewTextLocation != OriginTextLocation)
-	{
-		if (NewTextLocation.GetLineIndex() != OriginTextLocation.GetLineIndex())
-		{
-			if (!GoToTextLocation(SlateApp, OriginTextLocation))
-				return;
-			FString TextLine;
-			GetActiveEditableTextContent(TextLine, true /*CurrLine*/);
-			SelectTextToOffset(SlateApp, OriginTextLocation, TextLine.Len());
-		}
-		else if (SubSequence[0].Key == EKeys::W)
-			HandleLeftNavigation(SlateApp);
-		else if (SubSequence[0].Key == EKeys::G)
-			HandleRightNavigation(SlateApp);
-	}
-
-	if (Action == EKeys::D)
-		Delete(SlateApp, FKeyEvent());
-
-	else if (Action == EKeys::C)
-		ChangeVisualMode(SlateApp, FKeyEvent());
-
-	else if (Action == EKeys::Y)
-		YankCharacter(SlateApp, TArray<FInputChord>());
-}
-
-void UVimTextEditorSubsystem::AppendNewLine(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
-{
-	// Only in MultiLine we want to simulate \n (break line)
-	const bool bIsMultiLine = EditableWidgetsFocusState == EUMEditableWidgetsFocusState::MultiLine;
-
-	TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
-	VimProc->SetVimMode(SlateApp, EVimMode::Insert);
-
-	if (InKeyEvent.IsShiftDown())
-	{
-		VimProc->SimulateKeyPress(SlateApp, EKeys::Home);
+		VimProc->SimulateKeyPress(SlateApp, EKeys::Home);
 
 		if (bIsMultiLine)
 		{
@@ -2395,6 +2592,7 @@ bool UVimTextEditorSubsystem::AppendBreakMultiLine()
 
 bool UVimTextEditorSubsystem::InsertTextAtCursor(FSlateApplication& SlateApp, const FText& InText)
 {
+	ActiveEditableLineIndex.Invalidate();
 	switch (EditableWidgetsFocusState)
 	{
 		case EUMEditableWidgetsFocusState::SingleLine:
@@ -2567,37 +2765,6 @@ void UVimTextEditorSubsystem::DeleteCurrentSelection(FSlateApplication& SlateApp
 	ToggleReadOnly(true, true /*Stop Blinking*/);
 }
 
-void UVimTextEditorSubsystem::ChangeEntireLine(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
-{
-	switch (EditableWidgetsFocusState)
-	{
-		case EUMEditableWidgetsFocusState::None:
-			return; // Theoretically not reachable
-
-		case EUMEditableWidgetsFocusState::SingleLine:
-			DeleteLineSingle(SlateApp, InKeyEvent);
-			break;
-
-		case EUMEditableWidgetsFocusState::MultiLine:
-			ChangeEntireLineMulti(SlateApp, InKeyEvent);
-			break;
-	}
-	FVimInputProcessor::Get()->SetVimMode(SlateApp, EVimMode::Insert);
-}
-
-void UVimTextEditorSubsystem::ChangeEntireLineMulti(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
-{
-	DeleteLineMulti(SlateApp, InKeyEvent); // Also goes to insert mode
-	if (GetMultiLineCount() == 1)		   // Multi's with 1 line are G2G
-		return;
-
-	bool bAtEnd = IsMultiLineCursorAtEndOfDocument(true /*Last Line as End*/);
-
-	AppendBreakMultiLine();
-	if (!bAtEnd)
-		FVimInputProcessor::Get()->SimulateKeyPress(SlateApp, EKeys::Up);
-}
-
 int32 UVimTextEditorSubsystem::GetMultiLineCount()
 {
 	if (const TSharedPtr<SMultiLineEditableTextBox> MultiTextBox =
@@ -2617,15 +2784,6 @@ void UVimTextEditorSubsystem::DeleteToEndOfLine(FSlateApplication& SlateApp, con
 	FVimInputProcessor::Get()->SetVimMode(SlateApp, EVimMode::Normal);
 }
 
-void UVimTextEditorSubsystem::DeleteInsideWord(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
-{
-	if (SelectInsideWord(SlateApp))
-	{
-		DeleteCurrentSelection(SlateApp, true /*Yank Deleted Text*/);
-		FVimInputProcessor::Get()->SetVimMode(SlateApp, EVimMode::Normal);
-	}
-}
-
 void UVimTextEditorSubsystem::ChangeToEndOfLine(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
 {
 	TSharedRef<FVimInputProcessor> InputProc = FVimInputProcessor::Get();
@@ -2648,12 +2806,6 @@ void UVimTextEditorSubsystem::ChangeVisualMode(FSlateApplication& SlateApp, cons
 	InputProc->SetVimMode(SlateApp, EVimMode::Insert);
 }
 
-void UVimTextEditorSubsystem::ChangeInsideWord(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
-{
-	if (SelectInsideWord(SlateApp))
-		ChangeVisualMode(SlateApp, FKeyEvent());
-}
-
 FUMStringInfo UVimTextEditorSubsystem::GetFStringInfo(const FString& InputString)
 {
 	FUMStringInfo Info;
@@ -2829,74 +2981,6 @@ void UVimTextEditorSubsystem::NavigateGBigE(FSlateApplication& SlateApp, const T
 		&FVimTextEditorUtils::FindPreviousWordEnd);
 }
 
-void UVimTextEditorSubsystem::NavigateWordMotion(
-	FSlateApplication&		   SlateApp,
-	const TArray<FInputChord>& InSequence)
-{
-	// Determine if we're dealing with a big word (WORD) or small word (word)
-	bool bIsBigWord = false;
-
-	// Determine direction and position (beginning/end of word)
-	bool bIsForward = true;
-	bool bIsWordEnd = false;
-	bool bIsGCommand = false;
-
-	// Parse the sequence to determine the exact motion
-	if (InSequence.Num() == 1)
-	{
-		// Single key commands: w, W, b, B, e, E
-		const FInputChord& Chord = InSequence[0];
-
-		if (Chord.Key == EKeys::W)
-		{
-			// w or W - forward to beginning of word
-			bIsBigWord = Chord.bShift;
-			bIsForward = true;
-			bIsWordEnd = false;
-		}
-		else if (Chord.Key == EKeys::B)
-		{
-			// b or B - backward to beginning of word
-			bIsBigWord = Chord.bShift;
-			bIsForward = false;
-			bIsWordEnd = false;
-		}
-		else if (Chord.Key == EKeys::E)
-		{
-			// e or E - forward to end of word
-			bIsBigWord = Chord.bShift;
-			bIsForward = true;
-			bIsWordEnd = true;
-		}
-	}
-	else if (InSequence.Num() == 2 && InSequence[0].Key == EKeys::G)
-	{
-		// 'g' commands: ge, gE
-		bIsGCommand = true;
-		const FInputChord& SecondChord = InSequence[1];
-
-		if (SecondChord.Key == EKeys::E)
-		{
-			// ge or gE - backward to end of word
-			bIsBigWord = SecondChord.bShift;
-			bIsForward = false;
-			bIsWordEnd = true;
-		}
-	}
-
-	// Select the appropriate word boundary function
-	auto WordBoundaryFunc = bIsForward
-		? (bIsWordEnd
-				  ? &FVimTextEditorUtils::FindNextWordEnd
-				  : &FVimTextEditorUtils::FindNextWordBoundary)
-		: (bIsWordEnd
-				  ? &FVimTextEditorUtils::FindPreviousWordEnd
-				  : &FVimTextEditorUtils::FindPreviousWordBoundary);
-
-	// Call the navigation function with determined parameters
-	NavigateWord(SlateApp, bIsBigWord, WordBoundaryFunc);
-}
-
 //------------------------------------------------------------------------------
 // Main Navigation Functions
 //------------------------------------------------------------------------------
@@ -2909,19 +2993,21 @@ void UVimTextEditorSubsystem::NavigateWord(
 	int32 (*FindWordBoundary)(
 		const FString& Text, int32 CurrentPos, bool bBigWord))
 {
-	FString Text;
-	if (!GetActiveEditableTextContent(Text))
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
 		return;
+	const FString& Text = LineIndex->GetText();
 	// Logger.Print(FString::Printf(TEXT("Editable Text: %s"), *Text), true);
 
+	FUMScopedSyntheticKeyCount SyntheticKeyCount(TEXT("NavigateWord"));
+
 	TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
 	FTextLocation				   OriginCursorLocation;
 	if (!GetCursorLocation(SlateApp, OriginCursorLocation))
 		return;
 	// Logger.Print(FString::Printf(TEXT("Origin Offset: %d"), OriginCursorLocation.GetOffset()), true);
 
-	int32 CurrentAbs = FVimTextEditorUtils::TextLocationToAbsoluteOffset(
-		Text,
+	int32 CurrentAbs = LineIndex->ToAbsoluteOffset(
 		FTextLocation(
 			OriginCursorLocation.GetLineIndex(),
 			OriginCursorLocation.GetOffset()
@@ -2929,12 +3015,20 @@ void UVimTextEditorSubsystem::NavigateWord(
 
 	// Logger.Print(FString::Printf(TEXT("Current Abs: %d"), CurrentAbs), true);
 
-	const int32 NewAbs = (*FindWordBoundary)(Text, CurrentAbs, bBigWord);
+	// Apply the whole count over the buffer, then update the cursor once.
+	const int32 Count = VimProc->ConsumeCountPrefix();
+	int32		NewAbs = CurrentAbs;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const int32 NextAbs = (*FindWordBoundary)(Text, NewAbs, bBigWord);
+		if (NextAbs == NewAbs)
+			break; // Start or end of the text
+		NewAbs = NextAbs;
+	}
 
 	// Logger.Print(FString::Printf(TEXT("New Abs: %d"), NewAbs), true);
 
-	FTextLocation NewLoc;
-	FVimTextEditorUtils::AbsoluteOffsetToTextLocation(Text, NewAbs, NewLoc);
+	const FTextLocation NewLoc = LineIndex->ToTextLocation(NewAbs);
 	if (!NewLoc.IsValid())
 		return;
 	// Logger.Print(FString::Printf(TEXT("Final GoTo Location:\nLine Index: %d\nOffset: %d"), NewLoc.GetLineIndex(), NewLoc.GetOffset()), true);
@@ -2947,61 +3041,947 @@ void UVimTextEditorSubsystem::NavigateWord(
 			VimProc->SimulateKeyPress(SlateApp, EKeys::Right, ModShiftDown);
 	}
 	else // Normal Mode
+		PlaceBlockCursor(*LineIndex, NewAbs);
+}
+int32 UVimTextEditorSubsystem::GetCursorCharAbsOffset(FSlateApplication& SlateApp, const FVimTextLineIndex& LineIndex)
+{
+	const int32 CharAbs = GetBlockCursorAbsOffset(LineIndex);
+	if (CharAbs != INDEX_NONE)
+		return CharAbs;
+
+	// Single-Lines: derive it from the cursor
+	FTextLocation CursorLocation;
+	if (!GetCursorLocation(SlateApp, CursorLocation))
+		return INDEX_NONE;
+
+	// We need to compensate by 1 in case we're right aligned.
+	const int32 OffsetAdj = IsCursorAlignedRight(SlateApp)
+			&& !IsCursorAtBeginningOfDocument(SlateApp, true)
+		? 1
+		: 0;
+	return LineIndex.ToAbsoluteOffset(FTextLocation(
+		CursorLocation.GetLineIndex(), CursorLocation.GetOffset() - OffsetAdj));
+}
+
+bool UVimTextEditorSubsystem::ResolveTextObjectRange(FSlateApplication& SlateApp,
+	const TArray<FInputChord>& InSequence, int32& OutStart, int32& OutEnd)
+{
+	if (InSequence.Num() < 2)
+		return false;
+
+	EUMTextObjectType Type;
+	TCHAR			  Delimiter;
+	if (!FVimTextEditorUtils::GetTextObjectFromChord(InSequence.Last(), Type, Delimiter))
+		return false;
+	const bool bAround = InSequence.Last(1).Key == EKeys::A;
+
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return false;
+
+	const int32 CharAbs = GetCursorCharAbsOffset(SlateApp, *LineIndex);
+	if (CharAbs == INDEX_NONE)
+		return false;
+
+	return FVimTextEditorUtils::GetTextObject(LineIndex->GetText(), CharAbs,
+			   Type, bAround, Delimiter, OutStart, OutEnd)
+		&& OutStart < OutEnd;
+}
+
+bool UVimTextEditorSubsystem::SelectTextObject(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
+{
+	int32 Start, End;
+	if (!ResolveTextObjectRange(SlateApp, InSequence, Start, End))
+		return false;
+
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	const FTextLocation		 StartLocation = LineIndex->ToTextLocation(Start);
+	const FTextLocation		 EndLocation = LineIndex->ToTextLocation(End);
+
+	// Entering Visual Mode tracks the cursor as the start of the selection, so
+	// we override it with the object's start after the switch.
+	FVimInputProcessor::Get()->SetVimMode(SlateApp, EVimMode::Visual);
+	StartCursorLocationVisualMode = StartLocation;
+
+	return SelectTextNative(StartLocation, EndLocation);
+}
+
+void UVimTextEditorSubsystem::SelectTextObjectVisualMode(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
+{
+	FVimInputProcessor::Get()->ConsumeCountPrefix();
+	SelectTextObject(SlateApp, InSequence);
+}
+
+void UVimTextEditorSubsystem::BindTextObjects(const TArray<FInputChord>& InPrefix,
+	void (UVimTextEditorSubsystem::*Handler)(FSlateApplication&, const TArray<FInputChord>&),
+	const TArray<EVimMode>& InVimModes)
+{
+	// Every key GetTextObjectFromChord understands
+	static const TArray<FInputChord> ObjectChords = {
+		EKeys::W,
+		FInputChord(EModifierKey::Shift, EKeys::W),
+		EKeys::P,
+		EKeys::Apostrophe,									// '
+		FInputChord(EModifierKey::Shift, EKeys::Apostrophe), // "
+		EKeys::Tilde,										// `
+		EKeys::B,
+		FInputChord(EModifierKey::Shift, EKeys::B),
+		FInputChord(EModifierKey::Shift, EKeys::Nine), // (
+		FInputChord(EModifierKey::Shift, EKeys::Zero), // )
+		EKeys::LeftBracket,
+		EKeys::RightBracket,
+		FInputChord(EModifierKey::Shift, EKeys::LeftBracket),  // {
+		FInputChord(EModifierKey::Shift, EKeys::RightBracket), // }
+		FInputChord(EModifierKey::Shift, EKeys::Comma),		   // <
+		FInputChord(EModifierKey::Shift, EKeys::Period),	   // >
+	};
+
+	TWeakObjectPtr<UVimTextEditorSubsystem> WeakTextSubsystem = this;
+	TSharedRef<FVimInputProcessor>			VimInputProcessor = FVimInputProcessor::Get();
+
+	for (const FKey& Scope : { EKeys::I, EKeys::A })
+	{
+		for (const FInputChord& ObjectChord : ObjectChords)
+		{
+			TArray<FInputChord> Sequence = InPrefix;
+			Sequence.Add(FInputChord(Scope));
+			Sequence.Add(ObjectChord);
+
+			VimInputProcessor->AddKeyBinding_Sequence(
+				EUMBindingContext::TextEditing,
+				Sequence,
+				WeakTextSubsystem,
+				Handler,
+				InVimModes);
+		}
+	}
+}
+
+void UVimTextEditorSubsystem::BeginOperator(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
+{
+	TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
+
+	PendingOperator = FUMPendingOperator();
+	PendingOperator.Operator = InSequence.Last();
+	PendingOperator.OperatorCount = VimProc->ConsumeCountPrefix();
+
+	VimProc->Possess(this, &UVimTextEditorSubsystem::HandleOperatorPendingKey);
+}
+
+void UVimTextEditorSubsystem::HandleOperatorPendingKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	if (FUMInputHelpers::IsKeyEventModifierOnly(InKeyEvent))
+		return;
+
+	const FInputChord Chord = FUMInputHelpers::GetChordFromKeyEvent(InKeyEvent);
+	const FKey&		  Key = Chord.Key;
+	const bool		  bHasModifiers = InKeyEvent.GetModifierKeys().AnyModifiersDown();
+
+	if (!PendingOperator.Prefix.IsValidChord() && !bHasModifiers)
+	{
+		// The motion's count ("3" of "d3w"). A leading 0 is the 0 motion.
+		int32 Digit = 0;
+		if (FUMInputHelpers::GetDigitFromKey(Key, Digit)
+			|| (Key == EKeys::Zero && PendingOperator.MotionCount > 0))
+		{
+			PendingOperator.MotionCount = FMath::Min(
+				PendingOperator.MotionCount * 10 + Digit, 999);
+			return;
+		}
+
+		// Keys completed by a second one: text objects (i / a), ge / gE / gg
+		if (Key == EKeys::I || Key == EKeys::A || Key == EKeys::G)
+		{
+			PendingOperator.Prefix = Chord;
+			return;
+		}
+	}
+
+	// f / F / t / T await their target char
+	if (!PendingOperator.Prefix.IsValidChord()
+		&& (Key == EKeys::F || Key == EKeys::T)
+		&& !InKeyEvent.IsControlDown() && !InKeyEvent.IsAltDown())
 	{
-		GoToTextLocation(SlateApp, NewLoc);
-		if (NewAbs == Text.Len()) // We're at end, sim Left, then Shift+Right
-			SetCursorSelectionToDefaultLocation(SlateApp /*Align Right*/);
+		PendingOperator.Prefix = Chord;
+		return;
+	}
+
+	EndOperatorPending(); // Resolved or aborted (e.g. Escape) from here on
+
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return;
+
+	const int32 CharAbs = GetCursorCharAbsOffset(SlateApp, *LineIndex);
+	if (CharAbs == INDEX_NONE)
+		return;
+
+	FVimTextRange Range;
+	if (ResolveOperatorRange(SlateApp, Chord, InKeyEvent, CharAbs, Range))
+		ApplyOperator(SlateApp, Range, CharAbs);
+}
+
+void UVimTextEditorSubsystem::EndOperatorPending()
+{
+	FVimInputProcessor::Get()->Unpossess(this);
+}
+
+bool UVimTextEditorSubsystem::ResolveOperatorRange(FSlateApplication& SlateApp,
+	const FInputChord& InChord, const FKeyEvent& InKeyEvent, const int32 CharAbs,
+	FVimTextRange& OutRange)
+{
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return false;
+
+	const FString&	   Text = LineIndex->GetText();
+	const FInputChord& Prefix = PendingOperator.Prefix;
+	const bool		   bShift = InChord.NeedsShift();
+
+	// Text Objects (e.g. "diw", "ca(", "yap")
+	if (Prefix.Key == EKeys::I || Prefix.Key == EKeys::A)
+	{
+		EUMTextObjectType Type;
+		TCHAR			  Delimiter;
+		OutRange = FVimTextRange();
+		return FVimTextEditorUtils::GetTextObjectFromChord(InChord, Type, Delimiter)
+			&& FVimTextEditorUtils::GetTextObject(Text, CharAbs, Type,
+				Prefix.Key == EKeys::A, Delimiter, OutRange.Start, OutRange.End)
+			&& OutRange.Start < OutRange.End;
+	}
+
+	EUMTextMotion Motion;
+	TCHAR		  Target = TEXT('\0');
+
+	if (Prefix.Key == EKeys::G)
+	{
+		if (InChord.Key == EKeys::E)
+			Motion = bShift ? EUMTextMotion::PrevBigWordEnd : EUMTextMotion::PrevWordEnd;
+		else if (InChord.Key == EKeys::G && !bShift)
+			Motion = EUMTextMotion::FirstLine;
 		else
-			VimProc->SimulateKeyPress(SlateApp, EKeys::Right, ModShiftDown);
+			return false;
+	}
+	else if (Prefix.Key == EKeys::F || Prefix.Key == EKeys::T)
+	{
+		Target = FUMInputHelpers::GetCharFromKeyEvent(InKeyEvent);
+		if (!FChar::IsPrint(Target))
+			return false; // e.g. Escape
+
+		const bool bBackward = Prefix.NeedsShift();
+		Motion = Prefix.Key == EKeys::F
+			? (bBackward ? EUMTextMotion::FindCharBack : EUMTextMotion::FindChar)
+			: (bBackward ? EUMTextMotion::TillCharBack : EUMTextMotion::TillChar);
+	}
+	else if (InChord == PendingOperator.Operator) // dd, cc, yy, >>, <<
+		Motion = EUMTextMotion::CurrentLine;
+
+	else if (!FVimTextEditorUtils::GetMotionFromChord(InChord, Motion))
+		return false; // e.g. Escape
+
+	return FVimTextEditorUtils::GetMotionRange(Text, CharAbs, Motion,
+		PendingOperator.GetCount(), Target,
+		PendingOperator.Operator.Key == EKeys::C, OutRange);
+}
+
+void UVimTextEditorSubsystem::ApplyOperator(FSlateApplication& SlateApp, const FVimTextRange& InRange, const int32 CharAbs)
+{
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return;
+
+	const FString& Text = LineIndex->GetText();
+	const FKey	   Operator = PendingOperator.Operator.Key;
+
+	if (Operator == EKeys::Period || Operator == EKeys::Comma) // > / <
+	{
+		ShiftLines(SlateApp, *LineIndex, InRange, Operator == EKeys::Period);
+		return;
+	}
+
+	YankData.SetData(Text.Mid(InRange.Start, InRange.End - InRange.Start),
+		InRange.bLinewise ? EUMYankType::Linewise : EUMYankType::Characterwise);
+
+	// Linewise operations land on the first line, keeping the column.
+	const int32 Column = LineIndex->ToTextLocation(CharAbs).GetOffset();
+	const auto	GetLinewiseCursor = [Column](const FVimTextLineIndex& Index, const int32 AbsOffset) {
+		const int32 Line = Index.ToTextLocation(AbsOffset).GetLineIndex();
+		return Index.GetLineStart(Line)
+			+ FMath::Min(Column, FMath::Max(Index.GetLineLength(Line) - 1, 0));
+	};
+
+	if (Operator == EKeys::Y)
+	{
+		// Lands on the start of the yanked text (e.g. "yb" moves, "yw" doesn't)
+		PlaceBlockCursor(*LineIndex, InRange.bLinewise
+				? GetLinewiseCursor(*LineIndex, InRange.Start)
+				: InRange.Start);
+		return;
+	}
+
+	// Deleting whole lines takes their line break along: the trailing one, or
+	// the preceding one for the document's last line.
+	int32 Start = InRange.Start;
+	int32 End = InRange.End;
+	if (InRange.bLinewise && Operator == EKeys::D)
+	{
+		if (End < Text.Len())
+			++End;
+		else if (Start > 0)
+			--Start;
+	}
+
+	if (Start < End) // A single edit over the whole range
+	{
+		SelectTextNative(LineIndex->ToTextLocation(Start), LineIndex->ToTextLocation(End));
+		DeleteCurrentSelection(SlateApp, false /*Already Yanked*/);
+	}
+
+	if (Operator == EKeys::C)
+	{
+		FVimInputProcessor::Get()->SetVimMode(SlateApp, EVimMode::Insert);
+		return;
+	}
+
+	if (const FVimTextLineIndex* EditedIndex = GetActiveEditableLineIndex())
+	{
+		PlaceBlockCursor(*EditedIndex, InRange.bLinewise
+				? GetLinewiseCursor(*EditedIndex, FMath::Min(Start, EditedIndex->GetText().Len()))
+				: Start);
+	}
+}
+
+void UVimTextEditorSubsystem::ShiftLines(FSlateApplication& SlateApp,
+	const FVimTextLineIndex& LineIndex, const FVimTextRange& InRange, const bool bShiftRight)
+{
+	// Single-Lines have no use for indentation
+	if (EditableWidgetsFocusState != EUMEditableWidgetsFocusState::MultiLine)
+		return;
+
+	static constexpr int32 TabWidth = 4; // Spaces unindented by <, if no tab
+
+	const FString& Text = LineIndex.GetText();
+	const int32	   FirstLine = LineIndex.ToTextLocation(InRange.Start).GetLineIndex();
+	const int32	   LastLine = LineIndex.ToTextLocation(InRange.End).GetLineIndex();
+	const int32	   BlockStart = LineIndex.GetLineStart(FirstLine);
+	const int32	   BlockEnd = LineIndex.GetLineStart(LastLine) + LineIndex.GetLineLength(LastLine);
+
+	// Rebuild the lines' block & swap it in with a single insertion.
+	FString Shifted;
+	Shifted.Reserve(BlockEnd - BlockStart + LastLine - FirstLine + 1);
+	for (int32 Line = FirstLine; Line <= LastLine; ++Line)
+	{
+		const int32 LineStart = LineIndex.GetLineStart(Line);
+		const int32 LineEnd = LineStart + LineIndex.GetLineLength(Line);
+		int32		From = LineStart;
+
+		if (bShiftRight)
+		{
+			if (LineEnd > LineStart) // Empty lines stay empty
+				Shifted.AppendChar(TEXT('\t'));
+		}
+		else if (From < LineEnd && Text[From] == TEXT('\t'))
+			++From;
+		else
+		{
+			while (From < LineEnd && From - LineStart < TabWidth && Text[From] == TEXT(' '))
+				++From;
+		}
+
+		Shifted.AppendChars(*Text + From, LineEnd - From);
+		if (Line < LastLine)
+			Shifted.AppendChar(TEXT('\n'));
+	}
+
+	if (Shifted.Len() == BlockEnd - BlockStart
+		&& FCString::Strncmp(*Shifted, *Text + BlockStart, Shifted.Len()) == 0)
+		return; // Nothing to unindent
+
+	SelectTextNative(LineIndex.ToTextLocation(BlockStart), LineIndex.ToTextLocation(BlockEnd));
+	InsertTextAtCursor(SlateApp, FText::FromString(Shifted));
+
+	// Land on the first line's first non-blank char
+	if (const FVimTextLineIndex* EditedIndex = GetActiveEditableLineIndex())
+	{
+		int32 FirstNonBlank = 0;
+		while (FirstNonBlank < Shifted.Len() && FChar::IsWhitespace(Shifted[FirstNonBlank])
+			&& Shifted[FirstNonBlank] != TEXT('\n'))
+			++FirstNonBlank;
+		PlaceBlockCursor(*EditedIndex, BlockStart + FirstNonBlank);
+	}
+}
+
+void UVimTextEditorSubsystem::BeginSearch(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return;
+
+	TextSearch.OriginAbs = GetCursorCharAbsOffset(SlateApp, *LineIndex);
+	if (TextSearch.OriginAbs == INDEX_NONE)
+		return;
+
+	TextSearch.PromptPattern.Reset();
+	TextSearch.bPromptBackward = InKeyEvent.IsShiftDown(); // ?
+	TextSearch.bIsPromptActive = true;
+
+	FVimInputProcessor::Get()->Possess(this, &UVimTextEditorSubsystem::HandleSearchPromptKey);
+
+	// The sequence that got us here hides the buffer visualizer right after
+	// this call, so we bring it back with the prompt on the next tick.
+	GEditor->GetTimerManager()->SetTimerForNextTick([this]() {
+		if (TextSearch.bIsPromptActive && TextSearch.PromptPattern.IsEmpty())
+			ShowSearchPrompt(FSlateApplication::Get(), INDEX_NONE);
+	});
+}
+
+void UVimTextEditorSubsystem::HandleSearchPromptKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	if (FUMInputHelpers::IsKeyEventModifierOnly(InKeyEvent))
+		return;
+
+	const FKey& Key = InKeyEvent.GetKey();
+	if (Key == EKeys::Escape
+		|| (Key == EKeys::BackSpace && TextSearch.PromptPattern.IsEmpty()))
+	{
+		EndSearchPrompt(SlateApp, true /*Restore Cursor*/);
+		return;
+	}
+
+	if (Key == EKeys::Enter)
+	{
+		EndSearchPrompt(SlateApp, false);
+
+		// An empty pattern repeats the last one (as in Vim)
+		if (!TextSearch.PromptPattern.IsEmpty())
+		{
+			TextSearch.Pattern = TextSearch.PromptPattern;
+			TextSearch.bWholeWord = false;
+		}
+		TextSearch.bBackward = TextSearch.bPromptBackward;
+
+		if (TextSearch.Pattern.IsEmpty()
+			|| !JumpToSearchMatch(TextSearch.OriginAbs, !TextSearch.bBackward, 1))
+		{
+			if (const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex())
+				PlaceBlockCursor(*LineIndex, TextSearch.OriginAbs);
+		}
+		return;
 	}
+
+	if (Key == EKeys::BackSpace)
+		TextSearch.PromptPattern.LeftChopInline(1);
+
+	else
+	{
+		if (InKeyEvent.IsControlDown() || InKeyEvent.IsAltDown())
+			return;
+
+		const TCHAR Char = FUMInputHelpers::GetCharFromKeyEvent(InKeyEvent);
+		if (!FChar::IsPrint(Char))
+			return;
+
+		TextSearch.PromptPattern.AppendChar(Char);
+	}
+
+	PreviewSearchMatch(SlateApp);
 }
-void UVimTextEditorSubsystem::SelectInsideWord()
+
+void UVimTextEditorSubsystem::EndSearchPrompt(FSlateApplication& SlateApp, const bool bRestoreCursor)
 {
-	SelectInsideWord(FSlateApplication::Get());
+	TextSearch.bIsPromptActive = false;
+
+	const TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
+	VimProc->Unpossess(this);
+	VimProc->ResetBufferVisualizer(SlateApp);
+
+	if (bRestoreCursor)
+	{
+		if (const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex())
+			PlaceBlockCursor(*LineIndex, TextSearch.OriginAbs);
+	}
 }
 
-bool UVimTextEditorSubsystem::SelectInsideWord(FSlateApplication& SlateApp)
+void UVimTextEditorSubsystem::PreviewSearchMatch(FSlateApplication& SlateApp)
 {
-	FString Text;
-	if (!GetActiveEditableTextContent(Text))
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return;
+
+	// Typing on narrows down the previous keystroke's matches (see Update)
+	ActiveEditableSearchIndex.Update(*LineIndex, TextSearch.PromptPattern, false);
+
+	const int32 MatchIndex = ActiveEditableSearchIndex.FindMatchFrom(
+		TextSearch.OriginAbs, !TextSearch.bPromptBackward);
+
+	if (MatchIndex == INDEX_NONE)
+		PlaceBlockCursor(*LineIndex, TextSearch.OriginAbs);
+	else
+		SelectTextNative(
+			LineIndex->ToTextLocation(ActiveEditableSearchIndex.GetMatchStart(MatchIndex)),
+			LineIndex->ToTextLocation(ActiveEditableSearchIndex.GetMatchEnd(MatchIndex)));
+
+	ShowSearchPrompt(SlateApp, MatchIndex);
+}
+
+void UVimTextEditorSubsystem::ShowSearchPrompt(FSlateApplication& SlateApp, const int32 MatchIndex)
+{
+	FString Prompt = (TextSearch.bPromptBackward ? TEXT("?") : TEXT("/")) + TextSearch.PromptPattern;
+
+	if (!TextSearch.PromptPattern.IsEmpty())
+		Prompt += MatchIndex == INDEX_NONE
+			? FString(TEXT("  [No Matches]"))
+			: FString::Printf(TEXT("  [%d/%d]"), MatchIndex + 1, ActiveEditableSearchIndex.Num());
+
+	FVimInputProcessor::Get()->ShowInBufferVisualizer(SlateApp, Prompt);
+}
+
+void UVimTextEditorSubsystem::SearchNextMatch(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	const int32 Count = FVimInputProcessor::Get()->ConsumeCountPrefix();
+	if (TextSearch.Pattern.IsEmpty())
+		return;
+
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return;
+
+	const int32 CharAbs = GetCursorCharAbsOffset(SlateApp, *LineIndex);
+	if (CharAbs == INDEX_NONE)
+		return;
+
+	// N goes against the search's direction
+	const bool bForward = TextSearch.bBackward == InKeyEvent.IsShiftDown();
+	JumpToSearchMatch(CharAbs, bForward, Count);
+}
+
+void UVimTextEditorSubsystem::SearchWordUnderCursor(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	const int32 Count = FVimInputProcessor::Get()->ConsumeCountPrefix();
+
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return;
+
+	const int32 CharAbs = GetCursorCharAbsOffset(SlateApp, *LineIndex);
+	if (CharAbs == INDEX_NONE)
+		return;
+
+	// Like Vim, take the first word at or after the cursor on its line.
+	const FString& Text = LineIndex->GetText();
+	int32		   WordPos = CharAbs;
+	while (WordPos < Text.Len() && Text[WordPos] != TEXT('\n')
+		&& !FVimTextEditorUtils::IsWordChar(Text[WordPos]))
+		++WordPos;
+
+	int32 WordStart, WordEnd;
+	if (WordPos >= Text.Len() || Text[WordPos] == TEXT('\n')
+		|| !FVimTextEditorUtils::GetTextObject(Text, WordPos,
+			EUMTextObjectType::Word, false, TCHAR(0), WordStart, WordEnd))
+		return;
+
+	TextSearch.Pattern = Text.Mid(WordStart, WordEnd - WordStart);
+	TextSearch.bBackward = InKeyEvent.GetKey() == EKeys::Three; // #
+	TextSearch.bWholeWord = true;
+
+	// From the word's start, so the word itself is skipped either way.
+	JumpToSearchMatch(WordStart, !TextSearch.bBackward, Count);
+}
+
+bool UVimTextEditorSubsystem::JumpToSearchMatch(const int32 FromAbs, const bool bForward, const int32 Count)
+{
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
 		return false;
 
-	TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
-	FTextLocation				   OriginCursorLocation;
-	if (!GetCursorLocation(SlateApp, OriginCursorLocation))
+	// Only recollected if the text (or the pattern) changed since the last jump
+	ActiveEditableSearchIndex.Update(*LineIndex, TextSearch.Pattern, TextSearch.bWholeWord);
+
+	int32 MatchIndex = ActiveEditableSearchIndex.FindMatchFrom(FromAbs, bForward);
+	if (MatchIndex == INDEX_NONE)
+	{
+		Logger.Print(FString::Printf(TEXT("Pattern not found: %s"), *TextSearch.Pattern));
 		return false;
+	}
+
+	// The matches are sorted, so the remaining jumps are index arithmetic.
+	const int32 NumMatches = ActiveEditableSearchIndex.Num();
+	const int32 Steps = (Count - 1) % NumMatches;
+	MatchIndex = (MatchIndex + (bForward ? Steps : NumMatches - Steps)) % NumMatches;
+
+	return PlaceBlockCursor(*LineIndex, ActiveEditableSearchIndex.GetMatchStart(MatchIndex));
+}
+
+void UVimTextEditorSubsystem::EnterVisualBlockMode(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	const TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
+	VimProc->ConsumeCountPrefix();
+
+	if (EditableWidgetsFocusState != EUMEditableWidgetsFocusState::MultiLine)
+		return;
+
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return;
+
+	const int32 CharAbs = GetCursorCharAbsOffset(SlateApp, *LineIndex);
+	if (CharAbs == INDEX_NONE)
+		return;
+
+	const FTextLocation CharLocation = LineIndex->ToTextLocation(CharAbs);
+	VisualBlock = FUMVisualBlock();
+	VisualBlock.AnchorLine = VisualBlock.CursorLine = CharLocation.GetLineIndex();
+	VisualBlock.AnchorCol = VisualBlock.CursorCol = CharLocation.GetOffset();
+	VisualBlock.bIsActive = true;
+
+	VimProc->SetVimMode(SlateApp, EVimMode::VisualBlock);
+	VimProc->Possess(this, &UVimTextEditorSubsystem::HandleVisualBlockKey);
+	UpdateVisualBlockSelection(SlateApp);
+
+	// The sequence that got us here hides the buffer visualizer right after
+	// this call, so we bring it back on the next tick.
+	GEditor->GetTimerManager()->SetTimerForNextTick([this]() {
+		if (VisualBlock.bIsActive)
+			ShowVisualBlockPrompt(FSlateApplication::Get());
+	});
+}
+
+void UVimTextEditorSubsystem::HandleVisualBlockKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	if (FUMInputHelpers::IsKeyEventModifierOnly(InKeyEvent))
+		return;
+
+	if (VisualBlock.bIsAwaitingEdit)
+	{
+		HandleVisualBlockEditKey(SlateApp, InKeyEvent);
+		return;
+	}
+
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+	{
+		ExitVisualBlockMode(SlateApp, INDEX_NONE);
+		return;
+	}
+
+	const FKey& Key = InKeyEvent.GetKey();
+	const bool	bShift = InKeyEvent.IsShiftDown();
+	const bool	bHasModifiers = InKeyEvent.GetModifierKeys().AnyModifiersDown();
+
+	// The motion's count. A leading 0 is the 0 motion.
+	int32 Digit = 0;
+	if (!bHasModifiers
+		&& (FUMInputHelpers::GetDigitFromKey(Key, Digit)
+			|| (Key == EKeys::Zero && VisualBlock.Count > 0)))
+	{
+		VisualBlock.Count = FMath::Min(VisualBlock.Count * 10 + Digit, 9999);
+		return;
+	}
+	const bool	bHasCount = VisualBlock.Count > 0;
+	const int32 Count = FMath::Max(VisualBlock.Count, 1);
+	VisualBlock.Count = 0;
+
+	const int32			LastLine = LineIndex->GetLineCount() - 1;
+	const int32			CursorLineLen = LineIndex->GetLineLength(VisualBlock.CursorLine);
+	const FVimTextBlock Block = VisualBlock.ToTextBlock();
+
+	if (Key == EKeys::Escape || (Key == EKeys::V && InKeyEvent.IsControlDown()))
+		ExitVisualBlockMode(SlateApp,
+			GetLineCharAbsOffset(*LineIndex, VisualBlock.CursorLine, VisualBlock.CursorCol));
+
+	//						~ Extending the Block ~
+	//
+	// The cursor's column is kept past shorter lines (as Vim's
+	// 'virtualedit=block'), so the block keeps its shape while moving.
+	else if (Key == EKeys::H && !bShift)
+	{
+		VisualBlock.CursorCol = FMath::Max(
+			FMath::Min(VisualBlock.CursorCol, FMath::Max(CursorLineLen - 1, 0)) - Count, 0);
+		VisualBlock.bToLineEnd = false;
+	}
+	else if (Key == EKeys::L && !bShift)
+	{
+		VisualBlock.CursorCol = FMath::Max(VisualBlock.CursorCol,
+			FMath::Min(VisualBlock.CursorCol + Count, CursorLineLen - 1));
+		VisualBlock.bToLineEnd = false;
+	}
+	else if (Key == EKeys::J && !bShift)
+		VisualBlock.CursorLine = FMath::Min(VisualBlock.CursorLine + Count, LastLine);
+
+	else if (Key == EKeys::K && !bShift)
+		VisualBlock.CursorLine = FMath::Max(VisualBlock.CursorLine - Count, 0);
+
+	else if (Key == EKeys::G && bShift)
+		VisualBlock.CursorLine = bHasCount ? FMath::Clamp(Count - 1, 0, LastLine) : LastLine;
+
+	else if (Key == EKeys::Zero && !bHasModifiers)
+	{
+		VisualBlock.CursorCol = 0;
+		VisualBlock.bToLineEnd = false;
+	}
+	else if (Key == EKeys::Four && bShift) // $
+	{
+		VisualBlock.CursorCol = FMath::Max(CursorLineLen - 1, 0);
+		VisualBlock.bToLineEnd = true;
+	}
+	else if (Key == EKeys::O) // o: the opposite corner, O: the other side
+	{
+		Swap(VisualBlock.AnchorCol, VisualBlock.CursorCol);
+		if (!bShift)
+			Swap(VisualBlock.AnchorLine, VisualBlock.CursorLine);
+	}
+
+	//						~ Editing the Block ~
+	//
+	else if ((Key == EKeys::D || Key == EKeys::X || Key == EKeys::Delete) && !bShift)
+	{
+		YankData.SetData(FVimTextEditorUtils::GetBlockText(*LineIndex, Block), EUMYankType::Characterwise);
+		ApplyVisualBlockEdit(SlateApp, EUMBlockEdit::Change, FString());
+		return;
+	}
+	else if (Key == EKeys::Y && !bShift)
+	{
+		YankData.SetData(FVimTextEditorUtils::GetBlockText(*LineIndex, Block), EUMYankType::Characterwise);
+		ExitVisualBlockMode(SlateApp, GetLineCharAbsOffset(*LineIndex, Block.FirstLine, Block.LeftCol));
+		return;
+	}
+	else if (((Key == EKeys::I || Key == EKeys::A) && bShift)
+		|| ((Key == EKeys::C || Key == EKeys::S || Key == EKeys::R) && !bShift))
+	{
+		if (Key == EKeys::I)
+			VisualBlock.PendingEdit = EUMBlockEdit::Insert;
+		else if (Key == EKeys::A)
+			VisualBlock.PendingEdit = EUMBlockEdit::Append;
+		else if (Key == EKeys::R)
+			VisualBlock.PendingEdit = EUMBlockEdit::Replace;
+		else
+		{
+			VisualBlock.PendingEdit = EUMBlockEdit::Change;
+			YankData.SetData(FVimTextEditorUtils::GetBlockText(*LineIndex, Block), EUMYankType::Characterwise);
+		}
+		VisualBlock.bIsAwaitingEdit = true;
+		VisualBlock.EditText.Reset();
+
+		ShowVisualBlockPrompt(SlateApp);
+		return;
+	}
+	else
+		return; // Unhandled, keep the block as is
+
+	if (VisualBlock.bIsActive)
+		UpdateVisualBlockSelection(SlateApp);
+}
+
+void UVimTextEditorSubsystem::HandleVisualBlockEditKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	const FKey& Key = InKeyEvent.GetKey();
+	const TCHAR TypedChar = Key == EKeys::Tab
+		? TEXT('\t')
+		: FUMInputHelpers::GetCharFromKeyEvent(InKeyEvent);
+	const bool bIsTypedChar = !InKeyEvent.IsControlDown() && !InKeyEvent.IsAltDown()
+		&& (FChar::IsPrint(TypedChar) || TypedChar == TEXT('\t'));
+
+	if (VisualBlock.PendingEdit == EUMBlockEdit::Replace)
+	{
+		if (bIsTypedChar)
+			ApplyVisualBlockEdit(SlateApp, EUMBlockEdit::Replace, FString::Chr(TypedChar));
+		else // Aborted (e.g. Escape): back to extending the block
+		{
+			VisualBlock.bIsAwaitingEdit = false;
+			ShowVisualBlockPrompt(SlateApp);
+		}
+		return;
+	}
+
+	// I, A & c take text until it's applied to all lines at once.
+	if (Key == EKeys::Escape || Key == EKeys::Enter)
+	{
+		ApplyVisualBlockEdit(SlateApp, VisualBlock.PendingEdit, VisualBlock.EditText);
+		return;
+	}
+
+	if (Key == EKeys::BackSpace)
+		VisualBlock.EditText.LeftChopInline(1);
+	else if (bIsTypedChar)
+		VisualBlock.EditText.AppendChar(TypedChar);
+	else
+		return;
+
+	ShowVisualBlockPrompt(SlateApp);
+}
+
+void UVimTextEditorSubsystem::ExitVisualBlockMode(FSlateApplication& SlateApp, const int32 CursorAbs)
+{
+	VisualBlock.bIsActive = false;
+	VisualBlock.bIsAwaitingEdit = false;
+
+	const TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
+	VimProc->Unpossess(this);
+	VimProc->ResetBufferVisualizer(SlateApp);
+	VimProc->SetVimMode(SlateApp, EVimMode::Normal);
+
+	if (CursorAbs == INDEX_NONE)
+		return;
+
+	if (const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex())
+		PlaceBlockCursor(*LineIndex, CursorAbs);
+}
+
+void UVimTextEditorSubsystem::UpdateVisualBlockSelection(FSlateApplication& SlateApp)
+{
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+		return;
+
+	const FVimTextBlock Block = VisualBlock.ToTextBlock();
+	const int32			LastLineStart = LineIndex->GetLineStart(Block.LastLine);
+	const int32			LastLineLen = LineIndex->GetLineLength(Block.LastLine);
+
+	const int32 StartAbs = GetLineCharAbsOffset(*LineIndex, Block.FirstLine, Block.LeftCol);
+	const int32 EndAbs = LastLineStart
+		+ (Block.bToLineEnd ? LastLineLen : FMath::Min(Block.RightCol + 1, LastLineLen));
+
+	if (EndAbs > StartAbs)
+		SelectTextNative(LineIndex->ToTextLocation(StartAbs), LineIndex->ToTextLocation(EndAbs));
+	else
+		PlaceBlockCursor(*LineIndex, StartAbs);
+
+	ShowVisualBlockPrompt(SlateApp);
+}
+
+void UVimTextEditorSubsystem::ShowVisualBlockPrompt(FSlateApplication& SlateApp)
+{
+	const FVimTextBlock Block = VisualBlock.ToTextBlock();
+	FString				Prompt;
+
+	if (!VisualBlock.bIsAwaitingEdit)
+		Prompt = FString::Printf(TEXT("-- VISUAL BLOCK -- %dx%s"),
+			Block.LastLine - Block.FirstLine + 1,
+			Block.bToLineEnd ? TEXT("$") : *FString::FromInt(Block.RightCol - Block.LeftCol + 1));
+
+	else if (VisualBlock.PendingEdit == EUMBlockEdit::Replace)
+		Prompt = TEXT("-- VISUAL BLOCK -- r");
+
+	else
+		Prompt = TEXT("-- BLOCK INSERT -- ") + VisualBlock.EditText.Replace(TEXT("\t"), TEXT("  "));
+
+	FVimInputProcessor::Get()->ShowInBufferVisualizer(SlateApp, Prompt);
+}
+
+void UVimTextEditorSubsystem::ApplyVisualBlockEdit(FSlateApplication& SlateApp, const EUMBlockEdit Edit, const FString& InText)
+{
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!LineIndex)
+	{
+		ExitVisualBlockMode(SlateApp, INDEX_NONE);
+		return;
+	}
+
+	const FVimTextBlock Block = VisualBlock.ToTextBlock();
+
+	int32	Start, End;
+	FString Replacement;
+	if (FVimTextEditorUtils::BuildBlockEdit(*LineIndex, Block, Edit, InText, Start, End, Replacement))
+	{
+		SelectTextNative(LineIndex->ToTextLocation(Start), LineIndex->ToTextLocation(End));
+		InsertTextAtCursor(SlateApp, FText::FromString(Replacement));
+	}
+
+	// Land on the block's top-left corner (or right after it, for A)
+	const FVimTextLineIndex* EditedIndex = GetActiveEditableLineIndex();
+	if (!EditedIndex)
+	{
+		ExitVisualBlockMode(SlateApp, INDEX_NONE);
+		return;
+	}
+
+	int32 Col = Block.LeftCol;
+	if (Edit == EUMBlockEdit::Append)
+		Col = Block.bToLineEnd
+			? EditedIndex->GetLineLength(Block.FirstLine) - 1
+			: Block.RightCol + InText.Len();
+	ExitVisualBlockMode(SlateApp, GetLineCharAbsOffset(*EditedIndex, Block.FirstLine, Col));
+}
+
+int32 UVimTextEditorSubsystem::GetLineCharAbsOffset(const FVimTextLineIndex& LineIndex, const int32 Line, const int32 Col)
+{
+	return LineIndex.GetLineStart(Line)
+		+ FMath::Clamp(Col, 0, FMath::Max(LineIndex.GetLineLength(Line) - 1, 0));
+}
+
+void UVimTextEditorSubsystem::OnCommandBoundary()
+{
+	FVimTextUndoHistory*	 UndoHistory = GetActiveUndoHistory();
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!UndoHistory || !LineIndex)
+		return;
+
+	UndoHistory->EndGroup(*LineIndex);
+	UndoHistory->BeginGroup(*LineIndex);
+}
+
+void UVimTextEditorSubsystem::UndoOrRedo(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	const int32				 Count = FVimInputProcessor::Get()->ConsumeCountPrefix();
+	FVimTextUndoHistory*	 UndoHistory = GetActiveUndoHistory();
+	const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+	if (!UndoHistory || !LineIndex)
+		return;
+
+	const bool bUndo = InKeyEvent.GetKey() == EKeys::U;
+	UndoHistory->EndGroup(*LineIndex); // Whatever preceded is undoable too
+
+	// Nothing recorded here yet (e.g. edited before we tracked it): the
+	// widget's own undo stack is all there is.
+	if (UndoHistory->IsEmpty())
+	{
+		for (int32 i = 0; i < Count; ++i)
+			FUMEditorCommands::UndoRedo(SlateApp, InKeyEvent);
+
+		// Refetched, as the native undo may have moved the focus on
+		UndoHistory = GetActiveUndoHistory();
+		LineIndex = GetActiveEditableLineIndex();
+		if (UndoHistory && LineIndex)
+			UndoHistory->BeginGroup(*LineIndex); // Not a change of ours either
+		return;
+	}
 
-	// We need to compensate by 1 in case we're right aligned.
-	const int32 OffsetAdj = IsCursorAlignedRight(SlateApp)
-			// Also checking we're not at beginning of document as the adjustment
-			// should be different in that case.
-			&& !IsCursorAtBeginningOfDocument(SlateApp, true)
-		? 1
-		: 0;
+	int32 CursorAbs = INDEX_NONE;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVimTextUndoStep* Step = bUndo ? UndoHistory->Undo() : UndoHistory->Redo();
+		if (!Step)
+			break;
 
-	int32 CurrentAbs = FVimTextEditorUtils::TextLocationToAbsoluteOffset(
-		Text, FTextLocation(OriginCursorLocation.GetLineIndex(), OriginCursorLocation.GetOffset() - OffsetAdj));
+		const FString& From = bUndo ? Step->Inserted : Step->Removed;
+		const FString& To = bUndo ? Step->Removed : Step->Inserted;
 
-	TPair<int32, int32> WordBoundaries;
-	if (!FVimTextEditorUtils::GetAbsWordBoundaries(Text, CurrentAbs, WordBoundaries, false /*Don't include trailing spaces*/))
-		return false;
+		// Edited behind our back (e.g. by the editor); the offsets no longer apply
+		const FString& Text = LineIndex->GetText();
+		if (Step->Start + From.Len() > Text.Len()
+			|| FCString::Strncmp(*Text + Step->Start, *From, From.Len()) != 0)
+		{
+			Logger.Print("Undo history is out of sync; cleared", ELogVerbosity::Warning);
+			UndoHistory->Reset();
+			break;
+		}
 
-	// Get Beginning & End Text Locations
-	FTextLocation WordStart;
-	FVimTextEditorUtils::AbsoluteOffsetToTextLocation(Text, WordBoundaries.Key, WordStart);
-	if (!WordStart.IsValid())
-		return false;
-	FTextLocation WordEnd;
-	FVimTextEditorUtils::AbsoluteOffsetToTextLocation(Text, WordBoundaries.Value, WordEnd);
-	if (!WordEnd.IsValid())
-		return false;
+		SelectTextNative(LineIndex->ToTextLocation(Step->Start),
+			LineIndex->ToTextLocation(Step->Start + From.Len()));
+		InsertTextAtCursor(SlateApp, FText::FromString(To));
+		CursorAbs = Step->Start;
+
+		LineIndex = GetActiveEditableLineIndex();
+		if (!LineIndex)
+			return;
+	}
 
-	VimProc->SetVimMode(SlateApp, EVimMode::Visual);
-	SelectTextInRange(SlateApp, WordStart, WordEnd,
-		true, /* Jump to Start of Boundary */
-		true /*Ignore Set Cursor to Default to Align properly*/);
+	if (CursorAbs == INDEX_NONE)
+		Logger.Print(bUndo ? "Already at oldest change" : "Already at newest change");
+	else
+		PlaceBlockCursor(*LineIndex, FMath::Min(CursorAbs, FMath::Max(LineIndex->GetText().Len() - 1, 0)));
 
-	return true;
+	UndoHistory->BeginGroup(*LineIndex); // Our own replacements aren't a change
 }
 
 bool UVimTextEditorSubsystem::GoToTextLocation(FSlateApplication& SlateApp, const FTextLocation& InTextLocation)
@@ -3306,23 +4286,19 @@ void UVimTextEditorSubsystem::YankCharacter(FSlateApplication& SlateApp, const T
 	}
 }
 
-void UVimTextEditorSubsystem::YankLine(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
-{
-	FString Text = "";
-	if (GetActiveEditableTextContent(Text, true /*GetCurrLine if Multi*/))
-		YankData.SetData(Text, EUMYankType::Linewise);
-}
-
 void UVimTextEditorSubsystem::Paste(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
 {
+	// Counted pastes (e.g. 10p) are built into one payload & inserted at once.
+	const int32 Count = FVimInputProcessor::Get()->ConsumeCountPrefix();
+
 	switch (YankData.GetType())
 	{
 		case EUMYankType::Characterwise:
-			HandlePasteCharacterwise(SlateApp, InSequence);
+			HandlePasteCharacterwise(SlateApp, InSequence, Count);
 			break;
 
 		case EUMYankType::Linewise:
-			HandlePasteLinewise(SlateApp, InSequence);
+			HandlePasteLinewise(SlateApp, InSequence, Count);
 			break;
 
 		default:
@@ -3330,10 +4306,11 @@ void UVimTextEditorSubsystem::Paste(FSlateApplication& SlateApp, const TArray<FI
 	}
 }
 
-void UVimTextEditorSubsystem::HandlePasteCharacterwise(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
+void UVimTextEditorSubsystem::HandlePasteCharacterwise(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence, const int32 Count)
 {
 	const TSharedRef<FVimInputProcessor> InputProc = FVimInputProcessor::Get();
-	const FText							 TextToPaste = FText::FromString(YankData.GetText(EditableWidgetsFocusState));
+	const FText							 TextToPaste = FText::FromString(
+		 FVimTextEditorUtils::RepeatText(YankData.GetText(EditableWidgetsFocusState), Count));
 
 	switch (CurrentVimMode)
 	{
@@ -3376,7 +4353,7 @@ void UVimTextEditorSubsystem::HandlePasteCharacterwiseVisualMode(FSlateApplicati
 	InputProc->SetVimMode(SlateApp, EVimMode::Normal);
 }
 
-void UVimTextEditorSubsystem::HandlePasteLinewise(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
+void UVimTextEditorSubsystem::HandlePasteLinewise(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence, const int32 Count)
 {
 	const TSharedRef<FVimInputProcessor> InputProc = FVimInputProcessor::Get();
 	const FInputChord					 LastChord = InSequence.Last();
@@ -3385,7 +4362,10 @@ void UVimTextEditorSubsystem::HandlePasteLinewise(FSlateApplication& SlateApp, c
 	AppendNewLine(SlateApp,
 		FUMInputHelpers::GetKeyEventFromKey(FKey(), bIsShiftDown));
 
-	const FString TextToPaste = YankData.GetText(EditableWidgetsFocusState);
+	// Multi-Lines get a line per count (SingleLines can only extend theirs)
+	const FString TextToPaste = FVimTextEditorUtils::RepeatText(
+		YankData.GetText(EditableWidgetsFocusState), Count,
+		EditableWidgetsFocusState == EUMEditableWidgetsFocusState::MultiLine ? TEXT("\n") : TEXT(""));
 
 	InsertTextAtCursor(SlateApp, FText::FromString(TextToPaste));
 
@@ -3417,15 +4397,10 @@ bool UVimTextEditorSubsystem::IsMultiChildOfConsole(const TSharedRef<SMultiLineE
 	return false;
 }
 
-void UVimTextEditorSubsystem::YankInsideWord(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
-{
-	if (SelectInsideWord(SlateApp))
-		YankCharacter(SlateApp, InSequence);
-}
-
 void UVimTextEditorSubsystem::ReplaceCharacter(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence)
 {
 	const TSharedRef<FVimInputProcessor> VimProc = FVimInputProcessor::Get();
+	ReplaceCount = VimProc->ConsumeCountPrefix(); // e.g. 50r- : one insertion
 	AssignEditableBorder(false, EVimMode::Insert); // Sim Insert border
 	VimProc->Possess(this, &UVimTextEditorSubsystem::ReplaceCharacterSingle);
 }
@@ -3438,15 +4413,29 @@ void UVimTextEditorSubsystem::ReplaceCharacterSingle(FSlateApplication& SlateApp
 	const TCHAR Char = InKeyEvent.GetCharacter();
 	if (FChar::IsPrint(Char)) // Ignore and abort if none-printable like Escape.
 	{
-		DeleteCurrentSelection(SlateApp, false /*Don't yank*/);
+		const FVimTextLineIndex* LineIndex = GetActiveEditableLineIndex();
+		const int32				 CharAbs = LineIndex ? GetCursorCharAbsOffset(SlateApp, *LineIndex) : INDEX_NONE;
+		const int32				 Line = CharAbs != INDEX_NONE ? LineIndex->ToTextLocation(CharAbs).GetLineIndex() : 0;
 
-		FString CharStr = FString::Chr(Char);
-		if (!InKeyEvent.IsShiftDown())
-			CharStr = CharStr.ToLower();
-		InsertTextAtCursor(SlateApp, FText::FromString(CharStr));
+		// As in Vim, nothing is replaced if the line hasn't enough chars left.
+		if (CharAbs != INDEX_NONE
+			&& CharAbs + ReplaceCount <= LineIndex->GetLineStart(Line) + LineIndex->GetLineLength(Line))
+		{
+			// Select all the chars to replace, then swap them in one go.
+			SelectTextNative(LineIndex->ToTextLocation(CharAbs),
+				LineIndex->ToTextLocation(CharAbs + ReplaceCount));
+			DeleteCurrentSelection(SlateApp, false /*Don't yank*/);
 
-		ToggleReadOnly();
-		SetCursorSelectionToDefaultLocation(SlateApp);
+			FString CharStr = FString::Chr(Char);
+			if (!InKeyEvent.IsShiftDown())
+				CharStr = CharStr.ToLower();
+			InsertTextAtCursor(SlateApp,
+				FText::FromString(FVimTextEditorUtils::RepeatText(CharStr, ReplaceCount)));
+
+			ToggleReadOnly();
+			if (const FVimTextLineIndex* EditedIndex = GetActiveEditableLineIndex())
+				PlaceBlockCursor(*EditedIndex, CharAbs + ReplaceCount - 1); // The last one
+		}
 	}
 
 	AssignEditableBorder(); // Return to default per Vim Mode border
@@ -3612,6 +4601,8 @@ void UVimTextEditorSubsystem::BindCommands()
 	TSharedRef<FVimInputProcessor> VimInputProcessor = FVimInputProcessor::Get();
 	VimInputProcessor->OnVimModeChanged.AddUObject(
 		this, &UVimTextEditorSubsystem::OnVimModeChanged);
+	VimInputProcessor->OnCommandBoundary.AddUObject(
+		this, &UVimTextEditorSubsystem::OnCommandBoundary);
 
 	TWeakObjectPtr<UVimTextEditorSubsystem> WeakTextSubsystem =
 		MakeWeakObjectPtr(this);
@@ -3728,21 +4719,6 @@ void UVimTextEditorSubsystem::BindCommands()
 		&UVimTextEditorSubsystem::ShiftDeleteNormalMode,
 		TArray<EVimMode>({ EVimMode::Normal }));
 
-	// Delete current line
-	VimInputProcessor->AddKeyBinding_KeyEvent(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, EKeys::D },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::DeleteLine,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	VimInputProcessor->AddKeyBinding_KeyEvent(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, FInputChord(EModifierKey::Shift, EKeys::Four /*Shift+$*/) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::DeleteToEndOfLine,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
 	VimInputProcessor->AddKeyBinding_KeyEvent(
 		EUMBindingContext::TextEditing,
 		{ FInputChord(EModifierKey::Shift, EKeys::D) },
@@ -3757,233 +4733,23 @@ void UVimTextEditorSubsystem::BindCommands()
 		&UVimTextEditorSubsystem::DeleteLineVisualMode,
 		TArray<EVimMode>({ EVimMode::Visual, EVimMode::VisualLine }));
 
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, EKeys::I, EKeys::W },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::DeleteInsideWord,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, EKeys::K },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::DeleteUpOrDown,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, EKeys::J },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::DeleteUpOrDown,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// ============================================================================
-	// DELETE COMMANDS (d + motion)
-	// These bindings handle deletion operations combined with different motions
-	// ============================================================================
-
-	// Delete word (dw) - Deletes from cursor to start of next word
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ FInputChord(EKeys::D), FInputChord(EKeys::W) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Delete WORD (dW) - Deletes from cursor to start of next WORD (space-delimited)
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, FInputChord(EModifierKey::Shift, EKeys::W) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Delete to end of word (de) - Deletes from cursor to end of current word
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, EKeys::E },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Delete to end of WORD (dE) - Deletes from cursor to end of current WORD
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, FInputChord(EModifierKey::Shift, EKeys::E) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Delete backward to start of word (db) - Deletes from cursor back to start of word
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, EKeys::B },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Delete backward to start of WORD (dB) - Deletes from cursor back to start of WORD
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, FInputChord(EModifierKey::Shift, EKeys::B) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Delete to end of previous sentence (dge) - Deletes from cursor to end of prev sentence
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, EKeys::G, EKeys::E },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Delete to end of previous SENTENCE (dgE) - Deletes from cursor to end of prev SENTENCE
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::D, EKeys::G, FInputChord(EModifierKey::Shift, EKeys::E) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// ============================================================================
-	// CHANGE COMMANDS (c + motion)
-	// These bindings handle change operations (delete + insert) with different motions
-	// ============================================================================
-
-	// Change word (cw) - Changes from cursor to start of next word
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ FInputChord(EKeys::C), FInputChord(EKeys::W) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Change WORD (cW) - Changes from cursor to start of next WORD (space-delimited)
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, FInputChord(EModifierKey::Shift, EKeys::W) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Change to end of word (ce) - Changes from cursor to end of current word
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, EKeys::E },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Change to end of WORD (cE) - Changes from cursor to end of current WORD
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, FInputChord(EModifierKey::Shift, EKeys::E) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Change backward to start of word (cb) - Changes from cursor back to start of word
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, EKeys::B },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Change backward to start of WORD (cB) - Changes from cursor back to start of WORD
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, FInputChord(EModifierKey::Shift, EKeys::B) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Change to end of previous sentence (cge) - Changes from cursor to end of prev sentence
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, EKeys::G, EKeys::E },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Change to end of previous SENTENCE (cgE) - Changes from cursor to end of prev SENTENCE
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, EKeys::G, FInputChord(EModifierKey::Shift, EKeys::E) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// ============================================================================
-	// YANK COMMANDS (y + motion)
-	// These bindings handle yank (copy) operations combined with different motions
-	// ============================================================================
-
-	// Yank word (yw) - Yanks from cursor to start of next word
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ FInputChord(EKeys::Y), FInputChord(EKeys::W) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Yank WORD (yW) - Yanks from cursor to start of next WORD (space-delimited)
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::Y, FInputChord(EModifierKey::Shift, EKeys::W) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Yank to end of word (ye) - Yanks from cursor to end of current word
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::Y, EKeys::E },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Yank to end of WORD (yE) - Yanks from cursor to end of current WORD
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::Y, FInputChord(EModifierKey::Shift, EKeys::E) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Yank backward to start of word (yb) - Yanks from cursor back to start of word
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::Y, EKeys::B },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Yank backward to start of WORD (yB) - Yanks from cursor back to start of WORD
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::Y, FInputChord(EModifierKey::Shift, EKeys::B) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Yank to end of previous sentence (yge) - Yanks from cursor to end of prev sentence
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::Y, EKeys::G, EKeys::E },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	// Yank to end of previous SENTENCE (ygE) - Yanks from cursor to end of prev SENTENCE
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::Y, EKeys::G, FInputChord(EModifierKey::Shift, EKeys::E) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ActionToMotion,
-		TArray<EVimMode>({ EVimMode::Normal }));
+	// Operators: d, c, y, > & <; whatever follows them (counts, motions, text
+	// objects) is parsed by the operator itself rather than bound per combo.
+	for (const FInputChord& Operator : {
+			 FInputChord(EKeys::D),
+			 FInputChord(EKeys::C),
+			 FInputChord(EKeys::Y),
+			 FInputChord(EModifierKey::Shift, EKeys::Period), // >
+			 FInputChord(EModifierKey::Shift, EKeys::Comma),  // <
+		 })
+	{
+		VimInputProcessor->AddKeyBinding_Sequence(
+			EUMBindingContext::TextEditing,
+			{ Operator },
+			WeakTextSubsystem,
+			&UVimTextEditorSubsystem::BeginOperator,
+			TArray<EVimMode>({ EVimMode::Normal }));
+	}
 
 	// Append New Line (After & Before the current Line)
 	//
@@ -4026,33 +4792,12 @@ void UVimTextEditorSubsystem::BindCommands()
 		&UVimTextEditorSubsystem::ChangeVisualMode,
 		TArray<EVimMode>({ EVimMode::Visual, EVimMode::VisualLine }));
 
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, EKeys::I, EKeys::W },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ChangeInsideWord,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
-	VimInputProcessor->AddKeyBinding_KeyEvent(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, EKeys::C },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ChangeEntireLine,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
 	VimInputProcessor->AddKeyBinding_KeyEvent(
 		EUMBindingContext::TextEditing,
 		{ FInputChord(EModifierKey::Shift, EKeys::C) },
 		WeakTextSubsystem,
 		&UVimTextEditorSubsystem::ChangeToEndOfLine,
 		TArray<EVimMode>({ EVimMode::Normal }));
-
-	VimInputProcessor->AddKeyBinding_KeyEvent(
-		EUMBindingContext::TextEditing,
-		{ EKeys::C, FInputChord(EModifierKey::Shift, EKeys::Four /*Shift+$*/) },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::ChangeToEndOfLine,
-		TArray<EVimMode>({ EVimMode::Normal }));
 	//
 	//							~ Change ~
 
@@ -4123,13 +4868,6 @@ void UVimTextEditorSubsystem::BindCommands()
 
 	// Yanking / Pasting Related
 	//
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::Y, EKeys::Y },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::YankLine,
-		TArray<EVimMode>({ EVimMode::Normal }) /* Only available in Normal Mode */);
-
 	VimInputProcessor->AddKeyBinding_Sequence(
 		EUMBindingContext::TextEditing,
 		{ EKeys::Y },
@@ -4149,23 +4887,13 @@ void UVimTextEditorSubsystem::BindCommands()
 		WeakTextSubsystem,
 		&UVimTextEditorSubsystem::Paste);
 
-	VimInputProcessor->AddKeyBinding_Sequence(
-		EUMBindingContext::TextEditing,
-		{ EKeys::Y, EKeys::I, EKeys::W },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::YankInsideWord,
-		TArray<EVimMode>({ EVimMode::Normal }));
-
 	//
 	// Yanking / Pasting Related
 
-	VimInputProcessor->AddKeyBinding_NoParam(
-		EUMBindingContext::TextEditing,
-		// Not V + I + W because it will collide with entering Visual Mode +
-		// we're already restricted to visual mode for this so it's ok.
-		{ EKeys::I, EKeys::W },
-		WeakTextSubsystem,
-		&UVimTextEditorSubsystem::SelectInsideWord,
+	// Not V + I + W because it will collide with entering Visual Mode +
+	// we're already restricted to visual mode for this so it's ok.
+	BindTextObjects({},
+		&UVimTextEditorSubsystem::SelectTextObjectVisualMode,
 		TArray<EVimMode>({ EVimMode::Visual, EVimMode::VisualLine }));
 
 	// Jump to Start of Line
@@ -4200,6 +4928,71 @@ void UVimTextEditorSubsystem::BindCommands()
 		{ FInputChord(EModifierKey::Shift, EKeys::F) },
 		WeakTextSubsystem,
 		&UVimTextEditorSubsystem::BeginFindChar);
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::TextEditing,
+		{ FInputChord(EModifierKey::Control, EKeys::V) },
+		WeakTextSubsystem,
+		&UVimTextEditorSubsystem::EnterVisualBlockMode,
+		TArray<EVimMode>({ EVimMode::Normal }));
+
+	// Undo & Redo whole commands (over the Generic native Ctrl+Z & Ctrl+Y)
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::TextEditing,
+		{ EKeys::U },
+		WeakTextSubsystem,
+		&UVimTextEditorSubsystem::UndoOrRedo,
+		TArray<EVimMode>({ EVimMode::Normal }));
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::TextEditing,
+		{ FInputChord(EModifierKey::Control, EKeys::R) },
+		WeakTextSubsystem,
+		&UVimTextEditorSubsystem::UndoOrRedo,
+		TArray<EVimMode>({ EVimMode::Normal }));
+
+	// Search: / ? n N * #
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::TextEditing,
+		{ EKeys::Slash },
+		WeakTextSubsystem,
+		&UVimTextEditorSubsystem::BeginSearch,
+		TArray<EVimMode>({ EVimMode::Normal }));
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::TextEditing,
+		{ FInputChord(EModifierKey::Shift, EKeys::Slash) /* i.e. ? */ },
+		WeakTextSubsystem,
+		&UVimTextEditorSubsystem::BeginSearch,
+		TArray<EVimMode>({ EVimMode::Normal }));
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::TextEditing,
+		{ EKeys::N },
+		WeakTextSubsystem,
+		&UVimTextEditorSubsystem::SearchNextMatch,
+		TArray<EVimMode>({ EVimMode::Normal }));
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::TextEditing,
+		{ FInputChord(EModifierKey::Shift, EKeys::N) },
+		WeakTextSubsystem,
+		&UVimTextEditorSubsystem::SearchNextMatch,
+		TArray<EVimMode>({ EVimMode::Normal }));
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::TextEditing,
+		{ FInputChord(EModifierKey::Shift, EKeys::Eight) /* i.e. * */ },
+		WeakTextSubsystem,
+		&UVimTextEditorSubsystem::SearchWordUnderCursor,
+		TArray<EVimMode>({ EVimMode::Normal }));
+
+	VimInputProcessor->AddKeyBinding_KeyEvent(
+		EUMBindingContext::TextEditing,
+		{ FInputChord(EModifierKey::Shift, EKeys::Three) /* i.e. # */ },
+		WeakTextSubsystem,
+		&UVimTextEditorSubsystem::SearchWordUnderCursor,
+		TArray<EVimMode>({ EVimMode::Normal }));
 }
 
 void UVimTextEditorSubsystem::DebugMultiLineCursorLocation(bool bIsPreNavigation, bool bIgnoreDelay)
@@ -1,5 +1,8 @@
 #include "VimTextEditorUtils.h"
 #include "VimEditorSubsystem.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/IConsoleManager.h"
+#include "Internationalization/Regex.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogVimTextEditorUtils, Log, All); // Dev
 FUMLogger FVimTextEditorUtils::Logger(&LogVimTextEditorUtils);
@@ -12,491 +15,554 @@ FUMLogger FVimTextEditorUtils::Logger(&LogVimTextEditorUtils);
 // For "small word" motions (w, b) we treat alphanumeric and underscore as word characters.
 bool FVimTextEditorUtils::IsWordChar(TCHAR Char)
 {
-	return FChar::IsAlnum(Char) || Char == TEXT('_');
+	return FTextCore::IsWordChar(Char);
 }
 
 EUMCharType FVimTextEditorUtils::GetCharType(const FString& Text, int32 Position)
 {
-	if (Position < 0 || Position >= Text.Len())
-		return EUMCharType::Whitespace; // Default for out-of-bounds
-
-	if (FChar::IsWhitespace(Text[Position]))
-		return EUMCharType::Whitespace;
-	else if (IsWordChar(Text[Position]))
-		return EUMCharType::Word;
-	else
-		return EUMCharType::Symbol;
+	return FTextCore::GetCharType(ToView(Text), Position);
 }
 
 int32 FVimTextEditorUtils::SkipCharType(const FString& Text, int32 StartPos, int32 Direction, EUMCharType TypeToSkip)
 {
-	const int32 Len = Text.Len();
-	int32		CurrentPos = StartPos;
-
-	if (Direction > 0)
-	{
-		// Forward direction
-		while (CurrentPos < Len && GetCharType(Text, CurrentPos) == TypeToSkip)
-			++CurrentPos;
-	}
-	else
-	{
-		// Backward direction
-		while (CurrentPos > 0 && GetCharType(Text, CurrentPos - 1) == TypeToSkip)
-			--CurrentPos;
-	}
-
-	return CurrentPos;
+	return FTextCore::SkipCharType(ToView(Text), StartPos, Direction, TypeToSkip);
 }
 
 int32 FVimTextEditorUtils::SkipNonWhitespace(const FString& Text, int32 StartPos, int32 Direction)
 {
-	const int32 Len = Text.Len();
-	int32		CurrentPos = StartPos;
-
-	if (Direction > 0)
-	{
-		// Forward direction
-		while (CurrentPos < Len && !FChar::IsWhitespace(Text[CurrentPos]))
-			++CurrentPos;
-	}
-	else
-	{
-		// Backward direction
-		while (CurrentPos > 0 && !FChar::IsWhitespace(Text[CurrentPos - 1]))
-			--CurrentPos;
-	}
-
-	return CurrentPos;
+	return FTextCore::SkipNonWhitespace(ToView(Text), StartPos, Direction);
 }
 
 int32 FVimTextEditorUtils::SkipWhitespace(const FString& Text, int32 StartPos, int32 Direction)
 {
-	return SkipCharType(Text, StartPos, Direction, EUMCharType::Whitespace);
+	return FTextCore::SkipWhitespace(ToView(Text), StartPos, Direction);
 }
 
 int32 FVimTextEditorUtils::FindNextWordBoundary(const FString& Text, int32 CurrentPos, bool bBigWord)
 {
-	if (bBigWord)
-		return FindNextBigWordBoundary(Text, CurrentPos);
-	else
-		return FindNextSmallWordBoundary(Text, CurrentPos);
+	return FTextCore::FindNextWordBoundary(ToView(Text), CurrentPos, bBigWord);
 }
 
 int32 FVimTextEditorUtils::FindPreviousWordBoundary(const FString& Text, int32 CurrentPos, bool bBigWord)
 {
-	if (bBigWord)
-		return FindPreviousBigWordBoundary(Text, CurrentPos);
-	else
-		return FindPreviousSmallWordBoundary(Text, CurrentPos);
+	return FTextCore::FindPreviousWordBoundary(ToView(Text), CurrentPos, bBigWord);
 }
 
 int32 FVimTextEditorUtils::FindNextBigWordBoundary(const FString& Text, int32 CurrentPos)
 {
-	const int32 Len = Text.Len();
-
-	// Handle boundary cases
-	if (CurrentPos >= Len - 1)
-		return Len;
+	return FTextCore::FindNextBigWordBoundary(ToView(Text), CurrentPos);
+}
 
-	int32 NewPos = CurrentPos + 1; // Always make progress
+int32 FVimTextEditorUtils::FindPreviousBigWordBoundary(const FString& Text, int32 CurrentPos)
+{
+	return FTextCore::FindPreviousBigWordBoundary(ToView(Text), CurrentPos);
+}
 
-	// For big words, only care about whitespace vs. non-whitespace
-	bool bCurrentIsWhitespace = (CurrentPos < Len)
-		&& FChar::IsWhitespace(Text[CurrentPos]);
+int32 FVimTextEditorUtils::FindNextSmallWordBoundary(const FString& Text, int32 CurrentPos)
+{
+	return FTextCore::FindNextSmallWordBoundary(ToView(Text), CurrentPos);
+}
 
-	if (bCurrentIsWhitespace)
-	{
-		// Skip all consecutive whitespace
-		NewPos = SkipWhitespace(Text, NewPos, 1);
-	}
-	else
-	{
-		// Skip all consecutive non-whitespace, then any whitespace that follows
-		NewPos = SkipNonWhitespace(Text, NewPos, 1);
-		NewPos = SkipWhitespace(Text, NewPos, 1);
-	}
+int32 FVimTextEditorUtils::FindPreviousSmallWordBoundary(const FString& Text, int32 CurrentPos)
+{
+	return FTextCore::FindPreviousSmallWordBoundary(ToView(Text), CurrentPos);
+}
 
-	return NewPos;
+int32 FVimTextEditorUtils::FindNextWordEnd(const FString& Text, int32 CurrentPos, bool bBigWord)
+{
+	return FTextCore::FindNextWordEnd(ToView(Text), CurrentPos, bBigWord);
 }
 
-int32 FVimTextEditorUtils::FindPreviousBigWordBoundary(const FString& Text, int32 CurrentPos)
+int32 FVimTextEditorUtils::FindPreviousWordEnd(const FString& Text, int32 CurrentPos, bool bBigWord)
 {
-	// Handle boundary cases
-	if (CurrentPos <= 0)
-		return 0;
+	return FTextCore::FindPreviousWordEnd(ToView(Text), CurrentPos, bBigWord);
+}
 
-	int32 NewPos = CurrentPos;
+int32 FVimTextEditorUtils::FindNextBigWordEnd(const FString& Text, int32 CurrentPos)
+{
+	return FTextCore::FindNextBigWordEnd(ToView(Text), CurrentPos);
+}
 
-	// Skip any whitespace backwards
-	NewPos = SkipWhitespace(Text, NewPos, -1);
+int32 FVimTextEditorUtils::FindPreviousBigWordEnd(const FString& Text, int32 CurrentPos)
+{
+	return FTextCore::FindPreviousBigWordEnd(ToView(Text), CurrentPos);
+}
 
-	// If we're now on a non-whitespace character, find the start of this word
-	if (NewPos > 0 && !FChar::IsWhitespace(Text[NewPos - 1]))
-	{
-		NewPos = SkipNonWhitespace(Text, NewPos, -1);
-	}
+int32 FVimTextEditorUtils::FindNextSmallWordEnd(const FString& Text, int32 CurrentPos)
+{
+	return FTextCore::FindNextSmallWordEnd(ToView(Text), CurrentPos);
+}
 
-	return NewPos;
+int32 FVimTextEditorUtils::FindPreviousSmallWordEnd(const FString& Text, int32 CurrentPos)
+{
+	return FTextCore::FindPreviousSmallWordEnd(ToView(Text), CurrentPos);
 }
 
-int32 FVimTextEditorUtils::FindNextSmallWordBoundary(const FString& Text, int32 CurrentPos)
+bool FVimTextEditorUtils::GetAbsWordBoundaries(const FString& Text, int32 CurrentPos, TPair<int32, int32>& OutWordBoundaries, const bool bIncludeTrailingSpaces)
 {
-	const int32 Len = Text.Len();
+	int32 Start, End;
+	if (!FTextCore::GetAbsWordBoundaries(ToView(Text), CurrentPos, Start, End))
+		return false;
+
+	OutWordBoundaries = TPair<int32, int32>(Start, End);
+	return true;
+}
 
-	// Handle boundary cases
-	if (CurrentPos >= Len - 1)
-		return Len;
+bool FVimTextEditorUtils::GetTextObjectFromChord(const FInputChord& InChord, EUMTextObjectType& OutType, TCHAR& OutDelimiter)
+{
+	const FKey& Key = InChord.Key;
+	const bool	bShift = InChord.NeedsShift();
+	OutDelimiter = TEXT('\0');
 
-	int32 NewPos = CurrentPos + 1; // Always make progress
+	if (Key == EKeys::W)
+		OutType = bShift ? EUMTextObjectType::BigWord : EUMTextObjectType::Word;
 
-	// Determine current character type
-	EUMCharType CurrentType = GetCharType(Text, CurrentPos);
-	EUMCharType NextType = GetCharType(Text, NewPos);
+	else if (Key == EKeys::P && !bShift)
+		OutType = EUMTextObjectType::Paragraph;
 
-	// If transitioning to a different type, that's a word boundary
-	if (CurrentType != NextType)
+	else if (Key == EKeys::Apostrophe)
 	{
-		// If moving to whitespace, skip all consecutive whitespace
-		if (NextType == EUMCharType::Whitespace)
-		{
-			NewPos = SkipWhitespace(Text, NewPos, 1);
-		}
+		OutType = EUMTextObjectType::Quote;
+		OutDelimiter = bShift ? TEXT('"') : TEXT('\'');
 	}
-	else
+	else if (Key == EKeys::Tilde && !bShift)
 	{
-		// Still in same type, skip all characters of this type
-		NewPos = SkipCharType(Text, NewPos, 1, CurrentType);
-
-		// Skip any trailing whitespace
-		NewPos = SkipWhitespace(Text, NewPos, 1);
+		OutType = EUMTextObjectType::Quote;
+		OutDelimiter = TEXT('`');
 	}
+	else
+	{
+		OutType = EUMTextObjectType::Bracket;
 
-	return NewPos;
-}
-
-int32 FVimTextEditorUtils::FindPreviousSmallWordBoundary(const FString& Text, int32 CurrentPos)
-{
-	// Handle boundary cases
-	if (CurrentPos <= 0)
-		return 0;
-
-	int32 NewPos = CurrentPos;
-
-	// Skip any trailing whitespace
-	NewPos = SkipWhitespace(Text, NewPos, -1);
+		if (Key == EKeys::B) // b: (), B: {}
+			OutDelimiter = bShift ? TEXT('{') : TEXT('(');
 
-	// If we reached the beginning after skipping whitespace, return 0
-	if (NewPos == 0)
-		return 0;
+		else if (bShift && (Key == EKeys::Nine || Key == EKeys::Zero))
+			OutDelimiter = TEXT('(');
 
-	// Determine the type of character we're on now
-	EUMCharType CurrentType = GetCharType(Text, NewPos - 1);
+		else if (Key == EKeys::LeftBracket || Key == EKeys::RightBracket)
+			OutDelimiter = bShift ? TEXT('{') : TEXT('[');
 
-	// Find the beginning of this character group
-	NewPos = SkipCharType(Text, NewPos, -1, CurrentType);
+		else if (bShift && (Key == EKeys::Comma || Key == EKeys::Period))
+			OutDelimiter = TEXT('<');
 
-	return NewPos;
+		else
+			return false;
+	}
+	return true;
 }
 
-int32 FVimTextEditorUtils::FindNextWordEnd(const FString& Text, int32 CurrentPos, bool bBigWord)
+bool FVimTextEditorUtils::GetTextObject(const FString& Text, int32 CurrentPos, EUMTextObjectType Type, bool bAround, TCHAR Delimiter, int32& OutStart, int32& OutEnd)
 {
-	if (bBigWord)
-		return FindNextBigWordEnd(Text, CurrentPos);
-	else
-		return FindNextSmallWordEnd(Text, CurrentPos);
+	return FTextCore::GetTextObject(ToView(Text), CurrentPos, Type, bAround, Delimiter, OutStart, OutEnd);
 }
 
-int32 FVimTextEditorUtils::FindPreviousWordEnd(const FString& Text, int32 CurrentPos, bool bBigWord)
+bool FVimTextEditorUtils::GetMotionFromChord(const FInputChord& InChord, EUMTextMotion& OutMotion)
 {
-	if (bBigWord)
-		return FindPreviousBigWordEnd(Text, CurrentPos);
-	else
-		return FindPreviousSmallWordEnd(Text, CurrentPos);
+	static const TMap<FInputChord, EUMTextMotion> ChordToMotion = {
+		{ EKeys::H, EUMTextMotion::Left },
+		{ EKeys::L, EUMTextMotion::Right },
+		{ EKeys::K, EUMTextMotion::LinesUp },
+		{ EKeys::J, EUMTextMotion::LinesDown },
+		{ EKeys::W, EUMTextMotion::WordStart },
+		{ FInputChord(EModifierKey::Shift, EKeys::W), EUMTextMotion::BigWordStart },
+		{ EKeys::E, EUMTextMotion::WordEnd },
+		{ FInputChord(EModifierKey::Shift, EKeys::E), EUMTextMotion::BigWordEnd },
+		{ EKeys::B, EUMTextMotion::WordBack },
+		{ FInputChord(EModifierKey::Shift, EKeys::B), EUMTextMotion::BigWordBack },
+		{ EKeys::Zero, EUMTextMotion::LineStart },
+		{ FInputChord(EModifierKey::Shift, EKeys::Four), EUMTextMotion::LineEnd }, // $
+		{ FInputChord(EModifierKey::Shift, EKeys::G), EUMTextMotion::LastLine },
+	};
+
+	const EUMTextMotion* FoundMotion = ChordToMotion.Find(InChord);
+	if (!FoundMotion)
+		return false;
+
+	OutMotion = *FoundMotion;
+	return true;
 }
 
-int32 FVimTextEditorUtils::FindNextBigWordEnd(const FString& Text, int32 CurrentPos)
+bool FVimTextEditorUtils::GetMotionRange(const FString& Text, int32 CurrentPos, EUMTextMotion Motion, int32 Count, TCHAR Target, bool bIsChange, FVimTextRange& OutRange)
 {
-	const int32 Len = Text.Len();
-
-	// Handle boundary cases
-	if (CurrentPos >= Len - 1)
-		return Len - 1;
-
-	int32 NewPos = CurrentPos + 1; // Always make progress from current position
-
-	// Skip any whitespace ahead
-	NewPos = SkipWhitespace(Text, NewPos, 1);
-
-	// If we're not at the end of the text
-	if (NewPos < Len)
-	{
-		// Find the end of the next non-whitespace chunk
-		const int32 EndPos = SkipNonWhitespace(Text, NewPos, 1);
-
-		// If we found a non-whitespace chunk, position at its last character
-		if (EndPos > NewPos)
-			NewPos = EndPos - 1;
-	}
-	else
-	{
-		// If we're at the end, back up to the last non-whitespace character
-		NewPos = Len - 1;
-		while (NewPos > CurrentPos && FChar::IsWhitespace(Text[NewPos]))
-			NewPos--;
-	}
-
-	return NewPos;
+	return FTextCore::GetMotionRange(ToView(Text), CurrentPos, Motion, Count, Target, bIsChange, OutRange);
 }
 
-int32 FVimTextEditorUtils::FindPreviousBigWordEnd(const FString& Text, int32 CurrentPos)
+//------------------------------------------------------------------------------
+// Visual Block
+//------------------------------------------------------------------------------
+
+bool FVimTextEditorUtils::BuildBlockEdit(const FVimTextLineIndex& LineIndex, const FVimTextBlock& Block,
+	EUMBlockEdit Edit, const FString& InText,
+	int32& OutStart, int32& OutEnd, FString& OutReplacement)
 {
-	// Handle boundary cases
-	if (CurrentPos <= 0)
-		return 0;
+	const FString& Text = LineIndex.GetText();
+	const int32	   FirstLine = FMath::Clamp(Block.FirstLine, 0, LineIndex.GetLineCount() - 1);
+	const int32	   LastLine = FMath::Clamp(Block.LastLine, FirstLine, LineIndex.GetLineCount() - 1);
+
+	// Only Change (i.e. d) has any use for no text
+	if (InText.IsEmpty() && Edit != EUMBlockEdit::Change)
+		return false;
 
-	int32 NewPos = CurrentPos;
+	OutStart = LineIndex.GetLineStart(FirstLine);
+	OutEnd = LineIndex.GetLineStart(LastLine) + LineIndex.GetLineLength(LastLine);
 
-	// Skip whitespace backward if we're currently in whitespace
-	if (NewPos < Text.Len() && FChar::IsWhitespace(Text[NewPos]))
-		NewPos = SkipWhitespace(Text, NewPos, -1);
+	OutReplacement.Reset();
+	OutReplacement.Reserve(OutEnd - OutStart
+		+ (LastLine - FirstLine + 1) * (InText.Len() + Block.RightCol + 1));
 
-	// If we're at a non-whitespace character, we need to find the previous word
-	if (NewPos > 0)
+	bool bChanged = false;
+	for (int32 Line = FirstLine; Line <= LastLine; ++Line)
 	{
-		// First go back to the beginning of the current word (if we're in a word)
-		if (NewPos < Text.Len() && !FChar::IsWhitespace(Text[NewPos]))
-		{
-			// If we're in a word, move to its beginning
-			int32 WordBegin = SkipNonWhitespace(Text, NewPos, -1);
+		const TCHAR* LineChars = *Text + LineIndex.GetLineStart(Line);
+		const int32	 LineLen = LineIndex.GetLineLength(Line);
 
-			// If we're already at the beginning of a word, we need to find the previous word
-			if (WordBegin == NewPos)
-			{
-				// Skip any whitespace backwards
-				NewPos = SkipWhitespace(Text, WordBegin, -1);
+		// The block's [Left, Right) on this line
+		const int32 Left = Block.LeftCol;
+		const int32 Right = Block.bToLineEnd
+			? LineLen
+			: FMath::Min(Block.RightCol + 1, LineLen);
 
-				// Find the beginning of the previous word
-				if (NewPos > 0)
+		switch (Edit)
+		{
+			case EUMBlockEdit::Change:
+				if (Left < LineLen)
 				{
-					int32 PrevWordBegin = SkipNonWhitespace(Text, NewPos, -1);
-
-					// Now find the end of that word
-					NewPos = PrevWordBegin;
-					while (NewPos < Text.Len() - 1 && !FChar::IsWhitespace(Text[NewPos + 1]))
-						NewPos++;
+					OutReplacement.AppendChars(LineChars, Left);
+					OutReplacement.Append(InText);
+					OutReplacement.AppendChars(LineChars + Right, LineLen - Right);
+					bChanged = true;
 				}
-			}
-			else
-			{
-				// If we moved to the beginning, go back to find the previous word
-				NewPos = SkipWhitespace(Text, WordBegin, -1);
+				else
+					OutReplacement.AppendChars(LineChars, LineLen);
+				break;
 
-				// Find the beginning of the previous word
-				if (NewPos > 0)
+			case EUMBlockEdit::Insert:
+				if (Left <= LineLen)
 				{
-					int32 PrevWordBegin = SkipNonWhitespace(Text, NewPos, -1);
-
-					// Now find the end of that word
-					NewPos = PrevWordBegin;
-					while (NewPos < Text.Len() - 1 && !FChar::IsWhitespace(Text[NewPos + 1]))
-						NewPos++;
+					OutReplacement.AppendChars(LineChars, Left);
+					OutReplacement.Append(InText);
+					OutReplacement.AppendChars(LineChars + Left, LineLen - Left);
+					bChanged = true;
 				}
-			}
-		}
-		else
-		{
-			// We're on whitespace or at end of string, find the previous non-whitespace character
-			NewPos = SkipWhitespace(Text, NewPos, -1);
+				else
+					OutReplacement.AppendChars(LineChars, LineLen);
+				break;
 
-			// If we found non-whitespace, find the beginning of that word
-			if (NewPos > 0)
+			case EUMBlockEdit::Append:
 			{
-				int32 WordBegin = SkipNonWhitespace(Text, NewPos, -1);
-
-				// Position at the end of this word
-				NewPos = WordBegin;
-				while (NewPos < Text.Len() - 1 && !FChar::IsWhitespace(Text[NewPos + 1]))
-					NewPos++;
+				const int32 At = Block.bToLineEnd ? LineLen : Block.RightCol + 1;
+				const int32 Kept = FMath::Min(At, LineLen);
+				OutReplacement.AppendChars(LineChars, Kept);
+				for (int32 Pad = LineLen; Pad < At; ++Pad)
+					OutReplacement.AppendChar(TEXT(' '));
+				OutReplacement.Append(InText);
+				OutReplacement.AppendChars(LineChars + Kept, LineLen - Kept);
+				bChanged = true;
+				break;
 			}
+
+			case EUMBlockEdit::Replace:
+				if (Left < LineLen)
+				{
+					OutReplacement.AppendChars(LineChars, Left);
+					for (int32 Col = Left; Col < Right; ++Col)
+						OutReplacement.AppendChar(InText[0]);
+					OutReplacement.AppendChars(LineChars + Right, LineLen - Right);
+					bChanged = true;
+				}
+				else
+					OutReplacement.AppendChars(LineChars, LineLen);
+				break;
 		}
+
+		if (Line < LastLine)
+			OutReplacement.AppendChar(TEXT('\n'));
 	}
+	return bChanged;
+}
+
+FString FVimTextEditorUtils::GetBlockText(const FVimTextLineIndex& LineIndex, const FVimTextBlock& Block)
+{
+	const FString& Text = LineIndex.GetText();
+	const int32	   LastLine = FMath::Min(Block.LastLine, LineIndex.GetLineCount() - 1);
 
-	return NewPos;
+	FString BlockText;
+	for (int32 Line = FMath::Max(Block.FirstLine, 0); Line <= LastLine; ++Line)
+	{
+		const int32 LineLen = LineIndex.GetLineLength(Line);
+		const int32 Left = FMath::Min(Block.LeftCol, LineLen);
+		const int32 Right = Block.bToLineEnd
+			? LineLen
+			: FMath::Min(Block.RightCol + 1, LineLen);
+
+		if (Right > Left)
+			BlockText.AppendChars(*Text + LineIndex.GetLineStart(Line) + Left, Right - Left);
+		if (Line < LastLine)
+			BlockText.AppendChar(TEXT('\n'));
+	}
+	return BlockText;
 }
 
-int32 FVimTextEditorUtils::FindNextSmallWordEnd(const FString& Text, int32 CurrentPos)
+FString FVimTextEditorUtils::RepeatText(const FString& InText, const int32 Count, const TCHAR* Separator)
 {
-	const int32 Len = Text.Len();
+	if (Count <= 1)
+		return InText;
 
-	// Handle boundary cases
-	if (CurrentPos >= Len - 1)
-		return Len - 1;
+	const int32 SeparatorLen = FCString::Strlen(Separator);
+	FString		Repeated;
+	Repeated.Reserve(InText.Len() * Count + SeparatorLen * (Count - 1));
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (i > 0)
+			Repeated.AppendChars(Separator, SeparatorLen);
+		Repeated.Append(InText);
+	}
+	return Repeated;
+}
 
-	int32 NewPos = CurrentPos + 1; // Always make progress from current position
+//------------------------------------------------------------------------------
+// Text Location Helpers for Multi-line Editables
+//------------------------------------------------------------------------------
 
-	// Skip any whitespace ahead
-	NewPos = SkipWhitespace(Text, NewPos, 1);
+// Convert a FTextLocation into an absolute offset.
+// Prefer FVimTextLineIndex when converting repeatedly over the same text.
+int32 FVimTextEditorUtils::TextLocationToAbsoluteOffset(const FString& Text, const FTextLocation& Location)
+{
+	return FTextCore::PositionToAbsoluteOffset(ToView(Text),
+		FVimTextPosition{ Location.GetLineIndex(), Location.GetOffset() });
+}
 
-	// If we're not at the end of the text
-	if (NewPos < Len)
-	{
-		// Get the type of the character at our new position
-		EUMCharType CurrentType = GetCharType(Text, NewPos);
+// Convert an absolute offset into a FTextLocation (line index and offset).
+void FVimTextEditorUtils::AbsoluteOffsetToTextLocation(const FString& Text, int32 AbsoluteOffset, FTextLocation& OutLocation)
+{
+	const FVimTextPosition Position =
+		FTextCore::AbsoluteOffsetToPosition(ToView(Text), AbsoluteOffset);
+	OutLocation = FTextLocation(Position.Line, Position.Offset);
+}
 
-		// Find the last character of this type
-		int32 EndPos = NewPos;
-		while (EndPos < Len - 1 && GetCharType(Text, EndPos + 1) == CurrentType)
-			EndPos++;
+//------------------------------------------------------------------------------
+// Line Index
+//------------------------------------------------------------------------------
 
-		NewPos = EndPos;
-	}
-	else
+bool FVimTextLineIndex::Update(const FText& InText)
+{
+	// Same text instance means no edits since; otherwise compare the content
+	// (allocation-free) before paying for a rebuild.
+	if (bIsValid
+		&& (InText.IdenticalTo(MirroredText)
+			|| InText.ToString().Equals(Text, ESearchCase::CaseSensitive)))
 	{
-		// If we're at the end, back up to the last non-whitespace character
-		NewPos = Len - 1;
-		while (NewPos > CurrentPos && FChar::IsWhitespace(Text[NewPos]))
-			NewPos--;
+		MirroredText = InText;
+		return false;
 	}
 
-	return NewPos;
+	MirroredText = InText;
+	Text = InText.ToString();
+	Rebuild();
+	return true;
 }
 
-int32 FVimTextEditorUtils::FindPreviousSmallWordEnd(const FString& Text, int32 CurrentPos)
+void FVimTextLineIndex::Invalidate()
 {
-	if (CurrentPos <= 0)
-		return 0;
+	bIsValid = false;
+}
 
-	int32 Pos = CurrentPos;
+void FVimTextLineIndex::Rebuild()
+{
+	LineStarts.Reset();
+	LineStarts.Add(0);
 
-	// If the cursor is within the text and is on whitespace,
-	// or if we're at the very end, back up over any trailing whitespace.
-	if ((Pos < Text.Len() && FChar::IsWhitespace(Text[Pos])) || Pos == Text.Len())
+	const int32 Len = Text.Len();
+	for (int32 i = 0; i < Len; ++i)
 	{
-		Pos = SkipWhitespace(Text, Pos, -1);
-		if (Pos <= 0)
-			return 0;
-		return Pos - 1;
+		if (Text[i] == TEXT('\n'))
+			LineStarts.Add(i + 1);
 	}
+	++Revision;
+	bIsValid = true;
+}
 
-	// Determine the start of the "current" word.
-	// If the character immediately left of the cursor is whitespace,
-	// then we are already at a word boundary.
-	int32 CurrentWordStart;
-	if (Pos > 0 && FChar::IsWhitespace(Text[Pos - 1]))
-	{
-		CurrentWordStart = Pos;
-	}
-	else
-	{
-		// We're in the middle or at the end of a word.
-		// Get the type of the character immediately left of pos.
-		EUMCharType LeftCharType = GetCharType(Text, Pos - 1);
-
-		// Get the type of the current char we're at, if it doesn't match the
-		// type to the left, that's a word boundary.
-		EUMCharType CurrCharType = GetCharType(Text, Pos);
-		if (LeftCharType != CurrCharType)
-			return Pos - 1;
-
-		// Move backward over characters of this same type.
-		CurrentWordStart = SkipCharType(Text, Pos, -1, LeftCharType);
-	}
+int32 FVimTextLineIndex::GetLineStart(const int32 LineIndex) const
+{
+	return LineStarts[FMath::Clamp(LineIndex, 0, LineStarts.Num() - 1)];
+}
 
-	// Now skip backwards over any whitespace preceding the current word.
-	int32 PrevBoundary = SkipWhitespace(Text, CurrentWordStart, -1);
-	if (PrevBoundary <= 0)
-		return 0;
+int32 FVimTextLineIndex::GetLineLength(const int32 LineIndex) const
+{
+	const int32 Line = FMath::Clamp(LineIndex, 0, LineStarts.Num() - 1);
+	const int32 LineEnd = Line + 1 < LineStarts.Num()
+		? LineStarts[Line + 1] - 1 // Exclude the '\n'
+		: Text.Len();
+	return LineEnd - LineStarts[Line];
+}
 
-	// The previous word is the one whose last character is just before PrevBoundary.
-	// Get that word's type.
-	EUMCharType PrevType = GetCharType(Text, PrevBoundary - 1);
-	// Find the beginning of the previous word group.
-	int32 PrevWordStart = SkipCharType(Text, PrevBoundary, -1, PrevType);
+int32 FVimTextLineIndex::ToAbsoluteOffset(const FTextLocation& Location) const
+{
+	return GetLineStart(Location.GetLineIndex()) + Location.GetOffset();
+}
 
-	// Scan forward from PrevWordStart until the character type changes to get its end.
-	int32 PrevWordEnd = PrevWordStart;
-	while (PrevWordEnd < Text.Len() && GetCharType(Text, PrevWordEnd) == PrevType)
-	{
-		PrevWordEnd++;
-	}
+FTextLocation FVimTextLineIndex::ToTextLocation(int32 AbsoluteOffset) const
+{
+	AbsoluteOffset = FMath::Clamp(AbsoluteOffset, 0, Text.Len());
 
-	// Return the index of the last character of the previous word.
-	return PrevWordEnd - 1;
+	// Last line starting at or before the offset. An offset sitting right on a
+	// line's end (before its '\n') still belongs to that line.
+	const int32 LineIndex = Algo::UpperBound(LineStarts, AbsoluteOffset) - 1;
+	return FTextLocation(LineIndex, AbsoluteOffset - LineStarts[LineIndex]);
 }
 
-bool FVimTextEditorUtils::GetAbsWordBoundaries(const FString& Text, int32 CurrentPos, TPair<int32, int32>& OutWordBoundaries, const bool bIncludeTrailingSpaces)
+//------------------------------------------------------------------------------
+// Search Index
+//------------------------------------------------------------------------------
+
+bool FVimTextSearchIndex::Update(const FVimTextLineIndex& LineIndex, const FString& InPattern, const bool bInWholeWord)
 {
-	const int32 TextLen = Text.Len();
-	if (CurrentPos <= 0 || CurrentPos > TextLen || TextLen <= 0)
+	const bool bIsSameText = bIsValid
+		&& TextRevision == LineIndex.GetRevision()
+		&& bWholeWord == bInWholeWord;
+	if (bIsSameText && Pattern.Equals(InPattern, ESearchCase::CaseSensitive))
 		return false;
 
-	int32 Pos = CurrentPos;
-
-	// if currently on whitespace, the boundaries are until the next and previous
-	// non-space characters
-	if (FChar::IsWhitespace(Text[Pos]))
+	// Smartcase: an uppercase letter makes the search case-sensitive.
+	bool bInIgnoreCase = true;
+	for (const TCHAR Char : InPattern)
 	{
-		const int32 BoundaryStart = SkipWhitespace(Text, Pos, -1);
-		const int32 BoundaryEnd = SkipWhitespace(Text, Pos, 1);
-		OutWordBoundaries = TPair<int32, int32>(BoundaryStart, BoundaryEnd);
-		return true;
+		if (FChar::IsUpper(Char))
+		{
+			bInIgnoreCase = false;
+			break;
+		}
 	}
-	else if (FChar::IsAlnum(Text[Pos]))
+	const bool bIsRegex = IsRegexPattern(InPattern);
+
+	// Typing on extends a literal pattern, whose matches can then only be a
+	// subset of the previous ones: narrow those down instead of a new sweep.
+	const bool bCanNarrow = bIsSameText
+		&& !bWholeWord && !bIsRegex
+		&& bIgnoreCase == bInIgnoreCase
+		&& !Pattern.IsEmpty() && !IsRegexPattern(Pattern)
+		&& InPattern.StartsWith(Pattern, ESearchCase::CaseSensitive);
+
+	Pattern = InPattern;
+	TextRevision = LineIndex.GetRevision();
+	bWholeWord = bInWholeWord;
+	bIgnoreCase = bInIgnoreCase;
+	bIsValid = true;
+
+	if (bCanNarrow)
 	{
-		const int32 BoundaryStart = SkipCharType(Text, Pos, -1, EUMCharType::Word);
-		const int32 BoundaryEnd = SkipCharType(Text, Pos, 1, EUMCharType::Word);
-		OutWordBoundaries = TPair<int32, int32>(BoundaryStart, BoundaryEnd);
+		NarrowLiteralMatches(LineIndex.GetText());
 		return true;
 	}
-	else if (FChar::IsPunct(Text[Pos]))
-	{
-		const int32 BoundaryStart = SkipCharType(Text, Pos, -1, EUMCharType::Symbol);
-		const int32 BoundaryEnd = SkipCharType(Text, Pos, 1, EUMCharType::Symbol);
-		OutWordBoundaries = TPair<int32, int32>(BoundaryStart, BoundaryEnd);
+
+	MatchStarts.Reset();
+	MatchEnds.Reset();
+	if (Pattern.IsEmpty())
 		return true;
-	}
+
+	if (bIsRegex)
+		CollectRegexMatches(LineIndex.GetText());
+	else
+		CollectLiteralMatches(LineIndex.GetText());
 
 	return true;
 }
 
-//------------------------------------------------------------------------------
-// Text Location Helpers for Multi-line Editables
-//------------------------------------------------------------------------------
+void FVimTextSearchIndex::Invalidate()
+{
+	bIsValid = false;
+}
 
-// Convert a FTextLocation into an absolute offset.
-int32 FVimTextEditorUtils::TextLocationToAbsoluteOffset(const FString& Text, const FTextLocation& Location)
+int32 FVimTextSearchIndex::FindMatchFrom(const int32 AbsOffset, const bool bForward) const
 {
-	TArray<FString> Lines;
-	Text.ParseIntoArray(Lines, TEXT("\n"), false /*Consider Empty Lines*/);
-	int32 Offset = 0;
-	for (int32 i = 0; i < Location.GetLineIndex(); ++i)
+	if (MatchStarts.IsEmpty())
+		return INDEX_NONE;
+
+	if (bForward)
 	{
-		Offset += Lines[i].Len() + 1;
+		const int32 Next = Algo::UpperBound(MatchStarts, AbsOffset);
+		return Next < MatchStarts.Num() ? Next : 0;
 	}
-	Offset += Location.GetOffset();
-	return Offset;
+
+	const int32 Prev = Algo::LowerBound(MatchStarts, AbsOffset) - 1;
+	return Prev >= 0 ? Prev : MatchStarts.Num() - 1;
 }
 
-// Convert an absolute offset into a FTextLocation (line index and offset).
-void FVimTextEditorUtils::AbsoluteOffsetToTextLocation(const FString& Text, int32 AbsoluteOffset, FTextLocation& OutLocation)
+bool FVimTextSearchIndex::IsRegexPattern(const FString& InPattern)
+{
+	static const FString RegexChars = TEXT("\\^$.|?*+()[]{}");
+
+	int32 Unused;
+	for (const TCHAR Char : InPattern)
+	{
+		if (RegexChars.FindChar(Char, Unused))
+			return true;
+	}
+	return false;
+}
+
+void FVimTextSearchIndex::CollectLiteralMatches(const FString& Text)
 {
-	TArray<FString> Lines;
-	Text.ParseIntoArray(Lines, TEXT("\n"), false /*Consider Empty Lines*/);
-	int32 Offset = AbsoluteOffset;
-	for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+	using FTextCore = FVimTextEditorUtils::FTextCore;
+
+	const FTextCore::FView			 TextView = FVimTextEditorUtils::ToView(Text);
+	const TVimLiteralSearcher<TCHAR> Searcher(FVimTextEditorUtils::ToView(Pattern), bIgnoreCase);
+
+	// Overlapping matches are kept, as n / N may land on any of them.
+	for (int32 Start = Searcher.FindNext(TextView, 0); Start != -1;
+		Start = Searcher.FindNext(TextView, Start + 1))
 	{
-		// If the offset is within this line, that’s our location.
-		if (Offset <= Lines[LineIndex].Len())
+		const int32 End = Start + Pattern.Len();
+		if (bWholeWord && !FTextCore::IsWholeWord(TextView, Start, End))
+			continue;
+
+		MatchStarts.Add(Start);
+		MatchEnds.Add(End);
+	}
+}
+
+void FVimTextSearchIndex::NarrowLiteralMatches(const FString& Text)
+{
+	const FVimTextEditorUtils::FTextCore::FView TextView = FVimTextEditorUtils::ToView(Text);
+	const TVimLiteralSearcher<TCHAR>			Searcher(FVimTextEditorUtils::ToView(Pattern), bIgnoreCase);
+
+	int32 Kept = 0;
+	for (int32 i = 0; i < MatchStarts.Num(); ++i)
+	{
+		if (Searcher.MatchesAt(TextView, MatchStarts[i]))
 		{
-			OutLocation = FTextLocation(LineIndex, Offset);
-			return;
+			MatchStarts[Kept] = MatchStarts[i];
+			MatchEnds[Kept] = MatchStarts[i] + Pattern.Len();
+			++Kept;
 		}
-		// Subtract the length of this line plus one for the newline.
-		Offset -= (Lines[LineIndex].Len() + 1);
 	}
-	// Fallback: place at end of last line.
-	OutLocation = FTextLocation(Lines.Num() - 1, Lines.Last().Len());
+	MatchStarts.SetNum(Kept);
+	MatchEnds.SetNum(Kept);
+}
+
+void FVimTextSearchIndex::CollectRegexMatches(const FString& Text)
+{
+	using FTextCore = FVimTextEditorUtils::FTextCore;
+
+	// An invalid pattern simply yields no matches.
+	const FRegexPattern RegexPattern(bIgnoreCase ? TEXT("(?i)") + Pattern : Pattern);
+	FRegexMatcher		Matcher(RegexPattern, Text);
+
+	const FTextCore::FView TextView = FVimTextEditorUtils::ToView(Text);
+	while (Matcher.FindNext())
+	{
+		const int32 Start = Matcher.GetMatchBeginning();
+		const int32 End = Matcher.GetMatchEnding();
+		if (End <= Start) // Skip empty matches (e.g. "^" or "x*")
+			continue;
+
+		if (bWholeWord && !FTextCore::IsWholeWord(TextView, Start, End))
+			continue;
+
+		MatchStarts.Add(Start);
+		MatchEnds.Add(End);
+	}
 }
 
 void FVimTextEditorUtils::DetermineVimModeForSingleLineEncounter()
@@ -510,3 +576,75 @@ void FVimTextEditorUtils::DetermineVimModeForSingleLineEncounter()
 	if (!FSlateApplication::Get().GetModifierKeys().IsControlDown())
 		FVimInputProcessor::Get()->SetVimMode(FSlateApplication::Get(), EVimMode::Insert);
 }
+
+//------------------------------------------------------------------------------
+// Benchmark
+//------------------------------------------------------------------------------
+
+static FAutoConsoleCommand Cmd_BenchmarkWordMotions = FAutoConsoleCommand(
+	TEXT("UnrealMotions.BenchmarkWordMotions"),
+	TEXT("Times the word motions (w, b, e, ge & their WORD variants) over a generated buffer. Args: [SizeInMB=1]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 SizeInMB = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1;
+		FVimTextEditorUtils::BenchmarkWordMotions(FMath::Max(SizeInMB, 1));
+	}));
+
+void FVimTextEditorUtils::BenchmarkWordMotions(const int32 SizeInMB)
+{
+	// Code-like text: a mix of words, symbols, whitespace runs & line breaks.
+	const FString Sample =
+		TEXT("void UClass::Func_01(const FString& InText, int32 Pos) {\n")
+		TEXT("\tif (Pos >= 0 && InText[Pos] != TEXT('x')) // comment\n")
+		TEXT("\t\treturn   Some_Value->Get()  +  42;\n\n");
+
+	const int32 NumChars = SizeInMB * 1024 * 1024;
+	FString		Text;
+	Text.Reserve(NumChars);
+	while (Text.Len() + Sample.Len() <= NumChars)
+		Text += Sample;
+
+	using FMotion = int32 (*)(const FString&, int32, bool);
+	struct FMotionCase
+	{
+		const TCHAR* Name;
+		FMotion		 Motion;
+		bool		 bBigWord;
+		bool		 bForward;
+	};
+	const FMotionCase Cases[] = {
+		{ TEXT("w"), &FindNextWordBoundary, false, true },
+		{ TEXT("W"), &FindNextWordBoundary, true, true },
+		{ TEXT("e"), &FindNextWordEnd, false, true },
+		{ TEXT("E"), &FindNextWordEnd, true, true },
+		{ TEXT("b"), &FindPreviousWordBoundary, false, false },
+		{ TEXT("B"), &FindPreviousWordBoundary, true, false },
+		{ TEXT("ge"), &FindPreviousWordEnd, false, false },
+		{ TEXT("gE"), &FindPreviousWordEnd, true, false },
+	};
+
+	const double SizeMB = Text.Len() * sizeof(TCHAR) / (1024.0 * 1024.0);
+	Logger.Print(FString::Printf(TEXT("Benchmarking word motions over %d chars (%.2f MB)"),
+		Text.Len(), SizeMB));
+
+	for (const FMotionCase& Case : Cases)
+	{
+		// Walk the whole buffer motion by motion (stop if we stop progressing).
+		int32		 Pos = Case.bForward ? 0 : Text.Len();
+		int32		 NumMotions = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		while (true)
+		{
+			const int32 NewPos = Case.Motion(Text, Pos, Case.bBigWord);
+			if (NewPos == Pos)
+				break;
+			Pos = NewPos;
+			++NumMotions;
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		Logger.Print(FString::Printf(
+			TEXT("%-3s %8d motions in %7.2f ms (%7.1f MB/s)"),
+			Case.Name, NumMotions, Seconds * 1000.0,
+			Seconds > 0.0 ? SizeMB / Seconds : 0.0));
+	}
+}
@@ -0,0 +1,83 @@
+#include "VimTextUndoHistory.h"
+#include "VimTextEditorUtils.h"
+
+void FVimTextUndoHistory::BeginGroup(const FVimTextLineIndex& LineIndex)
+{
+	GroupText = LineIndex.GetMirroredText();
+	GroupRevision = LineIndex.GetRevision();
+	bIsGroupOpen = true;
+}
+
+bool FVimTextUndoHistory::EndGroup(const FVimTextLineIndex& LineIndex)
+{
+	if (!bIsGroupOpen)
+		return false;
+	bIsGroupOpen = false;
+
+	if (LineIndex.GetRevision() == GroupRevision)
+		return false; // Never re-mirrored, so untouched
+
+	const FString& Before = GroupText.ToString();
+	const FString& After = LineIndex.GetText();
+	const int32	   MinLen = FMath::Min(Before.Len(), After.Len());
+
+	// Trim what the texts have in common on both ends
+	int32 Prefix = 0;
+	while (Prefix < MinLen && Before[Prefix] == After[Prefix])
+		++Prefix;
+
+	int32 Suffix = 0;
+	while (Suffix < MinLen - Prefix
+		&& Before[Before.Len() - 1 - Suffix] == After[After.Len() - 1 - Suffix])
+		++Suffix;
+
+	if (Prefix == Before.Len() && Prefix == After.Len())
+		return false; // Edited back to what it was
+
+	FVimTextUndoStep Step;
+	Step.Start = Prefix;
+	Step.Removed = Before.Mid(Prefix, Before.Len() - Prefix - Suffix);
+	Step.Inserted = After.Mid(Prefix, After.Len() - Prefix - Suffix);
+
+	while (Steps.Num() > NumApplied) // Branching off: no redoing from here
+	{
+		StoredChars -= Steps.Last().Removed.Len() + Steps.Last().Inserted.Len();
+		Steps.Pop();
+	}
+
+	StoredChars += Step.Removed.Len() + Step.Inserted.Len();
+	Steps.Add(MoveTemp(Step));
+	NumApplied = Steps.Num();
+
+	while (Steps.Num() > MaxSteps
+		|| (StoredChars > MaxStoredChars && Steps.Num() > 1))
+		DropOldestStep();
+
+	return true;
+}
+
+const FVimTextUndoStep* FVimTextUndoHistory::Undo()
+{
+	return NumApplied > 0 ? &Steps[--NumApplied] : nullptr;
+}
+
+const FVimTextUndoStep* FVimTextUndoHistory::Redo()
+{
+	return NumApplied < Steps.Num() ? &Steps[NumApplied++] : nullptr;
+}
+
+void FVimTextUndoHistory::Reset()
+{
+	Steps.Reset();
+	NumApplied = 0;
+	StoredChars = 0;
+	GroupText = FText::GetEmpty();
+	bIsGroupOpen = false;
+}
+
+void FVimTextUndoHistory::DropOldestStep()
+{
+	StoredChars -= Steps[0].Removed.Len() + Steps[0].Inserted.Len();
+	Steps.RemoveAt(0);
+	NumApplied = FMath::Max(NumApplied - 1, 0);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Views/SListView.h"
+#include "VimGraphActionCache.h"
+
+DECLARE_DELEGATE_OneParam(FOnVimGraphActionPicked, const TSharedPtr<FVimGraphAction>&);
+
+/**
+ * Keyboard driven node creation menu: fuzzy filters a cached action list as
+ * you type. Up / Down (or Ctrl+J / Ctrl+K) move through the matches, Enter
+ * picks the selected one and Escape dismisses the menu.
+ */
+class SVimGraphActionMenu : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SVimGraphActionMenu) {}
+	SLATE_ARGUMENT(TSharedPtr<const FVimGraphActionList>, ActionList)
+	SLATE_EVENT(FOnVimGraphActionPicked, OnActionPicked)
+	SLATE_EVENT(FSimpleDelegate, OnDismissed)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	TSharedPtr<SSearchBox> GetSearchBox() const { return SearchBox; }
+
+private:
+	void   OnSearchTextChanged(const FText& InText);
+	void   OnSearchTextCommitted(const FText& InText, ETextCommit::Type CommitType);
+	FReply OnSearchBoxKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent);
+
+	void RefreshFilter(const FString& InQuery);
+	void MoveSelection(const int32 Offset);
+	void PickSelected();
+
+	TSharedRef<ITableRow> OnGenerateRow(
+		TSharedPtr<FVimGraphAction>		  InAction,
+		const TSharedRef<STableViewBase>& OwnerTable);
+
+	/** Rows highlight whatever is typed now, not what was when generated. */
+	FText GetHighlightText() const;
+
+	TSharedPtr<const FVimGraphActionList>			   ActionList;
+	TArray<TSharedPtr<FVimGraphAction>>				   FilteredActions;
+	TSharedPtr<SSearchBox>							   SearchBox;
+	TSharedPtr<SListView<TSharedPtr<FVimGraphAction>>> ListView;
+	FOnVimGraphActionPicked							   OnActionPicked;
+	FSimpleDelegate									   OnDismissed;
+	bool											   bHasPicked{ false };
+
+	static constexpr int32 MaxFilteredActions = 500;
+};
@@ -14,6 +14,10 @@ public:
 	bool						 IsTabNavigatorEnabled();
 	bool						 IsWindowNavigatorEnabled();
 	bool						 IsFocuserEnabled();
+	int32						 GetWidgetHistoryDepth();
+	int32						 GetWidgetHistoryPartitionDepth();
+	bool						 IsWidgetHistoryPartitionedByTab();
+	bool						 IsWidgetHistoryPartitionedByWindow();
 
 	FConfigFile ConfigFile;
 
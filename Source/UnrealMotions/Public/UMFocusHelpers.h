@@ -14,15 +14,29 @@ public:
 		FTimerHandle& TimerHandle, const float Delay, const bool bClearUserFocus);
 
 	static bool HandleWidgetExecution(FSlateApplication& SlateApp, const TSharedRef<SWidget> InWidget);
-	static void HandleWidgetExecutionWithDelay(FSlateApplication& SlateApp, const TSharedRef<SWidget> InWidget, FTimerHandle* TimerHandle = nullptr, const float Delay = 0.015f);
+
+	/**
+	 * Executes the widget as soon as its window becomes the active one (checked
+	 * after each Slate tick), or anyway once Timeout elapses. A new request
+	 * replaces the pending one.
+	 */
+	static void HandleWidgetExecutionWithDelay(FSlateApplication& SlateApp, const TSharedRef<SWidget> InWidget, const float Timeout = 0.25f);
 
 	static bool TryFocusPopupMenu(FSlateApplication& SlateApp);
-	static void TryFocusFuturePopupMenu(FSlateApplication& SlateApp, FTimerHandle* TimerHandle = nullptr, const float Delay = 0.15f);
+
+	/**
+	 * Focuses the popup menu of the active regular window the moment its window
+	 * is first rendered. If no menu shows up within Timeout, falls back to
+	 * a single lookup (TryFocusPopupMenu).
+	 */
+	static void TryFocusFuturePopupMenu(FSlateApplication& SlateApp, const float Timeout = 0.5f);
 
 	static bool BringFocusToPopupMenu(FSlateApplication& SlateApp, TSharedRef<SWidget> WinContent);
 
 	static bool TryFocusSubMenu(FSlateApplication& SlateApp, const TSharedRef<SWindow> ParentMenuWindow);
-	static void TryFocusFutureSubMenu(FSlateApplication& SlateApp, const TSharedRef<SWindow> ParentMenuWindow, FTimerHandle* TimerHandle = nullptr, const float Delay = 0.15f);
+
+	/** Like TryFocusFuturePopupMenu, for a child window of ParentMenuWindow. */
+	static void TryFocusFutureSubMenu(FSlateApplication& SlateApp, const TSharedRef<SWindow> ParentMenuWindow, const float Timeout = 0.5f);
 
 	static void LogWidgetType(const TSharedRef<SWidget> InWidget);
 
@@ -37,4 +51,35 @@ public:
 	static void ClickSPin(FSlateApplication& SlateApp, const TSharedRef<SWidget> InWidget);
 
 	static FUMLogger Logger;
+
+private:
+	/** A pending "do something once the window shows up" request. */
+	struct FPendingWindowRequest
+	{
+		FDelegateHandle DelegateHandle;
+		FTimerHandle	TimeoutHandle;
+		double			RequestTime{ 0.0 };
+	};
+
+	/**
+	 * Calls OnWindowRendered for every window rendered from now on, until it
+	 * returns true or Timeout elapses (then OnTimeout is called).
+	 */
+	static void WaitForRenderedWindow(FPendingWindowRequest& Pending,
+		const float Timeout, TFunction<bool(SWindow&)> OnWindowRendered,
+		TFunction<void()> OnTimeout);
+
+	static void CancelPendingRequest(FPendingWindowRequest& Pending);
+
+	static void ExecutePendingWidget(
+		const TWeakPtr<SWidget> WeakWidget, const bool bTimedOut);
+
+	static bool IsMenuWindow(const SWindow& InWindow);
+
+	static void LogRequestLatency(
+		const FPendingWindowRequest& Pending, const TCHAR* What, const bool bTimedOut);
+
+	static FPendingWindowRequest PendingPopupMenuFocus;
+	static FPendingWindowRequest PendingSubMenuFocus;
+	static FPendingWindowRequest PendingWidgetExecution;
 };
@@ -5,6 +5,8 @@
 #include "Widgets/SWindow.h"
 #include "Widgets/SWidget.h"
 #include "VimInputProcessor.h"
+#include "UMWidgetHistory.h"
+#include "UMJumpList.h"
 #include "Framework/Application/SlateApplication.h"
 #include "EditorSubsystem.h"
 #include "UMFocuserEditorSubsystem.generated.h"
@@ -159,7 +161,33 @@ public:
 
 	void ActivateTab(const TSharedRef<SDockTab> InTab);
 
-	void RecordWidgetUse(TSharedRef<SWidget> InWidget);
+	/**
+	 * Records the widget in the global focus history and in the history
+	 * partitions of its hosting Major Tab & Window.
+	 * @param InWidget The newly focused widget.
+	 * @param InWidgetPath The path to the widget (if known).
+	 */
+	void RecordWidgetUse(TSharedRef<SWidget> InWidget, const FWidgetPath& InWidgetPath);
+
+	/**
+	 * @return The active tab (Minor first, then Major) whose content hosts the
+	 * widget, if any. Widgets are mostly focused within the active tabs, so
+	 * there's no need to search every tab.
+	 */
+	TSharedPtr<SDockTab> FindActiveTabHostingWidget(const FWidgetPath& InWidgetPath);
+
+	/**
+	 * @return The Id of the tab that partitions the focus history for this
+	 * tab: Major & Nomad Tabs are their own partition, while Minor Tabs are
+	 * resolved to their parent Major Tab.
+	 */
+	static uint64 GetHistoryPartitionTabId(const TSharedRef<SDockTab> InTab);
+
+	/**
+	 * Focus the previously focused widget, either in the currently active
+	 * Major Tab, or globally across all tabs & windows.
+	 */
+	bool TryFocusPreviousWidget(const bool bInActiveTab);
 
 	bool TryFocusLastActiveMinorForMajorTab(TSharedRef<SDockTab> InMajorTab);
 
@@ -190,47 +218,72 @@ public:
 	FUMOnBindingContextChanged Subscribe_OnBindingContextChanged();
 	FUMOnBindingContextChanged Unsubscribe_OnBindingContextChanged();
 
+	/**
+	 * Ctrl-O / Ctrl-I jumplists: one per window (like Vim) plus a global one
+	 * spanning all windows. Entries carry stable widget signatures and are
+	 * persisted across editor restarts (see SaveJumpLists).
+	 */
 	struct FListNavigationManager
 	{
 		FListNavigationManager() = default;
 
-		struct FTrackedInst
-		{
-			TWeakPtr<SWidget>  Widget;
-			TWeakPtr<SWindow>  ParentWindow;
-			TWeakPtr<SDockTab> ParentMajorTab;
-			bool			   bIsParentNomadTab;
-			TWeakPtr<SDockTab> ParentMinorTab;
-
-			FTrackedInst(
-				TWeakPtr<SWidget>  InWidget,
-				TWeakPtr<SWindow>  InParentWindow,
-				TWeakPtr<SDockTab> InParentMajorTab,
-				bool			   InbParentNomadTab,
-				TWeakPtr<SDockTab> InParentMinorTab);
-
-			bool IsValid();
-		};
-
-		bool IsValid();
-
-		void Push(
-			TSharedRef<SWidget>	 InWidget,
-			TSharedRef<SWindow>	 InParentWindow,
-			TSharedRef<SDockTab> InParentMajorTab,
-			bool				 InbParentNomadTab,
-			TSharedPtr<SDockTab> InParentMinorTab);
-		// void Pop();
+		void Push(const FUMJumpEntry& InEntry, const TSharedRef<SWindow> InParentWindow);
 
 		void TrackFocusedWidget(const TSharedRef<SWidget> NewWidget);
-		void JumpListNavigation(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 
-		int32		 CurrWidgetIndex{ 0 };
-		const int32	 CAP{ 50 };
+		/**
+		 * Jump Out (Ctrl-O) or In (Ctrl-I) the jumplist.
+		 * @param bGlobal Navigate the global jumplist rather than the
+		 * active window's one.
+		 */
+		void JumpListNavigation(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent, const bool bGlobal);
+
+		/**
+		 * Makes sure the entry points to a live widget, rebinding it by its
+		 * signature if the original widget is gone (e.g. a reopened editor).
+		 */
+		bool TryResolveEntry(FUMJumpEntry& InOutEntry);
+
+		/**
+		 * @return The live Major Tab the signature was made in: the editor of
+		 * its asset for asset editors (which share one layout id), else the
+		 * tab of its layout id & label.
+		 */
+		TSharedPtr<SDockTab> FindLiveMajorTab(const FUMWidgetSignature& InSignature);
+
+		/**
+		 * Adds the live entry, first dropping the stale ones and the ones no
+		 * jumplist refers to anymore if there are too many of them.
+		 */
+		void AddLiveEntry(const FUMJumpEntry& InEntry);
+
+		FUMJumpList& FindOrAddWindowJumpList(const TSharedRef<SWindow> InWindow);
+
+		/**
+		 * Park the list of a destroyed window so it can be restored by title.
+		 * Windows sharing a title each park their own list; the last parked
+		 * one is restored first.
+		 */
+		void OnWindowBeingDestroyed(const SWindow& InWindow);
+
+		void SaveJumpLists();
+		void LoadJumpLists();
+
+		static FString GetJumpListsFilePath();
+
 		bool		 bHasJumpedToNewWidget{ false };
 		FTimerHandle TimerHandle_TrackFocusedWidget;
-		// TArray<FTrackedInst, TFixedAllocator<50>> TrackedWidgets;
-		TArray<FTrackedInst>				  TrackedWidgets;
+
+		FUMJumpList						   GlobalJumpList;
+		TMap<uint64, FUMJumpList>		   JumpListsByWindowId;
+		TMap<FString, TArray<FUMJumpList>> JumpListsByWindowTitle; // Closed or not yet reopened
+
+		// Live entries (widget, tabs & window) by their stable signature:
+		// resolving a jump into a reopened editor is then a single lookup.
+		TMap<FUMWidgetSignature, FUMJumpEntry> LiveEntriesBySignature;
+		static constexpr int32				   MaxLiveEntries = 4 * FUMJumpList::Capacity;
+		int32								   LiveEntriesPruneThreshold = MaxLiveEntries;
+
 		FUMLogger*							  Logger;
 		TObjectPtr<UUMFocuserEditorSubsystem> FocuserSub;
 	};
@@ -277,8 +330,9 @@ public:
 	bool	  bLog{ false };
 	bool	  bVisLogTabFocusFlow{ false };
 
-	// Holds the most recent widget at index 0, and the oldest at the end
-	TArray<TWeakPtr<SWidget>> RecentlyUsedWidgets;
+	// Recently focused widgets, most recent first. Partitioned by Major Tab
+	// and Window (see the Focuser section in the config file).
+	FUMWidgetHistory WidgetHistory;
 
 	// ~ Last active Major Tab by Window ID ~
 	// You enter the ID of the Window:
@@ -138,6 +138,18 @@ public:
 		const TArray<FVector2f>&  TargetPositions,
 		const float				  MoveOffsetDelay = 0.050f);
 
+	/**
+	 * Drag & drop the widget through the given positions within a single call:
+	 * the whole press-drag-release sequence is routed to Slate synchronously
+	 * with explicit screen positions, so the OS cursor is never moved and no
+	 * timers are involved. The engine's own drag operation (e.g. the docking
+	 * operation for tabs) handles the drop.
+	 * @return false if no drag operation could be started.
+	 */
+	static bool DragAndDropWidgetImmediately(
+		const TSharedRef<SWidget> InWidget,
+		const TArray<FVector2f>&  TargetPositions);
+
 	static bool SimulateMousePressAtPosition(const FVector2f TargetPosition, const FKey MouseButtonToSimulate = EKeys::LeftMouseButton);
 
 	static void TriggerDragInPlace();
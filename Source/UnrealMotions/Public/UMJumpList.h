@@ -0,0 +1,148 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SWidget.h"
+#include "Widgets/SWindow.h"
+#include "Widgets/Docking/SDockTab.h"
+
+/**
+ * Stable identity of a widget that survives editor restarts and tabs being
+ * closed & reopened: the layout identifiers (and label) of the tabs hosting
+ * the widget, plus a hash of the widget's type path from the tab's content
+ * down to the widget itself (type + child index per level).
+ * Asset editors all share one layout id (and same-named assets one label),
+ * so their tabs are identified by the object path of the edited asset.
+ * The child indices of the path let the widget be found again by walking
+ * straight down to it, rather than searching the tab's whole content.
+ */
+struct FUMWidgetSignature
+{
+	FName		  MajorTabLayoutId;
+	FString		  MajorTabLabel;
+	FName		  MinorTabLayoutId;
+	FString		  AssetPath; // Asset editor tabs only
+	uint32		  TypePathHash{ 0 };
+	TArray<int32> ChildIndices; // From the host tab's content down
+
+	bool IsValid() const { return TypePathHash != 0 && !MajorTabLayoutId.IsNone(); }
+
+	bool operator==(const FUMWidgetSignature& Other) const
+	{
+		return TypePathHash == Other.TypePathHash
+			&& MajorTabLayoutId == Other.MajorTabLayoutId
+			&& MinorTabLayoutId == Other.MinorTabLayoutId
+			&& MajorTabLabel.Equals(Other.MajorTabLabel)
+			&& AssetPath.Equals(Other.AssetPath);
+	}
+
+	friend uint32 GetTypeHash(const FUMWidgetSignature& Signature)
+	{
+		return HashCombine(Signature.TypePathHash,
+			HashCombine(GetTypeHash(Signature.MajorTabLayoutId),
+				GetTypeHash(Signature.MinorTabLayoutId)));
+	}
+
+	/**
+	 * Builds the signature of a widget residing in the passed tabs.
+	 * @param InWidget The widget to sign.
+	 * @param InMajorTab The Major (or Nomad) Tab hosting the widget.
+	 * @param InMinorTab The Minor Tab hosting the widget (nullptr for Nomads).
+	 * @return false if the widget doesn't reside under the hosting tab content.
+	 */
+	static bool Make(const TSharedRef<SWidget> InWidget,
+		const TSharedRef<SDockTab> InMajorTab, const TSharedPtr<SDockTab> InMinorTab,
+		FUMWidgetSignature& OutSignature);
+
+	/**
+	 * @return The object path of the asset edited in the Major Tab, or an
+	 * empty string if it isn't an asset editor's tab.
+	 */
+	static FString GetEditedAssetPath(const TSharedRef<SDockTab> InMajorTab);
+
+	/**
+	 * @return The live Major Tab of the asset editor editing AssetPath, found
+	 * through the asset editor subsystem (nullptr if it isn't open).
+	 */
+	TSharedPtr<SDockTab> FindAssetEditorTab() const;
+
+	/**
+	 * Walks the child indices down from the tab's content.
+	 * @return The widget at the end of the path if its type path still hashes
+	 * the same, nullptr otherwise (e.g. the tab's layout has changed).
+	 */
+	TSharedPtr<SWidget> FindWidgetInTab(const TSharedRef<SDockTab> InHostTab) const;
+
+	/** Folds one level of the type path into the running hash. */
+	static uint32 HashPathLevel(const uint32 ParentHash,
+		const TSharedRef<SWidget> InWidget, const int32 ChildIndex);
+
+	FString ToString() const;
+	bool	InitFromString(const FString& InString);
+};
+
+struct FUMJumpEntry
+{
+	TWeakPtr<SWidget>  Widget;
+	TWeakPtr<SWindow>  ParentWindow;
+	TWeakPtr<SDockTab> ParentMajorTab;
+	TWeakPtr<SDockTab> ParentMinorTab;
+	bool			   bIsParentNomadTab{ false };
+	FUMWidgetSignature Signature;
+
+	bool IsLive() const
+	{
+		return Widget.IsValid() && ParentWindow.IsValid() && ParentMajorTab.IsValid()
+			&& (bIsParentNomadTab || ParentMinorTab.IsValid());
+	}
+
+	bool IsSameTarget(const FUMJumpEntry& Other) const;
+};
+
+/**
+ * Vim-like jumplist over a fixed-capacity ring buffer.
+ * Pushing is O(1): when full, the oldest entry is overwritten. Pushing after
+ * having jumped back (Ctrl-O) truncates every entry newer than the cursor,
+ * exactly like branching off in Vim.
+ */
+class FUMJumpList
+{
+public:
+	static constexpr int32 Capacity = 100;
+
+	FUMJumpList();
+
+	void Push(const FUMJumpEntry& InEntry);
+
+	/**
+	 * Moves the cursor towards older (Direction < 0) or newer (Direction > 0)
+	 * entries, skipping entries that can't be reached.
+	 * @param CanReach Resolves (and may rebind) an entry; false to skip it.
+	 * @return The entry we've landed on, or nullptr (cursor is left untouched).
+	 */
+	FUMJumpEntry* Step(const int32 Direction,
+		TFunctionRef<bool(FUMJumpEntry&)> CanReach);
+
+	int32 Num() const { return Count; }
+	bool  IsEmpty() const { return Count == 0; }
+	int32 GetCursor() const { return Cursor; }
+	void  Reset();
+
+	/** Logical index: 0 is the oldest entry, Num() - 1 the newest. */
+	FUMJumpEntry&		Get(const int32 Index);
+	const FUMJumpEntry& Get(const int32 Index) const;
+
+	/** Owning window title, used as the persistence key for window lists. */
+	FString WindowTitle;
+
+private:
+	int32 ToPhysicalIndex(const int32 Index) const
+	{
+		return (Start + Index) % Capacity;
+	}
+
+	TArray<FUMJumpEntry, TFixedAllocator<Capacity>> Entries;
+
+	int32 Start{ 0 };
+	int32 Count{ 0 };
+	int32 Cursor{ INDEX_NONE };
+};
@@ -4,6 +4,7 @@
 #include "Framework/Commands/InputBindingManager.h"
 #include "Framework/Docking/TabManager.h"
 #include "UMLogger.h"
+#include "UMTabRegistry.h"
 #include "EditorSubsystem.h"
 #include "UMTabNavigatorEditorSubsystem.generated.h"
 
@@ -133,18 +134,76 @@ public:
 	//							~ Vim Functions ~
 	//
 
+	/** Append the active Major Tab to the TabWell of the N'th visible window. */
 	void MoveActiveTabToWindow(
 		FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 
+	/** Float the active Major Tab out into a new window. */
 	void MoveActiveTabOut();
 
 	/** Move Active Minor Tab via HJKL (Vim Directions) */
 	void MoveActiveMinorTabToPanel(
 		FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 
+	/**
+	 * Alt-Tab like switching between Major & Nomad Tabs across all windows, by
+	 * most recent activation. Repeated calls within a short window of time
+	 * keep stepping through the same (snapshotted) order.
+	 * @param bIsOlder Step towards less recently used tabs.
+	 */
+	void CycleRecentTabs(bool bIsOlder);
+
+	/** Fuzzy-finds a tab (of any role, in any window) by name & activates it. */
+	void GoToTabByName(const TArray<FString>& Args);
+
+	/** Logs all the tabs known to the registry by recency (:ls). */
+	void ListTabs();
+
+	/**
+	 * Brings the tab to the front, activating its window and the Major Tab
+	 * hosting it (if it's a Minor Tab) along the way.
+	 */
+	static void ActivateTabAcrossWindows(const TSharedRef<SDockTab> InTab);
+
+	FUMTabRegistry& GetTabRegistry() { return TabRegistry; }
+
 private:
 	void BindVimCommands();
 
+	void RegisterConsoleCommands();
+
+	/**
+	 * Docks the tab by dragging it through the passed positions.
+	 * The drag is first performed directly (synchronously, within this frame
+	 * and without touching the cursor). If the tab didn't land where expected,
+	 * falls back to the timed cursor drag.
+	 * @param HasLanded Checks whether the direct drop landed as expected.
+	 * The fallback is skipped if the direct drop moved the tab elsewhere.
+	 */
+	void DockTabAtPositions(FSlateApplication& SlateApp,
+		const TSharedRef<SDockTab> InTab, const TArray<FVector2f>& TargetPositions,
+		TFunctionRef<bool()> HasLanded);
+
+	/** Fallback: drag the tab by moving the actual cursor over a few frames. */
+	void DragTabWithCursor(FSlateApplication& SlateApp,
+		const TSharedRef<SDockTab> InTab, const TArray<FVector2f>& TargetPositions);
+
+	/** Positions to drag through to append a tab at the end of a TabWell. */
+	static bool GetTabWellDropPositions(const TSharedRef<SWidget> TargetTabWell,
+		const bool bIsNomadWindow, TArray<FVector2f>& OutPositions);
+
+	static bool IsTabInTabWell(
+		const TSharedRef<SDockTab> InTab, const TSharedRef<SWidget> InTabWell);
+
+	static TSharedPtr<SWidget> FindTabWellInDirection(
+		const TSharedRef<SWidget>		   OriginTabWell,
+		const TArray<TSharedPtr<SWidget>>& TabWells,
+		const EUINavigation				   Direction);
+
+	/** Finds a desktop position next to the window that no window covers. */
+	static bool FindUncoveredPositionAroundWindow(FSlateApplication& SlateApp,
+		const TSharedRef<SWindow> InWindow, FVector2f& OutPosition);
+
 	//
 	//
 	/////////////////////////////////////////////////////////////////////////////
@@ -176,5 +235,12 @@ private:
 	FOnActiveTabChanged		   OnActiveTabChanged(FOnActiveTabChanged::FDelegate);
 	FUMOnNewMajorTabChanged	   OnNewMajorTabChanged;
 
+	FUMTabRegistry TabRegistry;
+
+	/** Snapshot of the recency order while cycling recent tabs */
+	TArray<TWeakPtr<SDockTab>> RecentTabsCycle;
+	int32					   RecentTabsCycleIndex{ 0 };
+	double					   LastRecentTabsCycleTime{ 0.0 };
+
 	FUMLogger Logger;
 };
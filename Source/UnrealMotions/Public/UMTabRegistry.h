@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/SWindow.h"
+#include "UMWidgetHistory.h"
+
+/** Everything the registry knows about a dock tab. */
+struct FUMTabRecord
+{
+	TWeakPtr<SDockTab> Tab;
+	TWeakPtr<SWindow>  ParentWindow;
+	ETabRole		   Role{ ETabRole::PanelTab };
+	double			   LastActivationTime{ 0.0 }; // 0 if never seen active
+	FString			   Label;					  // See FUMSlateHelpers::GetCleanTabLabel
+	FString			   LabelLower;				  // Cached for fuzzy matching
+
+	/** Alive and still docked somewhere (closed tabs lose their window). */
+	bool IsLive() const;
+};
+
+/**
+ * Live registry of the dock tabs across all windows, ordered by most recent
+ * activation. It is maintained from the Global Tab Manager's activation and
+ * foregrounding delegates (plus a one-time discovery pass), so lookups never
+ * need to walk tab wells.
+ */
+class FUMTabRegistry
+{
+public:
+	void Init();
+	void Shutdown();
+
+	/**
+	 * Adds or refreshes the tab's record.
+	 * @param bActivated Promote the tab to be the most recently used.
+	 */
+	void RegisterTab(const TSharedRef<SDockTab>& InTab, const bool bActivated);
+
+	const FUMTabRecord* FindRecord(const uint64 TabId) const;
+
+	/**
+	 * Collects the live tabs passing the filter, most recently activated first.
+	 * Stale entries are dropped on the way.
+	 */
+	void GetTabsByRecency(TArray<TSharedRef<SDockTab>>& OutTabs,
+		TFunctionRef<bool(const FUMTabRecord&)> Filter);
+
+	/**
+	 * Fuzzy-finds a tab by its (clean) label. The best scoring match wins;
+	 * ties go to the most recently activated tab.
+	 */
+	TSharedPtr<SDockTab> FindTabByName(const FString& InQuery,
+		TFunctionRef<bool(const FUMTabRecord&)> Filter);
+
+	/**
+	 * Scores the candidate as an ordered (subsequence) match of the query.
+	 * Consecutive characters and word starts score higher; gaps cost.
+	 * Both strings are expected to be lowercase.
+	 * @return INDEX_NONE if the query isn't a subsequence of the candidate.
+	 */
+	static int32 ScoreFuzzyMatch(const FString& QueryLower, const FString& CandidateLower);
+
+	int32 Num() const { return RecordsById.Num(); }
+
+private:
+	void OnActiveTabChanged(TSharedPtr<SDockTab> NewTab, TSharedPtr<SDockTab> PrevTab);
+	void OnTabForegrounded(TSharedPtr<SDockTab> NewTab, TSharedPtr<SDockTab> PrevTab);
+
+	/** Registers the tabs sharing a TabWell with this tab (& its minor tabs). */
+	void RegisterNeighborTabs(const TSharedRef<SDockTab>& InTab);
+
+	/** Registers every tab in every top-level window. Done once, lazily. */
+	void DiscoverAllTabs();
+
+	void PruneStaleRecords();
+
+	TMap<uint64, FUMTabRecord> RecordsById;
+	FUMWidgetMRUList		   RecentTabs{ 1024 };
+
+	FDelegateHandle DelegateHandle_OnActiveTabChanged;
+	FDelegateHandle DelegateHandle_OnTabForegrounded;
+	bool			bHasDiscoveredTabs{ false };
+};
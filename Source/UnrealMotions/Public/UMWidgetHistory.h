@@ -0,0 +1,139 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SWidget.h"
+
+/**
+ * Least-recently-used list of widgets keyed by their Slate widget ID.
+ * Entries are stored in a pooled array and linked to each other by index
+ * (intrusive doubly-linked list), while a hash map resolves a widget ID to its
+ * node. Promoting, inserting and evicting are all O(1).
+ * Widgets are held weakly; destroyed widgets are reclaimed lazily whenever
+ * they're encountered while reading from the front of the list.
+ */
+class FUMWidgetMRUList
+{
+public:
+	FUMWidgetMRUList(const int32 InCapacity = 10);
+
+	/** Shrinks (evicting the oldest entries) or grows the max depth. */
+	void SetCapacity(const int32 InCapacity);
+
+	/** Moves the widget to the front of the list, inserting it if needed. */
+	void Touch(const TSharedRef<SWidget>& InWidget);
+
+	/**
+	 * Inserts the widget at the back of the list (as the least recently used)
+	 * if it isn't tracked yet and there's room for it. Tracked widgets keep
+	 * their position.
+	 */
+	void AddLeastRecent(const TSharedRef<SWidget>& InWidget);
+
+	bool Remove(const uint64 WidgetId);
+
+	bool Contains(const uint64 WidgetId) const;
+
+	/** @return The most recently used widget that is still alive. */
+	TSharedPtr<SWidget> GetMostRecent();
+
+	/**
+	 * @return The most recently used alive widget that isn't IgnoreWidgetId.
+	 * Used to jump to the previous widget while the current one sits at front.
+	 */
+	TSharedPtr<SWidget> GetPrevious(const uint64 IgnoreWidgetId);
+
+	/**
+	 * Walks the list from the most recent to the oldest entry, reclaiming
+	 * stale entries on the way, and returns the first widget that satisfies
+	 * the predicate.
+	 */
+	TSharedPtr<SWidget> FindMostRecent(
+		TFunctionRef<bool(const TSharedRef<SWidget>&)> Predicate);
+
+	int32 Num() const { return NodeIndexById.Num(); }
+	bool  IsEmpty() const { return Head == INDEX_NONE; }
+	void  Reset();
+
+private:
+	struct FNode
+	{
+		TWeakPtr<SWidget> Widget;
+		uint64			  WidgetId{ 0 };
+		int32			  Prev{ INDEX_NONE };
+		int32			  Next{ INDEX_NONE };
+	};
+
+	void  Unlink(const int32 NodeIndex);
+	void  LinkFront(const int32 NodeIndex);
+	void  LinkBack(const int32 NodeIndex);
+	int32 AllocateNode();
+	void  ReleaseNode(const int32 NodeIndex);
+	void  EvictOverCapacity();
+
+	TArray<FNode>	   Nodes;
+	TArray<int32>	   FreeNodes;
+	TMap<uint64, int32> NodeIndexById;
+	int32			   Head{ INDEX_NONE };
+	int32			   Tail{ INDEX_NONE };
+	int32			   Capacity{ 10 };
+};
+
+/**
+ * Focus history of widgets: one global MRU list plus optional MRU partitions
+ * per Major Tab and per Window, so that "previous widget in this tab" is
+ * found among a handful of entries before falling back to the wider lists.
+ * Partitions whose widgets were all destroyed (i.e. their tab or window is
+ * gone) are dropped whenever they're found empty, and swept as new ones are
+ * added.
+ */
+class FUMWidgetHistory
+{
+public:
+	void Configure(const int32 InDepth, const int32 InPartitionDepth,
+		const bool bInPartitionByTab, const bool bInPartitionByWindow);
+
+	/**
+	 * Records a widget use in the global list and in the matching partitions.
+	 * @param MajorTabId Id of the Major (or Nomad) Tab hosting the widget, 0 if unknown.
+	 * @param WindowId Id of the Window hosting the widget, 0 if unknown.
+	 */
+	void RecordWidgetUse(const TSharedRef<SWidget>& InWidget,
+		const uint64 MajorTabId, const uint64 WindowId);
+
+	TSharedPtr<SWidget> GetPreviousWidget(const uint64 IgnoreWidgetId);
+
+	/**
+	 * Walks the Major Tab's partition, then the Window's, then the global list
+	 * (the partitions being disabled or unknown are skipped) and returns the
+	 * most recent widget satisfying the predicate. Each widget is tested once.
+	 */
+	TSharedPtr<SWidget> FindMostRecent(const uint64 MajorTabId, const uint64 WindowId,
+		TFunctionRef<bool(const TSharedRef<SWidget>&)> Predicate);
+
+	FUMWidgetMRUList& GetGlobalList() { return GlobalList; }
+
+	void RemoveWindowPartition(const uint64 WindowId);
+
+	/** Drops the partitions none of whose widgets are alive anymore. */
+	void PruneEmptyPartitions();
+
+	bool IsPartitionedByTab() const { return bPartitionByTab; }
+	bool IsPartitionedByWindow() const { return bPartitionByWindow; }
+
+private:
+	FUMWidgetMRUList& FindOrAddPartition(
+		TMap<uint64, FUMWidgetMRUList>& Partitions, const uint64 PartitionId);
+
+	static void PruneEmptyPartitions(TMap<uint64, FUMWidgetMRUList>& Partitions);
+
+	FUMWidgetMRUList			   GlobalList;
+	TMap<uint64, FUMWidgetMRUList> ListsByMajorTabId;
+	TMap<uint64, FUMWidgetMRUList> ListsByWindowId;
+
+	int32 PartitionDepth{ 10 };
+	bool  bPartitionByTab{ true };
+	bool  bPartitionByWindow{ true };
+
+	// Partitions of closed tabs are swept once this many are tracked
+	static constexpr int32 MaxPartitions = 64;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphSchema.h"
+
+struct FAssetData;
+
+/** A node creation action, with the text the action menu matches it by. */
+struct FVimGraphAction
+{
+	TSharedPtr<FEdGraphSchemaAction> Action;
+	FText							 DisplayText;
+	FText							 CategoryText;
+	FString							 NameLower;	  // Display name
+	FString							 SearchLower; // Name, category & keywords
+};
+
+struct FVimGraphActionList
+{
+	TArray<TSharedPtr<FVimGraphAction>> Actions;
+};
+
+/**
+ * Caches the node creation actions of a pin (what the graph's context menu
+ * would list when dragging off it), so adding a node doesn't re-gather the
+ * whole action database every time.
+ * Lists are keyed by the graph's schema & type, the pin's type & direction,
+ * and the Blueprint's class; function & macro graphs by the graph itself too
+ * (their local variables & parameters are theirs alone). Compiling or
+ * structurally changing a Blueprint (e.g. adding a variable) or any asset
+ * registry change (new functions, structs, macros...) drops every list.
+ */
+class FVimGraphActionCache
+{
+public:
+	void Init();
+	void Shutdown();
+
+	/**
+	 * @return The actions for dragging off the pin (or for the graph itself if
+	 * there's no pin); built on first use.
+	 */
+	TSharedRef<const FVimGraphActionList> FindOrBuild(UEdGraph* InGraph, UEdGraphPin* FromPin);
+
+	/** Drops every cached list. */
+	void Invalidate();
+
+private:
+	FString MakeKey(const UEdGraph* InGraph, const UEdGraphPin* FromPin) const;
+	void	BuildActions(UEdGraph* InGraph, UEdGraphPin* FromPin, FVimGraphActionList& OutList) const;
+	void	AddAction(const TSharedPtr<FEdGraphSchemaAction>& InAction, FVimGraphActionList& OutList) const;
+
+	void OnBlueprintCompiled();
+	void OnActionDatabaseEntryChanged(UObject* InActionKey);
+	void OnAssetAdded(const FAssetData& InAssetData);
+	void OnAssetRemoved(const FAssetData& InAssetData);
+	void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+
+	TMap<FString, TSharedRef<FVimGraphActionList>> ListsByKey;
+
+	FDelegateHandle DelegateHandle_OnBlueprintCompiled;
+	FDelegateHandle DelegateHandle_OnActionDatabaseEntryUpdated;
+	FDelegateHandle DelegateHandle_OnActionDatabaseEntryRemoved;
+	FDelegateHandle DelegateHandle_OnAssetAdded;
+	FDelegateHandle DelegateHandle_OnAssetRemoved;
+	FDelegateHandle DelegateHandle_OnAssetRenamed;
+};
@@ -7,9 +7,16 @@
 #include "UMLogger.h"
 #include "SGraphPanel.h"
 #include "VimInputProcessor.h"
+#include "VimGraphNavigationIndex.h"
+#include "VimGraphActionCache.h"
+#include "VimGraphPanController.h"
+#include "VimGraphExecutionOrder.h"
+#include "VimGraphNodeSearchIndex.h"
 #include "EditorSubsystem.h"
 #include "VimGraphEditorSubsystem.generated.h"
 
+class FTransactionObjectEvent;
+
 /**
  *
  */
@@ -50,6 +57,59 @@ public:
 
 	void HandleVimNodeNavigation(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
 
+	/**
+	 * Node "word" motions (w, b, e, ge) & chain edges (gg, G) along the
+	 * graph's cached execution order; counted motions are a single index move.
+	 * @return false if it isn't one of those motions, or the node isn't part
+	 * of an execution flow (leaving it to the link following navigation).
+	 */
+	bool HandleVimExecutionFlowNavigation(
+		FSlateApplication&			   SlateApp,
+		const TSharedRef<SGraphPanel>& GraphPanel,
+		UEdGraphNode*				   FromNode,
+		UEdGraphPin*				   FromPin,
+		const TArray<FInputChord>&	   InSequence);
+
+	/**
+	 * Moves to the nearest node in the direction (Alt + HJKL), or to the
+	 * next / previous node in reading order (']' / '['), whether or not it's
+	 * wired to the current one. Takes a count.
+	 */
+	void HandleVimSpatialNodeNavigation(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+
+	/**
+	 * Selects the node (extending the selection in Visual Mode if coming from
+	 * another one), brings it into view & tracks its first pin.
+	 * @return false if the node has no widget in the panel.
+	 */
+	bool JumpToNode(
+		FSlateApplication&			   SlateApp,
+		const TSharedRef<SGraphPanel>& GraphPanel,
+		UEdGraphNode*				   NewNode,
+		UEdGraphNode*				   FromNode);
+
+	/** @return The tracked node if it's still selected, else the last selected one. */
+	UEdGraphNode* GetCurrentNode(const TSharedRef<SGraphPanel>& GraphPanel);
+
+	//							~ Node Search ~
+	//
+	/**
+	 * '/': Starts typing a pattern to find a node of the graph by its title,
+	 * comment or pin default values. Each keystroke jumps to the best match
+	 * (the nearest one among equals); Enter keeps it, Escape returns to where
+	 * the search began.
+	 */
+	void BeginNodeSearch(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+	void HandleNodeSearchPromptKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+	void EndNodeSearchPrompt(FSlateApplication& SlateApp, const bool bRestoreNode);
+
+	/** Ranks the matches of the pattern typed so far & jumps to the first. */
+	void PreviewNodeSearchMatch(FSlateApplication& SlateApp);
+	void ShowNodeSearchPrompt(FSlateApplication& SlateApp);
+
+	/** n & N: cycle forward & backward through the last search's ranked matches. */
+	void SearchNextNode(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+
 	void HandleGraphPanelPanning(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 	void StopGraphPanelPanning(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 
@@ -65,9 +125,43 @@ public:
 
 	UEdGraphPin* GetFirstOrLastLinkedPinFromPin(const TSharedRef<SGraphPanel> GraphPanel, UEdGraphPin* InPin, EEdGraphPinDirection TargetDir);
 
+	/**
+	 * Lays out (or reverts the space made for) the node created off the pin.
+	 * @param CreatedNode The node our own action menu created; if null, the
+	 * selected node is taken when the graph has more nodes than before.
+	 */
 	void OnNodeCreationMenuClosed(
 		FSlateApplication& SlateApp,
-		UEdGraphPin* DraggedFromPin, bool bIsAppendingNode);
+		UEdGraphPin* DraggedFromPin, bool bIsAppendingNode,
+		UEdGraphNode* CreatedNode = nullptr);
+
+	/**
+	 * Opens the cached, fuzzy searchable action menu for the pin.
+	 * @return false if there are no cached actions to offer (e.g. the graph's
+	 * schema doesn't list any), leaving it to the graph's own menu.
+	 */
+	bool OpenActionMenuForPin(
+		FSlateApplication&			   SlateApp,
+		UEdGraphPin*				   InPin,
+		const TSharedRef<SGraphPanel>& GraphPanel,
+		bool						   bIsAppendingNode);
+
+	void CreateNodeFromAction(
+		FSlateApplication&				   SlateApp,
+		const TSharedPtr<FVimGraphAction>& InAction,
+		UEdGraphPin*					   InPin,
+		bool							   bIsAppendingNode);
+
+	/**
+	 * Waits for the panel to spawn the new node's widget (it does so on its
+	 * next update), then lays the node out.
+	 */
+	void OnActionMenuNodeCreated(
+		FSlateApplication&			 SlateApp,
+		TWeakObjectPtr<UEdGraphNode> NewNode,
+		UEdGraphPin*				 InPin,
+		bool						 bIsAppendingNode,
+		int32						 TicksLeft);
 
 	bool GetPinToLinkedPinDelta(
 		const TSharedRef<SGraphNode> InNode, UEdGraphPin* InPin,
@@ -80,15 +174,25 @@ public:
 		const TSharedRef<SGraphNode> LinkedNode,
 		bool						 bIsAppendingNode);
 
+	/**
+	 * Breadth-first collects the start node & everything downstream of it
+	 * (through output links) that wasn't visited yet.
+	 * @param Visited Over the graph's node indices (see FindNodeIndex); shared
+	 * between calls to collect from several start nodes at once.
+	 */
 	void CollectDownstreamNodes(
-		UEdGraphPin*		 StartPin,
-		UEdGraphNode*		 StartNode,
-		TSet<UEdGraphNode*>& OutNodes,
-		bool				 bIsAppending);
+		FVimGraphNavigationIndex& NavIndex,
+		UEdGraphNode*			  StartNode,
+		TBitArray<>&			  Visited,
+		TArray<UEdGraphNode*>&	  OutNodes);
 
+	/**
+	 * Shifts the nodes along X as a single undoable step, snapshotting their
+	 * positions for RevertShiftedNodes.
+	 */
 	void ShiftNodesForSpace(
 		const TSharedPtr<SGraphPanel>& GraphPanel,
-		const TSet<UEdGraphNode*>&	   NodesToMove,
+		const TArray<UEdGraphNode*>&   NodesToMove,
 		float						   ShiftAmountX);
 
 	void RevertShiftedNodes(const TSharedPtr<SGraphPanel>& GraphPanel);
@@ -109,16 +213,26 @@ public:
 	UEdGraphNode* FindEdgeNodeInChain(
 		const TArray<UEdGraphNode*>& SelectedNodes, bool bFindFirstNode);
 
+	/**
+	 * @param OutgoingConnections Indices (into Nodes) each node links to.
+	 * @return The node on the far end (first or last) of the longest path
+	 * through the nodes, in linear time. Cycles are broken where they're met.
+	 */
 	UEdGraphNode* FindFarthestNode(
-		const TArray<UEdGraphNode*>&					  Candidates,
-		const TMap<UEdGraphNode*, TArray<UEdGraphNode*>>& OutgoingConnections,
-		bool											  bFindFirstNode);
+		const TArray<UEdGraphNode*>& Nodes,
+		const TArray<TArray<int32>>& OutgoingConnections,
+		bool						 bFindFirstNode);
 
-	void MoveConnectedNodesToRight(UEdGraphNode* StartNode, float OffsetX);
+	void BenchmarkFindEdgeNodeInChain(const int32 NumNodes);
+
+	void MoveConnectedNodesToRight(const TSharedRef<SGraphPanel> GraphPanel, UEdGraphNode* StartNode, float OffsetX);
 
 	void HandleOnContextBindingChanged(EUMBindingContext NewContext, const TSharedRef<SWidget> NewWidget);
 
 	void HandleOnGraphChanged(const FEdGraphEditAction& InAction);
+	void HandleOnNavigationGraphChanged(const FEdGraphEditAction& InAction);
+	void HandleOnObjectModified(UObject* InObject);
+	void HandleOnObjectTransacted(UObject* InObject, const FTransactionObjectEvent& InEvent);
 	void HandleOnSelectionChanged(const FGraphPanelSelectionSet& GraphPanelSelectionSet);
 	void UnhookFromActiveGraphPanel();
 	void DeleteNode(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
@@ -139,13 +253,19 @@ public:
 		UEdGraphNode*				  SelectedNode);
 
 	bool TryGetNearestLinkedPin(
-		const TArray<UEdGraphPin*>& InSortedObjPins, UEdGraphPin*& OutPin,
+		const FVimGraphNodePins& InNodePins, UEdGraphPin*& OutPin,
 		int32 TrackedPinIndex, EEdGraphPinDirection FollowDir);
 
 	bool TryGetParallelPin(
-		const TArray<TSharedRef<SWidget>> InWidgetPins,
+		const FVimGraphNodePins& InNodePins,
 		int32 BasePinIndex, EEdGraphPinDirection TargetDir,
-		TSharedPtr<SGraphPin>& OutPinWidget, bool bShouldMatchExactIndex = false);
+		TSharedPtr<SGraphPin>& OutPinWidget);
+
+	/**
+	 * @return The navigation index of the panel, re-pointed at it (and its
+	 * graph's change events) if it was indexing another one.
+	 */
+	FVimGraphNavigationIndex& GetNavigationIndex(const TSharedRef<SGraphPanel> GraphPanel);
 
 	void OnVimModeChanged(const EVimMode NewVimMode);
 
@@ -184,7 +304,6 @@ public:
 	EVimMode					PreviousVimMode{ EVimMode::Insert }, CurrentVimMode{ EVimMode::Insert };
 	EUMBindingContext			CurrentContext{ EUMBindingContext::Generic };
 	FDelegateHandle				DelegateHandle_OnKeyUpEvent;
-	FTimerHandle				TimerHandle_GraphPanning;
 	TArray<FKey>				PressedPanningKeys;
 	FVector2D					CurrentPanelOffset;
 	const TMap<FKey, FVector2D> PanOffsetByMotion{
@@ -195,7 +314,13 @@ public:
 	};
 
 	// We’ll store the original positions of any nodes we shift
-	TMap<TWeakObjectPtr<UEdGraphNode>, FVector2D> ShiftedNodesOriginalPositions;
+	struct FShiftedNode
+	{
+		TWeakObjectPtr<UEdGraphNode> Node;
+		int32						 OriginalPosX;
+		int32						 OriginalPosY;
+	};
+	TArray<FShiftedNode> ShiftedNodes;
 
 	// We’ll track whether we’re currently in a “shifted” state
 	// so we know whether to revert on menu close.
@@ -240,4 +365,28 @@ public:
 	FDelegateHandle					  OnGraphChangedHandler;
 	SGraphEditor::FOnSelectionChanged OnSelectionChangedOriginDelegate;
 	TWeakPtr<SGraphPanel>			  ActiveGraphPanel;
+
+	FVimGraphNavigationIndex NavigationIndex;
+	TWeakObjectPtr<UEdGraph> NavigationIndexGraph;
+	FDelegateHandle			 DelegateHandle_OnNavigationGraphChanged;
+	FDelegateHandle			 DelegateHandle_OnObjectModified;
+	FDelegateHandle			 DelegateHandle_OnObjectTransacted;
+
+	FVimGraphActionCache	 ActionCache;
+	FVimGraphPanController	 PanController;
+	FVimGraphExecutionOrder	 ExecutionOrder;
+	FVimGraphNodeSearchIndex NodeSearchIndex;
+
+	struct FNodeSearch
+	{
+		FString								 PromptPattern;
+		FString								 Pattern;						  // Last searched for
+		TArray<TWeakObjectPtr<UEdGraphNode>> Matches;						  // Ranked
+		int32								 MatchIndex{ INDEX_NONE };
+		TWeakObjectPtr<UEdGraphNode>		 OriginNode;					  // Where the prompt began
+		FVector2D							 Origin{ FVector2D::ZeroVector }; // Graph space; ranks ties
+		TWeakPtr<SGraphPanel>				 GraphPanel;
+		bool								 bIsPromptActive{ false };
+	};
+	FNodeSearch NodeSearch;
 };
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraph.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Execution flow view of a single graph, for the node "word" motions (w, b,
+ * e, ge) and the chain edge motions (gg, G).
+ * Nodes with execution pins are linked to their successors & predecessors
+ * through those pins only, then laid out in one topological order per entry
+ * (event, function entry, or any node nothing executes into): a chain. Branch
+ * outputs are walked in pin order (Then 0 before Then 1), and a node that
+ * several branches merge into comes after all of them.
+ * Graphs without execution pins (Materials, etc.) flow through all links.
+ * Motions are then index moves within the node's chain. Built lazily; any
+ * edit to the graph invalidates it.
+ */
+class FVimGraphExecutionOrder
+{
+public:
+	/** Points the view at the graph, dropping whatever it knew of another. */
+	void Bind(UEdGraph* InGraph);
+	void Invalidate() { bIsDirty = true; }
+
+	UEdGraph* GetGraph() const { return Graph.Get(); }
+
+	/** @return Whether the node takes part in the graph's execution flow. */
+	bool Contains(const UEdGraphNode* InNode);
+
+	/**
+	 * Steps through the node's chain in execution order, stopping at its
+	 * first & last nodes.
+	 * @return nullptr if the node isn't part of any chain.
+	 */
+	UEdGraphNode* FindInChain(const UEdGraphNode* FromNode, const int32 Offset);
+
+	/** @return The first (entry) or last node of the node's chain. */
+	UEdGraphNode* FindChainEdge(const UEdGraphNode* FromNode, const bool bFindFirstNode);
+
+private:
+	struct FChain
+	{
+		int32 Start{ 0 }; // In Order
+		int32 Num{ 0 };
+	};
+
+	void Rebuild();
+	void AddChain(const int32 RootIndex, TBitArray<>& Visited);
+
+	/** @return The node's index, or INDEX_NONE; building the view if stale. */
+	int32 FindNodeIndex(const UEdGraphNode* InNode);
+
+	TWeakObjectPtr<UEdGraph>			  Graph;
+	TArray<TWeakObjectPtr<UEdGraphNode>>  Nodes;
+	TMap<TObjectKey<UEdGraphNode>, int32> IndexByNode;
+	TArray<int32>						  SuccessorOffsets; // Node i's are at [Offsets[i], Offsets[i + 1])
+	TArray<int32>						  Successors;
+	TArray<int32>						  PredecessorOffsets;
+	TArray<int32>						  Predecessors;
+	TArray<int32>						  Order;	  // Node indices, chain after chain
+	TArray<int32>						  OrderIndex; // Of each node
+	TArray<int32>						  ChainOfNode;
+	TArray<FChain>						  Chains;
+	bool								  bIsDirty{ true };
+};
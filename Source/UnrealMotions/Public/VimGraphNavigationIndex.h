@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraph.h"
+#include "SGraphNode.h"
+#include "SGraphPanel.h"
+#include "SGraphPin.h"
+#include "UObject/ObjectKey.h"
+#include "VimGraphSpatialGrid.h"
+
+/**
+ * A node's visible pins, in the order the HJKL navigation walks them (as the
+ * node widget lays them out; inputs first), split per direction.
+ */
+struct FVimGraphNodePins
+{
+	TWeakPtr<SGraphNode>		NodeWidget;
+	TArray<TWeakPtr<SGraphPin>> Widgets;
+	TArray<UEdGraphPin*>		Objs;		  // Parallel to Widgets
+	TArray<int32>				GroupIndices; // Of each pin within its direction
+	TArray<int32>				Inputs;		  // Pin indices, top to bottom
+	TArray<int32>				Outputs;
+	TMap<UEdGraphPin*, int32>	IndexByPin;
+
+	// What the pins were built from; any change means they're stale
+	int32					NumNodePins{ 0 };
+	ENodeAdvancedPins::Type AdvancedPinDisplay{ ENodeAdvancedPins::NoPins };
+	uint32					PinVisibilityHash{ 0 }; // Of all pin widgets, shown or not
+
+	int32 Num() const { return Objs.Num(); }
+
+	/** @return The pin's index, or INDEX_NONE if it isn't visible. */
+	int32 FindPin(const UEdGraphPin* InPin) const;
+
+	const TArray<int32>& GetGroup(const EEdGraphPinDirection Direction) const
+	{
+		return Direction == EGPD_Input ? Inputs : Outputs;
+	}
+
+	/**
+	 * @return The pin on the same row on the other side (or the other side's
+	 * last, if it has fewer pins), or INDEX_NONE if that side has none.
+	 */
+	int32 FindParallelPin(const int32 PinIndex, const EEdGraphPinDirection TargetDir) const;
+
+	/**
+	 * @return The closest linked pin of the direction (searching up & down
+	 * from PinIndex, up first), or INDEX_NONE if none is linked.
+	 * Links are read live, so connection edits never leave this stale.
+	 */
+	int32 FindNearestLinkedPin(const int32 PinIndex, const EEdGraphPinDirection FollowDir) const;
+};
+
+/**
+ * Navigation index of a single Graph Panel: resolves nodes to their widgets
+ * and visible pins through hash lookups, instead of scanning the panel's
+ * children & the node's pins on every keystroke.
+ * Node widgets are (re)collected lazily after nodes were added or removed,
+ * and a node's pins are rebuilt the first time they're found stale (e.g.
+ * after the node widget regenerated its pins).
+ * It also keeps the spatial grid of the graph's nodes; edited & moved nodes
+ * are queued and re-read right before the next spatial query.
+ */
+class FVimGraphNavigationIndex
+{
+public:
+	/**
+	 * Points the index at the panel, dropping whatever it knew of another.
+	 * @return true if it was pointed at a different panel.
+	 */
+	bool Bind(const TSharedRef<SGraphPanel>& InPanel);
+	void Reset();
+
+	TSharedPtr<SGraphPanel> GetPanel() const { return Panel.Pin(); }
+
+	TSharedPtr<SGraphNode> FindNodeWidget(const UEdGraphNode* InNode);
+
+	/**
+	 * @return The node's dense index within the graph (for bitsets over its
+	 * nodes; see NumGraphNodes), or INDEX_NONE if it isn't in the graph.
+	 * Indices are only stable until nodes are added or removed.
+	 */
+	int32 FindNodeIndex(const UEdGraphNode* InNode);
+	int32 NumGraphNodes();
+
+	/**
+	 * @return The node's visible pins, built on first use (or when stale),
+	 * or nullptr if the node has no widget in the panel.
+	 * @note Entries are heap allocated; the pointer survives other lookups.
+	 */
+	const FVimGraphNodePins* FindNodePins(UEdGraphNode* InNode);
+
+	TSharedPtr<SGraphPin> FindPinWidget(UEdGraphPin* InPin);
+
+	/**
+	 * @return The spatial grid of the panel's nodes, brought up to date with
+	 * whatever nodes were edited or moved since the last query.
+	 */
+	FVimGraphSpatialGrid& GetSpatialGrid();
+
+	/** Forgets what the graph edit may have affected. */
+	void OnGraphChanged(const FEdGraphEditAction& InAction);
+
+	/** Queues the node to be re-read (e.g. it's about to be moved). */
+	void OnNodeModified(UEdGraphNode* InNode);
+
+	int32 Num() const { return NodeWidgets.Num(); }
+
+private:
+	void CollectNodeWidgets();
+	void CollectNodeIndices();
+	void BuildNodePins(const TSharedRef<SGraphNode>& InNodeWidget,
+		const TArray<TSharedRef<SWidget>>& InPinWidgets, FVimGraphNodePins& OutPins);
+
+	/**
+	 * @return A hash of which pin widgets are visible. Pins get hidden or shown
+	 * without the node's pins changing (e.g. hiding unconnected pins).
+	 */
+	static uint32 HashPinVisibility(const TArray<TSharedRef<SWidget>>& InPinWidgets);
+
+	/**
+	 * @return The node's graph-space bounds. Sized by its widget; sizeless
+	 * (false) if the widget wasn't laid out yet.
+	 */
+	bool GetNodeBounds(UEdGraphNode* InNode, FBox2D& OutBounds);
+
+	TWeakPtr<SGraphPanel>										  Panel;
+	TMap<TObjectKey<UEdGraphNode>, TWeakPtr<SGraphNode>>		  NodeWidgets;
+	TMap<TObjectKey<UEdGraphNode>, TUniquePtr<FVimGraphNodePins>> NodePins;
+	bool														  bAreNodeWidgetsDirty{ true };
+	uint64														  LastCollectFrame{ MAX_uint64 };
+	TMap<TObjectKey<UEdGraphNode>, int32>						  NodeIndices;
+	bool														  bAreNodeIndicesDirty{ true };
+	FVimGraphSpatialGrid										  SpatialGrid;
+	TSet<TWeakObjectPtr<UEdGraphNode>>							  DirtySpatialNodes;
+	bool														  bIsSpatialGridDirty{ true }; // Rebuild from all of the graph's nodes
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraph.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Search index of a single graph's nodes, for the graph's '/' node finder:
+ * each node's lowercased title, comment & pin default values.
+ * Built once per graph, then kept up to date entry by entry; added & removed
+ * nodes are (un)indexed as the graph reports them, and edited nodes are
+ * queued and re-read right before the next search.
+ * Typing on narrows down the previous keystroke's matches instead of
+ * scanning the whole graph again.
+ */
+class FVimGraphNodeSearchIndex
+{
+public:
+	/** Points the index at the graph, dropping whatever it knew of another. */
+	void Bind(UEdGraph* InGraph);
+	void Reset();
+
+	UEdGraph* GetGraph() const { return Graph.Get(); }
+
+	/**
+	 * Ranks the nodes the query fuzzy matches: by score first (titles over
+	 * comments over pin defaults), then the closest to the origin first.
+	 * @param InOrigin Graph space position (e.g. the current node's).
+	 */
+	void Search(const FString& InQuery, const FVector2D& InOrigin, TArray<UEdGraphNode*>& OutMatches);
+
+	void OnGraphChanged(const FEdGraphEditAction& InAction);
+
+	/** Queues the node to be re-read (e.g. its comment is being edited). */
+	void OnNodeModified(UEdGraphNode* InNode);
+
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<UEdGraphNode> Node;
+		TObjectKey<UEdGraphNode>	 Key; // Still finds its lookup once destroyed
+		FString						 TitleLower;
+		FString						 CommentLower;
+		FString						 DefaultsLower; // Of the unlinked input pins
+	};
+
+	void Rebuild();
+	void Refresh();
+	void AddNode(UEdGraphNode* InNode);
+	void RemoveNode(const UEdGraphNode* InNode);
+	void ReadEntry(UEdGraphNode* InNode, FEntry& OutEntry) const;
+
+	/**
+	 * @return The score of the entry's best matching field, or INDEX_NONE if
+	 * none matches. Fields rank in tiers: any title match beats any comment
+	 * match, which beats any pin default match.
+	 */
+	int32 ScoreEntry(const FEntry& InEntry, const FString& QueryLower) const;
+
+	TWeakObjectPtr<UEdGraph>			  Graph;
+	TArray<FEntry>						  Entries;
+	TMap<TObjectKey<UEdGraphNode>, int32> IndexByNode;
+	TSet<TWeakObjectPtr<UEdGraphNode>>	  DirtyNodes;
+	bool								  bIsDirty{ true }; // Rebuild from all of the graph's nodes
+
+	// The last search's matches (entry indices); valid until entries change
+	FString		  LastQueryLower;
+	TArray<int32> LastMatches;
+	bool		  bAreLastMatchesValid{ false };
+
+	static constexpr int32 TitleTier = 2;
+	static constexpr int32 CommentTier = 1;
+	static constexpr int32 DefaultsTier = 0;
+	static constexpr int32 TierStride = 1 << 20; // Above any single field's score
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SGraphPanel.h"
+
+/**
+ * Pans a Graph Panel's view smoothly, integrated per frame from Slate's delta
+ * time (so it moves the same at any frame rate).
+ * - Held directions accelerate the view up to a top speed, and let it slow
+ *   down to a stop once released. Diagonals are as fast as straight lines.
+ * - Glides ease the view towards a target offset (e.g. to bring a node into
+ *   view), quickly at first and gently at the end.
+ * Only ticks while there's something to move; idle it isn't registered.
+ */
+class FVimGraphPanController
+{
+public:
+	~FVimGraphPanController();
+
+	/**
+	 * Sets the direction panning is held in (the sum of the held keys'
+	 * directions); zero releases it.
+	 */
+	void SetHeldDirection(const TSharedRef<SGraphPanel>& InPanel, const FVector2D& InDirection);
+
+	/** Eases the panel's view offset to the target. */
+	void GlideTo(const TSharedRef<SGraphPanel>& InPanel, const FVector2D& InTargetOffset);
+
+	/**
+	 * @return Where the panel's view is heading; its current offset, plus
+	 * whatever of a glide is still ahead.
+	 */
+	FVector2D GetTargetViewOffset(const TSharedRef<SGraphPanel>& InPanel) const;
+
+	/** Halts any movement at once. */
+	void Stop();
+
+	bool IsMoving() const { return DelegateHandle_OnPreTick.IsValid(); }
+
+private:
+	void StartTicking();
+	void OnPreTick(float DeltaTime);
+
+	/** @return false if the panel (or its editor) is gone. */
+	bool ApplyViewDelta(const FVector2D& InGraphDelta);
+
+	TWeakPtr<SGraphPanel> Panel;
+	FVector2D			  HeldDirection{ FVector2D::ZeroVector };  // Normalized
+	FVector2D			  Velocity{ FVector2D::ZeroVector };	   // Panel space, per second
+	FVector2D			  GlideRemaining{ FVector2D::ZeroVector }; // Graph space
+	FDelegateHandle		  DelegateHandle_OnPreTick;
+
+	static constexpr float MaxSpeed = 1400.f;	  // Panel space px / sec
+	static constexpr float Acceleration = 6000.f; // px / sec^2
+	static constexpr float Deceleration = 9000.f;
+	static constexpr float GlideSharpness = 14.f; // Higher glides faster
+};
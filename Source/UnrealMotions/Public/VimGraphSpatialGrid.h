@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphNode.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Uniform grid over the graph-space bounds of a graph's nodes, answering the
+ * spatial node motions (nearest node in a direction, next node in reading
+ * order) without visiting every node of the graph.
+ * Nodes are bucketed by their center; entries are updated in place as nodes
+ * move, so the grid never has to be rebuilt for a single node's sake.
+ */
+class FVimGraphSpatialGrid
+{
+public:
+	explicit FVimGraphSpatialGrid(const float InCellSize = 512.f)
+		: CellSize(InCellSize) {}
+
+	void Reset();
+	void Reserve(const int32 InNum);
+
+	/** Adds the node, or moves it to its new bounds. */
+	void Update(UEdGraphNode* InNode, const FBox2D& InBounds);
+	void Remove(const UEdGraphNode* InNode);
+
+	bool Contains(const UEdGraphNode* InNode) const { return IndexByNode.Contains(InNode); }
+	int32 Num() const { return Entries.Num(); }
+
+	/**
+	 * Finds the closest node lying ahead of the node's center in the direction.
+	 * Distance along the direction counts once, sideways distance twice, so
+	 * nodes in line with the origin are preferred over diagonal ones.
+	 * @param Direction Expected to be one of the axes (e.g. (1, 0) for right).
+	 * @return nullptr if there's no node that way.
+	 */
+	UEdGraphNode* FindNearestInDirection(const UEdGraphNode* FromNode, const FVector2D& Direction) const;
+
+	/**
+	 * Steps through the nodes in reading order: rows top to bottom, then left
+	 * to right within a row (nodes whose tops are within a row band of each
+	 * other share a row). Stops at the first & last nodes.
+	 * @return nullptr if the node isn't in the grid.
+	 */
+	UEdGraphNode* FindInReadingOrder(const UEdGraphNode* FromNode, const int32 Offset);
+
+private:
+	struct FEntry
+	{
+		TObjectKey<UEdGraphNode> Node;
+		FBox2D					 Bounds{ ForceInit };
+		FIntPoint				 Cell{ 0, 0 };
+		int32					 Rank{ INDEX_NONE }; // In ReadingOrder
+	};
+
+	FIntPoint GetCell(const FVector2D& InPoint) const;
+
+	void AddToCell(const FIntPoint& InCell, const int32 EntryIndex);
+	void RemoveFromCell(const FIntPoint& InCell, const int32 EntryIndex);
+	void SortReadingOrder();
+
+	float								  CellSize;
+	TArray<FEntry>						  Entries;
+	TMap<TObjectKey<UEdGraphNode>, int32> IndexByNode;
+	TMap<FIntPoint, TArray<int32>>		  Cells; // Entry indices by cell
+	FIntPoint							  MinCell{ 0, 0 };
+	FIntPoint							  MaxCell{ 0, 0 }; // Grows only; reset with the grid
+	TArray<int32>						  ReadingOrder;
+	bool								  bIsReadingOrderDirty{ true };
+
+	static constexpr float ReadingRowBand = 96.f;
+};
@@ -14,10 +14,11 @@ class SBufferVisualizer;
 UENUM(BlueprintType)
 enum class EVimMode : uint8
 {
-	Normal	   UMETA(DisplayName = "Normal"),
-	Insert	   UMETA(DisplayName = "Insert"),
-	Visual	   UMETA(DisplayName = "Visual"),
-	VisualLine UMETA(DisplayName = "Visual Line"),
+	Normal		UMETA(DisplayName = "Normal"),
+	Insert		UMETA(DisplayName = "Insert"),
+	Visual		UMETA(DisplayName = "Visual"),
+	VisualLine	UMETA(DisplayName = "Visual Line"),
+	VisualBlock	UMETA(DisplayName = "Visual Block"),
 
 	// Used mainly for binding to comply with any of the above modes
 	// (except Insert of course which will naturally be ignored)
@@ -48,6 +49,14 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FUMOnCountPrefix, FString);
  */
 DECLARE_MULTICAST_DELEGATE(FUMOnResetSequence);
 
+/**
+ * Delegate that broadcasts when a key is about to start a new command
+ * @note Not while typing in Insert mode, nor mid-sequence, mid-count or while
+ * possessed; i.e. everything since the previous broadcast was one command
+ * (or one Insert mode session).
+ */
+DECLARE_MULTICAST_DELEGATE(FUMOnCommandBoundary);
+
 /**
  * Delegate that broadcasts when the Vim editing mode changes
  * @param EVimMode - The new mode being switched to (Normal, Insert, or Visual)
@@ -527,11 +536,6 @@ private:
 	 * @note Broadcasts reset event, clears current sequence and buffer, and removes buffer visualization
 	 */
 	void ResetSequence(FSlateApplication& SlateApp);
-	/**
-	 * Cleans up and removes the buffer visualization overlay
-	 * @param SlateApp - Reference to the Slate application instance
-	 */
-	void ResetBufferVisualizer(FSlateApplication& SlateApp);
 
 	/**
 	 * Processes numeric keys for command repeat counts
@@ -574,12 +578,32 @@ public:
 		FSlateApplication& SlateApp, const FKey& SimulatedKey,
 		const FModifierKeysState& ModifierKeys = FModifierKeysState(), bool bSetNativeInputHandling = true);
 
+	/**
+	 * Running total of the key presses issued via SimulateKeyPress. Diff it
+	 * around a motion to see how many synthetic round-trips the motion costs.
+	 */
+	static uint32 GetSimulatedKeyPressCount() { return SimulatedKeyPressCount; }
+
 	// Buffer Visualizer:
 	void CheckCreateBufferVisualizer(
 		FSlateApplication& SlateApp, const FKey& InKey);
 
 	void UpdateBufferAndVisualizer(const FKey& InKey);
 
+	/**
+	 * Shows arbitrary text in the buffer visualizer (e.g. a search pattern
+	 * typed while possessing the processor) instead of the key sequence.
+	 * @param SlateApp - Reference to the Slate application instance
+	 * @param InText - The text to show
+	 */
+	void ShowInBufferVisualizer(FSlateApplication& SlateApp, const FString& InText);
+
+	/**
+	 * Cleans up and removes the buffer visualization overlay
+	 * @param SlateApp - Reference to the Slate application instance
+	 */
+	void ResetBufferVisualizer(FSlateApplication& SlateApp);
+
 	// Possess: Bind the object's member function to the delegate
 	template <typename UserClass>
 	void Possess(UserClass* InObject, void (UserClass::*InMethod)(FSlateApplication&, const FKeyEvent&))
@@ -597,6 +621,14 @@ public:
 
 	int32 GetCountBuffer();
 
+	/**
+	 * Lets a callback apply the whole count prefix itself (e.g. iterate a
+	 * motion N times and update the cursor once), instead of being invoked
+	 * once per repetition.
+	 * @return The count prefix (1 if none was typed).
+	 */
+	int32 ConsumeCountPrefix();
+
 	//
 	/////////////////////////////////////////////////////////////////////////
 
@@ -634,6 +666,7 @@ private:
 
 	/** Static instance management */
 	static bool bNativeInputHandling;
+	static uint32 SimulatedKeyPressCount;
 
 	/** Buffer */
 	TArray<FInputChord>			  CurrentSequence;	// Current Input Sequence
@@ -646,11 +679,12 @@ private:
 
 public:
 	/** Event delegates */
-	FOnVimModeChanged  OnVimModeChanged;
-	FUMOnCountPrefix   OnCountPrefix;
-	FUMOnResetSequence OnResetSequence;
-	FUMOnKeyDown	   Delegate_OnKeyDown;
-	FUMOnKeyUpEvent	   Delegate_OnKeyUpEvent;
+	FOnVimModeChanged	 OnVimModeChanged;
+	FUMOnCountPrefix	 OnCountPrefix;
+	FUMOnResetSequence	 OnResetSequence;
+	FUMOnCommandBoundary OnCommandBoundary;
+	FUMOnKeyDown		 Delegate_OnKeyDown;
+	FUMOnKeyUpEvent		 Delegate_OnKeyUpEvent;
 
 	// Map to track objects and their binding handles
 	TMap<UObject*, FDelegateHandle> PossessedObjects;
@@ -664,6 +698,7 @@ public:
 	FTimerHandle TimerHandle_LinearPress;
 
 	FString		CountBuffer;
+	bool		bIsCountPrefixConsumed{ false };
 	const int32 MIN_REPEAT_COUNT = 1;
 	const int32 MAX_REPEAT_COUNT = 999;
 
@@ -0,0 +1,340 @@
+#pragma once
+
+// Engine-independent core of the Vim text motions.
+// Pure functions over a view of chars, depending on nothing but the standard
+// library, so it compiles (and can be exercised) outside of Unreal as well.
+// FVimTextEditorUtils is the Unreal-facing adapter over it.
+
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Character type enumeration used for word boundary detection
+ */
+enum class EUMCharType : uint8_t
+{
+	Word,	   // Alphanumeric or underscore
+	Symbol,	   // Non-word, non-whitespace (punctuation, etc.)
+	Whitespace // Space, tab, etc.
+};
+
+/**
+ * Compile-time class table for the ASCII / Latin-1 range (0-255).
+ * Word: alphanumerics, underscore & the Latin-1 letters (sans the math signs).
+ * Whitespace: tab through carriage return, space, NEL & no-break space.
+ */
+struct FUMCharClassTable
+{
+	constexpr FUMCharClassTable()
+		: Classes{}
+	{
+		for (int32_t c = 0; c < 256; ++c)
+		{
+			if ((c >= 0x09 && c <= 0x0D) || c == 0x20 || c == 0x85 || c == 0xA0)
+				Classes[c] = EUMCharType::Whitespace;
+
+			else if ((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z')
+				|| (c >= 'a' && c <= 'z') || c == '_'
+				|| c == 0xAA || c == 0xB5 || c == 0xBA
+				|| (c >= 0xC0 && c != 0xD7 && c != 0xF7))
+				Classes[c] = EUMCharType::Word;
+
+			else
+				Classes[c] = EUMCharType::Symbol;
+		}
+	}
+
+	EUMCharType Classes[256];
+};
+
+/** Non-owning view over a run of chars (e.g. an FString's buffer). */
+template <typename CharType>
+struct TVimTextView
+{
+	const CharType* Data{ nullptr };
+	int32_t			Len{ 0 };
+
+	CharType operator[](const int32_t Index) const { return Data[Index]; }
+};
+
+/** The kinds of text objects (what follows the "i" / "a" in e.g. "diw"). */
+enum class EUMTextObjectType : uint8_t
+{
+	Word,	   // iw / aw
+	BigWord,   // iW / aW
+	Quote,	   // i" / a", i' / a', i` / a`
+	Bracket,   // i( / a(, i{ / a{, i[ / a[, i< / a<
+	Paragraph, // ip / ap
+};
+
+/** The motions an operator (d, c, y, >, <) can be applied over. */
+enum class EUMTextMotion : uint8_t
+{
+	Left,			// h
+	Right,			// l
+	LinesUp,		// k (linewise)
+	LinesDown,		// j (linewise)
+	CurrentLine,	// The doubled operator: dd, cc, yy, >>, << (linewise)
+	FirstLine,		// gg (linewise)
+	LastLine,		// G (linewise)
+	LineStart,		// 0
+	LineEnd,		// $
+	WordStart,		// w
+	BigWordStart,	// W
+	WordEnd,		// e
+	BigWordEnd,		// E
+	WordBack,		// b
+	BigWordBack,	// B
+	PrevWordEnd,	// ge
+	PrevBigWordEnd, // gE
+	FindChar,		// f
+	FindCharBack,	// F
+	TillChar,		// t
+	TillCharBack,	// T
+};
+
+/** What an operator applies to: a motion's or a text object's range. */
+struct FVimTextRange
+{
+	int32_t Start{ 0 };
+	int32_t End{ 0 }; // Exclusive
+
+	/** Whole lines: from the first line's start to the last line's end (sans
+	 * its line break). */
+	bool bLinewise{ false };
+};
+
+/** Line index & offset within that line (what FTextLocation holds). */
+struct FVimTextPosition
+{
+	int32_t Line{ 0 };
+	int32_t Offset{ 0 };
+};
+
+/**
+ * Word motions (w, b, e, ge & their WORD variants), word boundaries, text
+ * objects and absolute offset <-> line position conversions.
+ * Positions are absolute offsets into the view. Lines are split on '\n'.
+ * Instantiated for char, wchar_t & char16_t (see VimTextCore.cpp).
+ */
+template <typename CharType>
+class TVimTextCore
+{
+public:
+	using FView = TVimTextView<CharType>;
+
+	//							~ Char Classification ~
+	//
+	/**
+	 * Classifies a single char: a table lookup for the ASCII / Latin-1 range,
+	 * falling back to a search over the Unicode whitespace, punctuation &
+	 * symbol ranges above it. Independent of the C library's locale.
+	 */
+	static inline EUMCharType ClassifyChar(const CharType Char)
+	{
+		const uint32_t Code = static_cast<uint32_t>(
+			static_cast<std::make_unsigned_t<CharType>>(Char));
+		return Code < 256 ? CharClassTable.Classes[Code] : ClassifyCharSlow(Code);
+	}
+
+	static inline bool IsWhitespaceChar(const CharType Char)
+	{
+		return ClassifyChar(Char) == EUMCharType::Whitespace;
+	}
+
+	static inline bool IsWordChar(const CharType Char)
+	{
+		return ClassifyChar(Char) == EUMCharType::Word;
+	}
+
+	/** @return The type at the position; Whitespace when out of bounds. */
+	static EUMCharType GetCharType(const FView Text, const int32_t Position);
+
+	/**
+	 * Scans a run of chars matching (or, if bNegate, not matching) the type,
+	 * checking blocks of chars per step before settling on the exact end.
+	 * @return The position right after the run when going forward, or the
+	 * first position of the run when going backward.
+	 */
+	static int32_t ScanCharRun(const FView Text, const int32_t StartPos,
+		const int32_t Direction, const EUMCharType Type, const bool bNegate = false);
+
+	static int32_t SkipCharType(const FView Text, const int32_t StartPos,
+		const int32_t Direction, const EUMCharType TypeToSkip);
+	static int32_t SkipWhitespace(const FView Text, const int32_t StartPos, const int32_t Direction);
+	static int32_t SkipNonWhitespace(const FView Text, const int32_t StartPos, const int32_t Direction);
+
+	//							~ Word Motions ~
+	//
+	static int32_t FindNextWordBoundary(const FView Text, const int32_t CurrentPos, const bool bBigWord);
+	static int32_t FindPreviousWordBoundary(const FView Text, const int32_t CurrentPos, const bool bBigWord);
+	static int32_t FindNextWordEnd(const FView Text, const int32_t CurrentPos, const bool bBigWord);
+	static int32_t FindPreviousWordEnd(const FView Text, const int32_t CurrentPos, const bool bBigWord);
+
+	static int32_t FindNextBigWordBoundary(const FView Text, const int32_t CurrentPos);
+	static int32_t FindPreviousBigWordBoundary(const FView Text, const int32_t CurrentPos);
+	static int32_t FindNextSmallWordBoundary(const FView Text, const int32_t CurrentPos);
+	static int32_t FindPreviousSmallWordBoundary(const FView Text, const int32_t CurrentPos);
+	static int32_t FindNextBigWordEnd(const FView Text, const int32_t CurrentPos);
+	static int32_t FindPreviousBigWordEnd(const FView Text, const int32_t CurrentPos);
+	static int32_t FindNextSmallWordEnd(const FView Text, const int32_t CurrentPos);
+	static int32_t FindPreviousSmallWordEnd(const FView Text, const int32_t CurrentPos);
+
+	/**
+	 * Finds the run of same-type chars around the position (iw).
+	 * @return false if the position is out of the text's bounds.
+	 */
+	static bool GetAbsWordBoundaries(const FView Text, const int32_t CurrentPos,
+		int32_t& OutStart, int32_t& OutEnd);
+
+	//							~ Text Objects ~
+	//
+	/** How far (in chars) bracket matching may scan to either side. */
+	static constexpr int32_t DefaultBracketScanLimit = 1 << 20;
+
+	/**
+	 * Resolves the text object around (or, for quotes, after) the position.
+	 * @param bAround The "a" variant, which takes in the surrounding whitespace
+	 * or delimiters; the "i"nner one otherwise.
+	 * @param Delimiter The quote char, or either bracket of the pair.
+	 * Ignored by words & paragraphs.
+	 * @param OutStart, OutEnd The object's [Start, End) range.
+	 * @return false if there's no such object there.
+	 */
+	static bool GetTextObject(const FView Text, const int32_t Pos,
+		const EUMTextObjectType Type, const bool bAround, const CharType Delimiter,
+		int32_t& OutStart, int32_t& OutEnd);
+
+	static bool GetWordObject(const FView Text, const int32_t Pos,
+		const bool bBigWord, const bool bAround, int32_t& OutStart, int32_t& OutEnd);
+
+	/** Quotes are paired from the start of the line; escaped ones are skipped. */
+	static bool GetQuoteObject(const FView Text, const int32_t Pos,
+		const CharType Quote, const bool bAround, int32_t& OutStart, int32_t& OutEnd);
+
+	static bool GetBracketObject(const FView Text, const int32_t Pos,
+		const CharType Open, const CharType Close, const bool bAround,
+		int32_t& OutStart, int32_t& OutEnd,
+		const int32_t MaxScan = DefaultBracketScanLimit);
+
+	/** A paragraph is a run of blank or of non-blank lines. */
+	static bool GetParagraphObject(const FView Text, const int32_t Pos,
+		const bool bAround, int32_t& OutStart, int32_t& OutEnd);
+
+	/**
+	 * Finds the innermost bracket pair enclosing the position (or starting /
+	 * ending on it), honoring nesting.
+	 * @return false if unbalanced within MaxScan chars to either side.
+	 */
+	static bool FindEnclosingBrackets(const FView Text, const int32_t Pos,
+		const CharType Open, const CharType Close, const int32_t MaxScan,
+		int32_t& OutOpenPos, int32_t& OutClosePos);
+
+	/** Maps either bracket of a pair to both of them: '(' or ')' -> '(' & ')' */
+	static bool GetBracketPair(const CharType Bracket, CharType& OutOpen, CharType& OutClose);
+
+	//							~ Operator Motions ~
+	//
+	/**
+	 * Resolves the range an operator covers when moving from the position.
+	 * @param Count How many times to apply the motion (e.g. the 3 of "d3w").
+	 * @param Target The char searched by f, F, t & T.
+	 * @param bIsChange "cw" covers up to the word's end, like "ce" (as in Vim).
+	 * @return false if the motion can't move from there (e.g. "j" on the last
+	 * line) or covers nothing.
+	 */
+	static bool GetMotionRange(const FView Text, const int32_t Pos,
+		const EUMTextMotion Motion, const int32_t Count, const CharType Target,
+		const bool bIsChange, FVimTextRange& OutRange);
+
+	//							~ Search ~
+	//
+	/**
+	 * @return true if [Start, End) is a whole word, i.e. has no word chars
+	 * right before or after it (what "*" & "#" match on).
+	 */
+	static bool IsWholeWord(const FView Text, const int32_t Start, const int32_t End);
+
+	//							~ Positions ~
+	//
+	static int32_t			PositionToAbsoluteOffset(const FView Text, const FVimTextPosition Position);
+	static FVimTextPosition AbsoluteOffsetToPosition(const FView Text, const int32_t AbsoluteOffset);
+
+private:
+	static EUMCharType ClassifyCharSlow(const uint32_t Code);
+
+	/** Space & tab, i.e. whitespace that doesn't end the line. */
+	static inline bool IsBlankChar(const CharType Char)
+	{
+		return Char == ' ' || Char == '\t';
+	}
+
+	static int32_t SkipBlanks(const FView Text, const int32_t StartPos, const int32_t Direction);
+	static int32_t GetLineStart(const FView Text, const int32_t Pos);
+	static int32_t GetLineEnd(const FView Text, const int32_t Pos); // Its '\n' or Len
+	static bool	   IsBlankLine(const FView Text, const int32_t LineStart);
+
+	/** Takes in the trailing blanks, or the leading ones if there are none. */
+	static void ExtendOverBlanks(const FView Text, int32_t& InOutStart, int32_t& InOutEnd);
+
+	/**
+	 * Scans for the bracket closing the current depth, skipping blocks of
+	 * chars holding neither bracket.
+	 * @return Its position, or -1 if not found within MaxScan chars.
+	 */
+	static int32_t ScanForBracket(const FView Text, const int32_t StartPos,
+		const int32_t Direction, const CharType Target, const CharType Opposite,
+		const int32_t MaxScan);
+
+	static constexpr FUMCharClassTable CharClassTable{};
+};
+
+/**
+ * Boyer-Moore-Horspool literal search. The skip table is built once per
+ * pattern, so a whole buffer can be swept for its matches in sub-linear time.
+ * Skips are keyed by each char's low byte: chars past Latin-1 share buckets,
+ * which only shortens their skips and never misses a match.
+ */
+template <typename CharType>
+class TVimLiteralSearcher
+{
+public:
+	using FView = TVimTextView<CharType>;
+
+	/**
+	 * @param InPattern Viewed, not copied: it must outlive the searcher.
+	 * @param bInIgnoreCase Folds the ASCII letters on both sides.
+	 */
+	TVimLiteralSearcher(const FView InPattern, const bool bInIgnoreCase);
+
+	/** @return The start of the first match at or after From, or -1. */
+	int32_t FindNext(const FView Text, const int32_t From) const;
+
+	/** @return true if the pattern occurs at exactly this position. */
+	bool MatchesAt(const FView Text, const int32_t Pos) const;
+
+private:
+	inline CharType Fold(const CharType Char) const
+	{
+		return bIgnoreCase && Char >= 'A' && Char <= 'Z'
+			? static_cast<CharType>(Char - 'A' + 'a')
+			: Char;
+	}
+
+	static inline uint8_t Bucket(const CharType Char)
+	{
+		return static_cast<uint8_t>(Char & 0xFF);
+	}
+
+	FView	Pattern;
+	bool	bIgnoreCase{ false };
+	int32_t Shifts[256];
+};
+
+extern template class TVimTextCore<char>;
+extern template class TVimTextCore<wchar_t>;
+extern template class TVimTextCore<char16_t>;
+
+extern template class TVimLiteralSearcher<char>;
+extern template class TVimLiteralSearcher<wchar_t>;
+extern template class TVimLiteralSearcher<char16_t>;
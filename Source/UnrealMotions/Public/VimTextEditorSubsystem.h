@@ -10,6 +10,7 @@
 #include "UMYankData.h"
 #include "VimInputProcessor.h"
 #include "VimTextTypes.h"
+#include "VimTextEditorUtils.h"
 #include "VimTextEditorSubsystem.generated.h"
 
 /**
@@ -55,6 +56,13 @@ class UNREALMOTIONS_API UVimTextEditorSubsystem : public UEditorSubsystem
 	void HandleEditableUX();
 
 	bool GetActiveEditableTextContent(FString& OutText, const bool bIfMultiCurrLine = false);
+
+	/**
+	 * @return The line index of the active editable's content, brought
+	 * up-to-date with its current text (re-mirrored only if it changed),
+	 * or nullptr if no editable is active.
+	 */
+	const FVimTextLineIndex* GetActiveEditableLineIndex();
 	bool GetSelectedText(FString& OutText);
 
 	bool GetSelectionRange(FSlateApplication& SlateApp, FTextSelection& OutSelectionRange);
@@ -80,6 +88,19 @@ class UNREALMOTIONS_API UVimTextEditorSubsystem : public UEditorSubsystem
 	void OnEditableFocusLost();
 
 	bool IsNewEditableText(const TSharedRef<SWidget> NewEditableText);
+
+	/**
+	 * @return What we've applied to this editable so far (default if first
+	 * encountered). Destroyed editables are pruned whenever the map doubles,
+	 * keeping each focus change constant (amortized).
+	 */
+	FUMEditableState& FindOrAddEditableState(const TSharedRef<SWidget> InEditable);
+
+	/** @return The state of the focused editable, or nullptr if none. */
+	FUMEditableState* GetActiveEditableState();
+
+	/** @return The undo history of the focused editable, or nullptr if none. */
+	FVimTextUndoHistory* GetActiveUndoHistory();
 	bool IsDefaultEditableBuffer(const FString& InBuffer);
 
 	void ClearTextSelection(bool bKeepInputInNormalMode = true);
@@ -95,8 +116,6 @@ class UNREALMOTIONS_API UVimTextEditorSubsystem : public UEditorSubsystem
 		int32 (*FindWordBoundary)(
 			const FString& Text, int32 CurrentPos, bool bBigWord));
 
-	void NavigateWordMotion(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
-
 	void ToggleCursorBlinkingOff();
 	bool IsEditableTextWithDefaultBuffer();
 	void SetDefaultBuffer();
@@ -128,6 +147,42 @@ class UNREALMOTIONS_API UVimTextEditorSubsystem : public UEditorSubsystem
 
 	void SetCursorSelectionToDefaultLocation(FSlateApplication& SlateApp, bool bAlignCursorRight = true);
 
+	//////////////////////////////////////////////////////////////////////////
+	//					~ Native Cursor Placement ~
+	//
+	// Computes the target selection & applies it with a single SelectText
+	// call, instead of chaining synthetic arrow keys through Slate.
+
+	/**
+	 * Fetches the selection anchor & cursor of the active Multi-Line.
+	 * Single-Lines don't expose their selection, so this fails for them.
+	 * @return false if no Multi-Line is active.
+	 */
+	bool GetMultiLineAnchorAndCursor(FTextLocation& OutAnchor, FTextLocation& OutCursor);
+
+	/**
+	 * @return The absolute offset of the char highlighted by the Normal Mode
+	 * block cursor (i.e. the beginning of the current selection), or
+	 * INDEX_NONE if it can't be resolved natively (Single-Lines).
+	 */
+	int32 GetBlockCursorAbsOffset(const FVimTextLineIndex& LineIndex);
+
+	/**
+	 * Highlights the char at the passed absolute offset as the block cursor.
+	 * Empty lines are always left aligned, so the cursor stays on their line.
+	 * @param bAlignRight Place the cursor after the char (the default).
+	 */
+	bool PlaceBlockCursor(const FVimTextLineIndex& LineIndex, int32 AbsCharOffset, bool bAlignRight = true);
+
+	/** Sets the selection of the active editable in one call. */
+	bool SelectTextNative(const FTextLocation& InAnchor, const FTextLocation& InCursor);
+
+	/** Moves the Normal Mode block cursor by N lines, keeping its column. */
+	bool MoveBlockCursorByLines(const int32 LineDelta);
+	//
+	//					~ Native Cursor Placement ~
+	//////////////////////////////////////////////////////////////////////////
+
 	bool DoesActiveEditableHasAnyTextSelected();
 
 	bool IsCurrentLineEmpty();
@@ -171,8 +226,6 @@ class UNREALMOTIONS_API UVimTextEditorSubsystem : public UEditorSubsystem
 	void DeleteLineMulti(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 	void DeleteLineNormalModeMulti(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 	void ShiftDeleteNormalMode(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
-	void DeleteUpOrDown(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
-	void ActionToMotion(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
 
 	void AppendNewLine(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 	bool AppendBreakMultiLine();
@@ -183,14 +236,9 @@ class UNREALMOTIONS_API UVimTextEditorSubsystem : public UEditorSubsystem
 	void DeleteCurrentSelection(FSlateApplication& SlateApp, const bool bYankSelection);
 	void DeleteToEndOfLine(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 
-	void DeleteInsideWord(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
-
-	void ChangeEntireLine(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
-	void ChangeEntireLineMulti(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 
 	void ChangeToEndOfLine(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 	void ChangeVisualMode(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
-	void ChangeInsideWord(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
 
 	void AddDebuggingText(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 
@@ -272,14 +320,126 @@ class UNREALMOTIONS_API UVimTextEditorSubsystem : public UEditorSubsystem
 
 	void YankCurrentlySelectedText();
 	void YankCharacter(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
-	void YankLine(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
 	void Paste(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
-	void YankInsideWord(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
 
-	bool SelectInsideWord(FSlateApplication& SlateApp);
-	void SelectInsideWord();
+	//							~ Text Objects ~
+	//
+	/**
+	 * @return The absolute offset of the char under the block cursor, or
+	 * INDEX_NONE if there's no cursor to resolve.
+	 */
+	int32 GetCursorCharAbsOffset(FSlateApplication& SlateApp, const FVimTextLineIndex& LineIndex);
+
+	/**
+	 * Resolves the text object the sequence ends with (e.g. "iw", "a(", "ip")
+	 * around the block cursor to an absolute [Start, End) range.
+	 */
+	bool ResolveTextObjectRange(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence, int32& OutStart, int32& OutEnd);
+
+	/** Visually selects the text object the sequence ends with, in one update. */
+	bool SelectTextObject(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
+	void SelectTextObjectVisualMode(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
+
+	/** Binds "i" / "a" + every text object key, after the passed prefix. */
+	void BindTextObjects(const TArray<FInputChord>& InPrefix,
+		void (UVimTextEditorSubsystem::*Handler)(FSlateApplication&, const TArray<FInputChord>&),
+		const TArray<EVimMode>& InVimModes);
+
+	//						~ Operator-Pending Grammar ~
+	//
+	/**
+	 * Starts an operator (d, c, y, >, <) & takes over the keys that follow
+	 * until it can be resolved: "[count] op [count] motion | text object".
+	 */
+	void BeginOperator(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
+	void HandleOperatorPendingKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+	void EndOperatorPending();
+
+	/** Resolves the motion / text object completed by this key to a range. */
+	bool ResolveOperatorRange(FSlateApplication& SlateApp, const FInputChord& InChord,
+		const FKeyEvent& InKeyEvent, const int32 CharAbs, FVimTextRange& OutRange);
+
+	/** Applies the pending operator to the range: one edit, one cursor update. */
+	void ApplyOperator(FSlateApplication& SlateApp, const FVimTextRange& InRange, const int32 CharAbs);
+
+	/** Indents (>) or unindents (<) the range's lines by one tab. */
+	void ShiftLines(FSlateApplication& SlateApp, const FVimTextLineIndex& LineIndex,
+		const FVimTextRange& InRange, const bool bShiftRight);
+
+	//								~ Search ~
+	//
+	/**
+	 * Starts typing a pattern to search forward (/) or backward (?). Each
+	 * keystroke highlights the match it would land on; Enter jumps to it,
+	 * Escape returns to where the search began.
+	 */
+	void BeginSearch(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+	void HandleSearchPromptKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+	void EndSearchPrompt(FSlateApplication& SlateApp, const bool bRestoreCursor);
+
+	/** Highlights the match of the pattern typed so far & shows the prompt. */
+	void PreviewSearchMatch(FSlateApplication& SlateApp);
+	void ShowSearchPrompt(FSlateApplication& SlateApp, const int32 MatchIndex);
+
+	/** n (in the last search's direction) & N (against it). */
+	void SearchNextMatch(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 
-	void HandlePasteCharacterwise(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
+	/** * (forward) & # (backward): searches the word under the cursor. */
+	void SearchWordUnderCursor(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+
+	/**
+	 * Places the block cursor on the Nth match of the last search from the
+	 * offset, wrapping around the text's ends.
+	 * @return false if there are no matches.
+	 */
+	bool JumpToSearchMatch(const int32 FromAbs, const bool bForward, const int32 Count);
+
+	//							~ Visual Block ~
+	//
+	/**
+	 * Ctrl+V (Multi-Lines): takes over the keys to extend a column block
+	 * (h j k l 0 $ G o O, with counts) & edit it (I A c d x r y).
+	 * Edits are built from the line index & applied as a single replacement.
+	 */
+	void EnterVisualBlockMode(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+	void HandleVisualBlockKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+
+	/** Gathers what r (a char), I, A & c (text until Escape) await. */
+	void HandleVisualBlockEditKey(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+
+	/** Returns to Normal Mode with the block cursor on the passed offset. */
+	void ExitVisualBlockMode(FSlateApplication& SlateApp, const int32 CursorAbs);
+
+	/**
+	 * Slate selections are contiguous, so we select from the block's first
+	 * to its last char (its corners) & show its size in the buffer visualizer.
+	 */
+	void UpdateVisualBlockSelection(FSlateApplication& SlateApp);
+	void ShowVisualBlockPrompt(FSlateApplication& SlateApp);
+
+	/** Rewrites every line of the block in one replacement, then exits. */
+	void ApplyVisualBlockEdit(FSlateApplication& SlateApp, const EUMBlockEdit Edit, const FString& InText);
+
+	/** @return The offset of the char at the column, clamped to its line. */
+	int32 GetLineCharAbsOffset(const FVimTextLineIndex& LineIndex, const int32 Line, const int32 Col);
+
+	//								~ Undo ~
+	//
+	/**
+	 * Closes the undo group of the previous command (or Insert session) and
+	 * opens the next one, so whatever native edits a command took are undone
+	 * together.
+	 */
+	void OnCommandBoundary();
+
+	/**
+	 * u / Ctrl+R (with counts): reverts or reapplies whole commands from the
+	 * editable's undo history, each as a single replacement. Falls back to the
+	 * native Ctrl+Z / Ctrl+Y while that history has recorded nothing.
+	 */
+	void UndoOrRedo(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
+
+	void HandlePasteCharacterwise(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence, const int32 Count);
 	void HandlePasteCharacterwiseNormalMode(
 		FSlateApplication&					 SlateApp,
 		const TArray<FInputChord>&			 InSequence,
@@ -291,7 +451,7 @@ class UNREALMOTIONS_API UVimTextEditorSubsystem : public UEditorSubsystem
 		const FText&						 TextToPaste,
 		const TSharedRef<FVimInputProcessor> InputProc);
 
-	void HandlePasteLinewise(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
+	void HandlePasteLinewise(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence, const int32 Count);
 	void PasteVisualMode(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
 
 	void ReplaceCharacter(FSlateApplication& SlateApp, const TArray<FInputChord>& InSequence);
@@ -369,12 +529,25 @@ class UNREALMOTIONS_API UVimTextEditorSubsystem : public UEditorSubsystem
 	FOnKeyDown							OnMultiLineEditableKeyDown;
 	bool								bIsCurrMultiLineChildOfConsole;
 	bool								bFindPreviousChar{ false };
+	int32								ReplaceCount{ 1 }; // Awaiting r's char
 	bool								bIsEditableInit{ false };
 	bool								bIsFirstSingleLineKeyStroke{ false };
 	FTimerHandle						FindCharTimerHandle;
+	FVimTextLineIndex					ActiveEditableLineIndex;
+	FUMPendingOperator					PendingOperator;
+	FUMTextSearch						TextSearch;
+	FVimTextSearchIndex					ActiveEditableSearchIndex;
+	FUMVisualBlock						VisualBlock;
+	TMap<uint64, FUMEditableState>		EditableStates;
+	int32								EditableStatesPruneThreshold{ MinEditableStatesPruneThreshold };
 
 	const FText	  InsertModeHintText = FText::FromString("Start Typing... ('Esc'-> Normal Mode)");
 	const FText	  NormalModeHintText = FText::FromString("Press 'i' to Start Typing...");
 	const FString SingleEditableTextType = "SEditableText";
 	const FString MultiEditableTextType = "SMultiLineEditableText";
+	const FName	  SingleEditableTextTypeName = "SEditableText";
+	const FName	  MultiEditableTextTypeName = "SMultiLineEditableText";
+	const FName	  BorderTypeName = "SBorder";
+
+	static constexpr int32 MinEditableStatesPruneThreshold = 256;
 };
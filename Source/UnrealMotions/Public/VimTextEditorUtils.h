@@ -1,15 +1,100 @@
 #pragma once
+#include "Framework/Commands/InputChord.h"
 #include "Framework/Text/TextLayout.h"
 #include "UMLogger.h"
+#include "VimTextCore.h"
+#include "VimTextTypes.h"
 
 /**
- * Character type enumeration used for word boundary detection
+ * Mirror of an editable's text plus the absolute offset at which each line
+ * starts. Converting between absolute offsets and FTextLocations is then a
+ * lookup (or a binary search) instead of re-splitting the whole text.
+ * The mirror is rebuilt only when the source text is found to differ.
  */
-enum class EUMCharType
+class FVimTextLineIndex
 {
-	Word,	   // Alphanumeric or underscore
-	Symbol,	   // Non-word, non-whitespace (punctuation, etc.)
-	Whitespace // Space, tab, etc.
+public:
+	/**
+	 * Re-mirrors the text if it differs from the one we've indexed.
+	 * @return true if the index had to be rebuilt.
+	 */
+	bool Update(const FText& InText);
+
+	void Invalidate();
+
+	bool IsValid() const { return bIsValid; }
+
+	/** Bumped on every rebuild, so dependents can tell the text changed. */
+	uint32 GetRevision() const { return Revision; }
+
+	const FString& GetText() const { return Text; }
+	const FText&   GetMirroredText() const { return MirroredText; }
+
+	int32 GetLineCount() const { return LineStarts.Num(); }
+	int32 GetLineStart(const int32 LineIndex) const;
+	int32 GetLineLength(const int32 LineIndex) const;
+
+	int32		  ToAbsoluteOffset(const FTextLocation& Location) const;
+	FTextLocation ToTextLocation(int32 AbsoluteOffset) const;
+
+private:
+	void Rebuild();
+
+	FText		  MirroredText;
+	FString		  Text;
+	TArray<int32> LineStarts;
+	uint32		  Revision{ 0 };
+	bool		  bIsValid{ false };
+};
+
+/**
+ * The sorted matches of a search pattern (/, ?, *, #) over a line index's
+ * text. They're collected once and reused by n / N until either the pattern
+ * or the text changes, so each jump is a binary search.
+ * Literal patterns are swept with the core's Boyer-Moore-Horspool searcher;
+ * an FRegexPattern is only built for patterns using regex syntax.
+ * Patterns without uppercase letters match case-insensitively (smartcase).
+ */
+class FVimTextSearchIndex
+{
+public:
+	/**
+	 * Recollects the matches if the pattern or the indexed text changed.
+	 * @param bInWholeWord Only keep matches that are whole words (* & #).
+	 * @return true if the matches had to be recollected.
+	 */
+	bool Update(const FVimTextLineIndex& LineIndex, const FString& InPattern, const bool bInWholeWord);
+
+	void Invalidate();
+
+	int32 Num() const { return MatchStarts.Num(); }
+	int32 GetMatchStart(const int32 MatchIndex) const { return MatchStarts[MatchIndex]; }
+	int32 GetMatchEnd(const int32 MatchIndex) const { return MatchEnds[MatchIndex]; }
+
+	/**
+	 * @return The index of the first match starting after the offset (or,
+	 * going backward, the last one starting before it), wrapping around the
+	 * text's ends; INDEX_NONE if there are no matches.
+	 */
+	int32 FindMatchFrom(const int32 AbsOffset, const bool bForward) const;
+
+	/** @return true if the pattern uses any regex syntax. */
+	static bool IsRegexPattern(const FString& InPattern);
+
+private:
+	void CollectLiteralMatches(const FString& Text);
+	void CollectRegexMatches(const FString& Text);
+
+	/** Keeps the previous matches still matching the (extended) pattern. */
+	void NarrowLiteralMatches(const FString& Text);
+
+	FString		  Pattern;
+	uint32		  TextRevision{ 0 };
+	TArray<int32> MatchStarts; // Sorted
+	TArray<int32> MatchEnds;   // Exclusive; regex matches vary in length
+	bool		  bWholeWord{ false };
+	bool		  bIgnoreCase{ false };
+	bool		  bIsValid{ false };
 };
 
 class FVimTextEditorUtils
@@ -17,6 +102,24 @@ class FVimTextEditorUtils
 public:
 	//							~ Word Navigation ~
 	//
+	using FTextCore = TVimTextCore<TCHAR>;
+
+	/** Views the string's buffer for the text core (no copy). */
+	static FORCEINLINE FTextCore::FView ToView(const FString& Text)
+	{
+		return FTextCore::FView{ *Text, Text.Len() };
+	}
+
+	static FORCEINLINE EUMCharType ClassifyChar(TCHAR Char)
+	{
+		return FTextCore::ClassifyChar(Char);
+	}
+
+	static FORCEINLINE bool IsWhitespaceChar(TCHAR Char)
+	{
+		return FTextCore::IsWhitespaceChar(Char);
+	}
+
 	static bool IsWordChar(TCHAR Char);
 
 	// Public word boundary functions
@@ -183,11 +286,65 @@ public:
 
 	static bool GetAbsWordBoundaries(const FString& Text, int32 CurrentPos, TPair<int32, int32>& OutWordBoundaries, const bool bIncludeTrailingSpaces);
 
+	//							~ Text Objects ~
+	//
+	/**
+	 * Maps the key following the "i" / "a" of a text object to its type:
+	 * w W " ' ` ( ) b { } B [ ] < > p
+	 * @return false if the key doesn't name a text object.
+	 */
+	static bool GetTextObjectFromChord(const FInputChord& InChord, EUMTextObjectType& OutType, TCHAR& OutDelimiter);
+
+	/** @see TVimTextCore::GetTextObject */
+	static bool GetTextObject(const FString& Text, int32 CurrentPos, EUMTextObjectType Type, bool bAround, TCHAR Delimiter, int32& OutStart, int32& OutEnd);
+
+	//							~ Operator Motions ~
+	//
+	/**
+	 * Maps a single key motion to what an operator applies over:
+	 * h j k l w W e E b B 0 $ G
+	 * @return false if the key isn't such a motion.
+	 */
+	static bool GetMotionFromChord(const FInputChord& InChord, EUMTextMotion& OutMotion);
+
+	/** @see TVimTextCore::GetMotionRange */
+	static bool GetMotionRange(const FString& Text, int32 CurrentPos, EUMTextMotion Motion, int32 Count, TCHAR Target, bool bIsChange, FVimTextRange& OutRange);
+
+	//							~ Visual Block ~
+	//
+	/**
+	 * Rewrites the block's lines in a single pass over the mirrored text.
+	 * Columns are char offsets; lines not reaching the block are left as is
+	 * (except by Append, which pads them with spaces).
+	 * @param InText What Change / Insert / Append add, or Replace's char.
+	 * @param OutStart, OutEnd The whole lines spanned: what to replace.
+	 * @param OutReplacement Their new content.
+	 * @return false if nothing would change.
+	 */
+	static bool BuildBlockEdit(const FVimTextLineIndex& LineIndex, const FVimTextBlock& Block,
+		EUMBlockEdit Edit, const FString& InText,
+		int32& OutStart, int32& OutEnd, FString& OutReplacement);
+
+	/** @return The block's columns, line by line (what y & d yank). */
+	static FString GetBlockText(const FVimTextLineIndex& LineIndex, const FVimTextBlock& Block);
+
+	/**
+	 * @return The text Count times over (joined by the separator), built in
+	 * a single exactly sized allocation; what counted p, P & r insert at once.
+	 */
+	static FString RepeatText(const FString& InText, int32 Count, const TCHAR* Separator = TEXT(""));
+
 	static void AbsoluteOffsetToTextLocation(const FString& Text, int32 AbsoluteOffset, FTextLocation& OutLocation);
 
 	static int32 TextLocationToAbsoluteOffset(const FString& Text, const FTextLocation& Location);
 
 	static void DetermineVimModeForSingleLineEncounter();
 
+	/**
+	 * Times the word motions over a synthetic buffer and logs the throughput.
+	 * @param SizeInMB Size of the generated buffer.
+	 */
+	static void BenchmarkWordMotions(const int32 SizeInMB);
+
 	static FUMLogger Logger;
 };
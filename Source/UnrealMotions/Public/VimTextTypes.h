@@ -1,5 +1,9 @@
 #pragma once
 
+#include "Framework/Commands/InputChord.h"
+#include "Widgets/SWidget.h"
+#include "VimTextUndoHistory.h"
+
 enum class EUMEditableWidgetsFocusState : uint8
 {
 	None,
@@ -41,3 +45,102 @@ struct VisualModePositions
 	bool IsAboveStartLine() const { return GetTargetLine() < StartLine; }
 	bool IsBelowStartLine() const { return GetTargetLine() > StartLine; }
 };
+
+/**
+ * An operator waiting for what it applies to: "[count] op [count] motion",
+ * e.g. "2d3w", "c$", "yiw" or ">>".
+ */
+struct FUMPendingOperator
+{
+	FInputChord Operator;		  // d, c, y, > or <
+	int32		OperatorCount{ 1 }; // The 2 of "2d3w"
+	int32		MotionCount{ 0 };	  // The 3 of "2d3w" (0 if not typed)
+	FInputChord Prefix;			  // i / a, g, f / F / t / T awaiting their 2nd key
+
+	int32 GetCount() const
+	{
+		return OperatorCount * FMath::Max(MotionCount, 1);
+	}
+};
+
+/**
+ * The last search (what n / N repeat) & the one being typed after / or ?.
+ */
+struct FUMTextSearch
+{
+	FString Pattern;				 // Last committed pattern
+	bool	bBackward{ false };		 // Started with ? or #
+	bool	bWholeWord{ false };	 // Started with * or #
+	FString PromptPattern;			 // Being typed
+	bool	bPromptBackward{ false }; // Typed after ?
+	bool	bIsPromptActive{ false };
+	int32	OriginAbs{ INDEX_NONE }; // The char under the cursor when typing began
+};
+
+/** How a Visual Block edit rewrites each line of the block. */
+enum class EUMBlockEdit : uint8
+{
+	Change,	 // d & c: the columns are replaced with the text (if any)
+	Insert,	 // I: the text goes before the columns
+	Append,	 // A: the text goes after the columns (short lines are padded)
+	Replace, // r: every char in the columns becomes the text's first char
+};
+
+/** A rectangle of chars: the same columns over a range of lines. */
+struct FVimTextBlock
+{
+	int32 FirstLine{ 0 };
+	int32 LastLine{ 0 };
+	int32 LeftCol{ 0 };
+	int32 RightCol{ 0 };		  // Inclusive
+	bool  bToLineEnd{ false }; // $: each line's right edge is its own end
+};
+
+/**
+ * The Visual Block (Ctrl+V) being extended: its corners (in line & column)
+ * and what the keys are awaiting, if anything (r its char, I / A / c their
+ * text).
+ */
+struct FUMVisualBlock
+{
+	int32		 AnchorLine{ 0 };
+	int32		 AnchorCol{ 0 };
+	int32		 CursorLine{ 0 };
+	int32		 CursorCol{ 0 };
+	bool		 bToLineEnd{ false };
+	int32		 Count{ 0 }; // Typed before a motion (0 if none)
+	bool		 bIsAwaitingEdit{ false };
+	EUMBlockEdit PendingEdit{ EUMBlockEdit::Change };
+	FString		 EditText; // Typed for the pending edit
+	bool		 bIsActive{ false };
+
+	FVimTextBlock ToTextBlock() const
+	{
+		FVimTextBlock Block;
+		Block.FirstLine = FMath::Min(AnchorLine, CursorLine);
+		Block.LastLine = FMath::Max(AnchorLine, CursorLine);
+		Block.LeftCol = FMath::Min(AnchorCol, CursorCol);
+		Block.RightCol = FMath::Max(AnchorCol, CursorCol);
+		Block.bToLineEnd = bToLineEnd;
+		return Block;
+	}
+};
+
+/**
+ * What we've applied to an editable (text box) we've focused before, so
+ * refocusing it only touches what actually changed since, and its own undo
+ * history, which outlives focusing away from it.
+ * Keyed by the inner editable's widget Id; the weak pointers tell stale ones.
+ */
+struct FUMEditableState
+{
+	TWeakPtr<SWidget>	Editable;
+	TWeakPtr<SWidget>	Box; // The SBorder based text box it lives in
+	FText				DefaultHintText; // Its own, before we've swapped any
+	FText				AppliedHintText; // Compared by identity
+	const FSlateBrush*	AppliedBorder{ nullptr }; // GetBorderBrush's are stable
+	bool				bIsStyled{ false };
+	bool				bIsKeyDownHandlerBound{ false };
+	bool				bIsChildOfConsole{ false }; // Multi-Lines only
+	FVimTextUndoHistory	UndoHistory; // Offsets are only meaningful for this one
+};
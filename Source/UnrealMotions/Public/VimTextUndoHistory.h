@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FVimTextLineIndex;
+
+/** One undo step: the span a command replaced, before & after. */
+struct FVimTextUndoStep
+{
+	int32	Start{ 0 };
+	FString Removed;  // What was there before the command
+	FString Inserted; // What the command left there
+};
+
+/**
+ * Vim-level undo history of a single editable.
+ * Every command (and every Insert Mode session, from entering it to Escape)
+ * is a group: whatever native edits it took, only the span that differs
+ * between the group's first & last text is kept. A step thus costs the
+ * size of the edit rather than of the text, and is undone (or redone) as a
+ * single replacement.
+ */
+class FVimTextUndoHistory
+{
+public:
+	static constexpr int32 MaxSteps = 1000;			// As Vim's 'undolevels'
+	static constexpr int32 MaxStoredChars = 1 << 22; // The oldest steps go past it
+
+	/** Opens a group at the line index's text (shared, not copied). */
+	void BeginGroup(const FVimTextLineIndex& LineIndex);
+
+	/**
+	 * Closes the group, recording whatever changed since it was opened.
+	 * Recording after having undone drops the steps that could be redone.
+	 * @return true if a step was recorded.
+	 */
+	bool EndGroup(const FVimTextLineIndex& LineIndex);
+
+	bool IsGroupOpen() const { return bIsGroupOpen; }
+
+	/** @return true if no step was ever recorded (or all were cleared). */
+	bool IsEmpty() const { return Steps.IsEmpty(); }
+
+	/** @return The step to revert (Inserted back to Removed), or nullptr. */
+	const FVimTextUndoStep* Undo();
+
+	/** @return The step to reapply (Removed to Inserted), or nullptr. */
+	const FVimTextUndoStep* Redo();
+
+	void Reset();
+
+private:
+	void DropOldestStep();
+
+	TArray<FVimTextUndoStep> Steps;
+	int32					 NumApplied{ 0 }; // Steps past it can be redone
+	int32					 StoredChars{ 0 };
+
+	FText  GroupText;
+	uint32 GroupRevision{ 0 };
+	bool   bIsGroupOpen{ false };
+};
@@ -0,0 +1,160 @@
+// Times the hot paths of the Vim text core over a large generated buffer:
+// word motions sweeping it end to end, text objects, operator ranges and the
+// literal search. Run on an optimized build; each line reports ns per call.
+
+#include "VimTextCore.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cwchar>
+#include <string>
+
+using FCore = TVimTextCore<wchar_t>;
+using FView = TVimTextView<wchar_t>;
+using FClock = std::chrono::steady_clock;
+
+// Keeps the optimizer from dropping the calls being timed.
+static volatile int64_t Sink = 0;
+
+/** Lines of code-like text, with some non-Latin-1 words & symbols mixed in. */
+static std::wstring MakeText(const int32_t NumLines)
+{
+	static const wchar_t* const Lines[] = {
+		L"\tconst FVector2D Position(Node->NodePosX, Node->NodePosY);",
+		L"\tif (!Pin || Pin->Direction != EGPD_Input) // Skip the outputs",
+		L"\tText = FString::Printf(TEXT(\"%s: %d\"), *Name, Count);",
+		L"\tauto \u03B1\u03B2\u03B3 = \u4E2D\u6587 \u2014 { [a], (b), <c> };",
+		L"",
+	};
+	constexpr int32_t NumKinds = sizeof(Lines) / sizeof(Lines[0]);
+
+	std::wstring Text;
+	for (int32_t i = 0; i < NumLines; ++i)
+	{
+		Text += Lines[i % NumKinds];
+		Text += L'\n';
+	}
+	return Text;
+}
+
+/** Times the function, which @return how many calls it made. */
+template <typename FunctionType>
+static void Run(const char* Name, FunctionType&& Function)
+{
+	const FClock::time_point Start = FClock::now();
+	const int64_t			 NumCalls = Function();
+	const double			 Nanoseconds = static_cast<double>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(FClock::now() - Start).count());
+
+	std::printf("%-20s %10lld calls %10.1f ns/call\n",
+		Name, static_cast<long long>(NumCalls), NumCalls > 0 ? Nanoseconds / NumCalls : 0.0);
+}
+
+/** Sweeps the whole buffer with a motion; @return how many steps it took. */
+template <typename MotionType>
+static int64_t Sweep(const FView Text, const int32_t From, const int32_t Direction, MotionType&& Motion)
+{
+	int64_t Steps = 0;
+	int32_t Pos = From;
+	while (Direction > 0 ? Pos < Text.Len - 1 : Pos > 0)
+	{
+		const int32_t Next = Motion(Pos);
+		if (Next == Pos)
+			break;
+		Pos = Next;
+		++Steps;
+	}
+	Sink = Sink + Pos;
+	return Steps;
+}
+
+int main()
+{
+	const std::wstring Buffer = MakeText(200000);
+	const FView		   Text{ Buffer.data(), static_cast<int32_t>(Buffer.size()) };
+	std::printf("Buffer: %d chars\n", Text.Len);
+
+	auto SweepMotion = [&Text](const char* Name, const int32_t From, const int32_t Direction, auto&& Motion) {
+		Run(Name, [&]() { return Sweep(Text, From, Direction, Motion); });
+	};
+
+	//							~ Word Motions ~
+	//
+	SweepMotion("w", 0, 1, [&](int32_t Pos) { return FCore::FindNextWordBoundary(Text, Pos, false); });
+	SweepMotion("W", 0, 1, [&](int32_t Pos) { return FCore::FindNextWordBoundary(Text, Pos, true); });
+	SweepMotion("e", 0, 1, [&](int32_t Pos) { return FCore::FindNextWordEnd(Text, Pos, false); });
+	SweepMotion("b", Text.Len - 1, -1, [&](int32_t Pos) { return FCore::FindPreviousWordBoundary(Text, Pos, false); });
+	SweepMotion("ge", Text.Len - 1, -1, [&](int32_t Pos) { return FCore::FindPreviousWordEnd(Text, Pos, false); });
+
+	//							~ Text Objects ~
+	//
+	// Over a source file sized buffer: outside of any brackets, i( scans all
+	// of it (up to its limit) for a pair.
+	const std::wstring FileBuffer = MakeText(2000);
+	const FView		   FileText{ FileBuffer.data(), static_cast<int32_t>(FileBuffer.size()) };
+	std::printf("File buffer: %d chars\n", FileText.Len);
+
+	constexpr int32_t NumSamples = 20000;
+	const int32_t	  Stride = FileText.Len / NumSamples;
+
+	Run("aw", [&]() {
+		int32_t Start, End;
+		for (int32_t i = 0; i < NumSamples; ++i)
+			Sink = Sink + FCore::GetTextObject(FileText, i * Stride, EUMTextObjectType::Word, true, 0, Start, End);
+		return int64_t{ NumSamples };
+	});
+	Run("i(", [&]() {
+		int32_t Start, End;
+		for (int32_t i = 0; i < NumSamples; ++i)
+			Sink = Sink + FCore::GetTextObject(FileText, i * Stride, EUMTextObjectType::Bracket, false, L'(', Start, End);
+		return int64_t{ NumSamples };
+	});
+	Run("i\"", [&]() {
+		int32_t Start, End;
+		for (int32_t i = 0; i < NumSamples; ++i)
+			Sink = Sink + FCore::GetTextObject(FileText, i * Stride, EUMTextObjectType::Quote, false, L'"', Start, End);
+		return int64_t{ NumSamples };
+	});
+	Run("ip", [&]() {
+		int32_t Start, End;
+		for (int32_t i = 0; i < NumSamples; ++i)
+			Sink = Sink + FCore::GetTextObject(FileText, i * Stride, EUMTextObjectType::Paragraph, false, 0, Start, End);
+		return int64_t{ NumSamples };
+	});
+
+	//							~ Operator Motions ~
+	//
+	Run("d3w", [&]() {
+		FVimTextRange Range;
+		for (int32_t i = 0; i < NumSamples; ++i)
+			Sink = Sink + FCore::GetMotionRange(FileText, i * Stride, EUMTextMotion::WordStart, 3, 0, false, Range);
+		return int64_t{ NumSamples };
+	});
+	Run("dd", [&]() {
+		FVimTextRange Range;
+		for (int32_t i = 0; i < NumSamples; ++i)
+			Sink = Sink + FCore::GetMotionRange(FileText, i * Stride, EUMTextMotion::CurrentLine, 1, 0, false, Range);
+		return int64_t{ NumSamples };
+	});
+	Run("dt;", [&]() {
+		FVimTextRange Range;
+		for (int32_t i = 0; i < NumSamples; ++i)
+			Sink = Sink + FCore::GetMotionRange(FileText, i * Stride, EUMTextMotion::TillChar, 1, L';', false, Range);
+		return int64_t{ NumSamples };
+	});
+
+	//							~ Search ~
+	//
+	const wchar_t* const Pattern = L"Node->NodePosY";
+	const FView			 PatternView{ Pattern, static_cast<int32_t>(std::wcslen(Pattern)) };
+	const TVimLiteralSearcher<wchar_t> Searcher(PatternView, true);
+
+	Run("/ (per match)", [&]() {
+		int64_t NumMatches = 0;
+		for (int32_t Pos = Searcher.FindNext(Text, 0); Pos >= 0; Pos = Searcher.FindNext(Text, Pos + 1))
+			++NumMatches;
+		return NumMatches;
+	});
+
+	return Sink == 0x7FFFFFFFFFFFFFFF ? 1 : 0; // Never; reads the sink
+}
@@ -0,0 +1,311 @@
+// Unit tests of the engine-independent Vim text core.
+// Non-ASCII chars are spelled as escapes so any compiler reads them alike.
+
+#include "VimTextCore.h"
+
+#include <cstdio>
+#include <cstring>
+
+using FCore = TVimTextCore<char>;
+using FWideCore = TVimTextCore<wchar_t>;
+using FView = TVimTextView<char>;
+
+static int32_t NumChecks = 0;
+static int32_t NumFailures = 0;
+
+#define CHECK_EQ(Actual, Expected)                                          \
+	do                                                                      \
+	{                                                                       \
+		++NumChecks;                                                        \
+		const long long ActualValue = static_cast<long long>(Actual);       \
+		const long long ExpectedValue = static_cast<long long>(Expected);   \
+		if (ActualValue != ExpectedValue)                                   \
+		{                                                                   \
+			++NumFailures;                                                  \
+			std::printf("%s:%d: %s == %lld, expected %lld\n",               \
+				__FILE__, __LINE__, #Actual, ActualValue, ExpectedValue);   \
+		}                                                                   \
+	}                                                                       \
+	while (0)
+
+#define CHECK(Condition) CHECK_EQ(!!(Condition), true)
+
+static FView View(const char* InText)
+{
+	return FView{ InText, static_cast<int32_t>(std::strlen(InText)) };
+}
+
+//							~ Char Classification ~
+//
+static void TestClassifyChar()
+{
+	CHECK(FCore::ClassifyChar('a') == EUMCharType::Word);
+	CHECK(FCore::ClassifyChar('Z') == EUMCharType::Word);
+	CHECK(FCore::ClassifyChar('7') == EUMCharType::Word);
+	CHECK(FCore::ClassifyChar('_') == EUMCharType::Word);
+	CHECK(FCore::ClassifyChar('.') == EUMCharType::Symbol);
+	CHECK(FCore::ClassifyChar('(') == EUMCharType::Symbol);
+	CHECK(FCore::ClassifyChar(' ') == EUMCharType::Whitespace);
+	CHECK(FCore::ClassifyChar('\t') == EUMCharType::Whitespace);
+	CHECK(FCore::ClassifyChar('\n') == EUMCharType::Whitespace);
+
+	// Latin-1
+	CHECK(FWideCore::ClassifyChar(L'\u00E9') == EUMCharType::Word); // e acute
+	CHECK(FWideCore::ClassifyChar(L'\u00D7') == EUMCharType::Symbol); // Multiplication sign
+	CHECK(FWideCore::ClassifyChar(L'\u00A0') == EUMCharType::Whitespace); // No-break space
+
+	// Past Latin-1: the same however the C library's locale is set up
+	CHECK(FWideCore::ClassifyChar(L'\u03B1') == EUMCharType::Word); // Greek alpha
+	CHECK(FWideCore::ClassifyChar(L'\u0416') == EUMCharType::Word); // Cyrillic zhe
+	CHECK(FWideCore::ClassifyChar(L'\u4E2D') == EUMCharType::Word); // CJK ideograph
+	CHECK(FWideCore::ClassifyChar(L'\u2014') == EUMCharType::Symbol); // Em dash
+	CHECK(FWideCore::ClassifyChar(L'\u2192') == EUMCharType::Symbol); // Rightwards arrow
+	CHECK(FWideCore::ClassifyChar(L'\u3001') == EUMCharType::Symbol); // Ideographic comma
+	CHECK(FWideCore::ClassifyChar(L'\u2003') == EUMCharType::Whitespace); // Em space
+	CHECK(FWideCore::ClassifyChar(L'\u3000') == EUMCharType::Whitespace); // Ideographic space
+	CHECK(FWideCore::ClassifyChar(L'\u2028') == EUMCharType::Whitespace); // Line separator
+
+	// UTF-16 agrees with the wide chars
+	CHECK(TVimTextCore<char16_t>::ClassifyChar(u'\u2014') == EUMCharType::Symbol);
+	CHECK(TVimTextCore<char16_t>::ClassifyChar(u'\u03B1') == EUMCharType::Word);
+}
+
+//							~ Word Motions ~
+//
+static void TestWordMotions()
+{
+	//                       01234567890123456
+	const FView Text = View("foo.bar  baz(qux)");
+
+	// w: word chars, symbols & whitespace each make their own runs
+	CHECK_EQ(FCore::FindNextWordBoundary(Text, 0, false), 3); // foo -> .
+	CHECK_EQ(FCore::FindNextWordBoundary(Text, 3, false), 4); // . -> bar
+	CHECK_EQ(FCore::FindNextWordBoundary(Text, 4, false), 9); // bar -> baz
+	CHECK_EQ(FCore::FindNextWordBoundary(Text, 9, false), 12); // baz -> (
+	CHECK_EQ(FCore::FindNextWordBoundary(Text, 16, false), Text.Len);
+
+	// W: only whitespace separates
+	CHECK_EQ(FCore::FindNextWordBoundary(Text, 0, true), 9);
+	CHECK_EQ(FCore::FindNextWordBoundary(Text, 9, true), Text.Len);
+
+	// b / B
+	CHECK_EQ(FCore::FindPreviousWordBoundary(Text, 9, false), 4);
+	CHECK_EQ(FCore::FindPreviousWordBoundary(Text, 4, false), 3);
+	CHECK_EQ(FCore::FindPreviousWordBoundary(Text, 6, false), 4);
+	CHECK_EQ(FCore::FindPreviousWordBoundary(Text, 9, true), 0);
+	CHECK_EQ(FCore::FindPreviousWordBoundary(Text, 0, false), 0);
+
+	// e / E
+	CHECK_EQ(FCore::FindNextWordEnd(Text, 0, false), 2);
+	CHECK_EQ(FCore::FindNextWordEnd(Text, 2, false), 3);
+	CHECK_EQ(FCore::FindNextWordEnd(Text, 3, false), 6);
+	CHECK_EQ(FCore::FindNextWordEnd(Text, 0, true), 6);
+	CHECK_EQ(FCore::FindNextWordEnd(Text, 6, true), 16);
+
+	// ge / gE
+	CHECK_EQ(FCore::FindPreviousWordEnd(Text, 9, false), 6);
+	CHECK_EQ(FCore::FindPreviousWordEnd(Text, 6, false), 3);
+	CHECK_EQ(FCore::FindPreviousWordEnd(Text, 12, true), 6);
+
+	// Unicode words aren't split by the locale
+	const wchar_t*				Wide = L"\u03B1\u03B2\u03B3 \u2014 \u4E2D\u6587";
+	const TVimTextView<wchar_t> WideText{ Wide, 8 };
+	CHECK_EQ(FWideCore::FindNextWordBoundary(WideText, 0, false), 4); // -> em dash
+	CHECK_EQ(FWideCore::FindNextWordBoundary(WideText, 4, false), 6); // -> CJK
+	CHECK_EQ(FWideCore::FindNextWordEnd(WideText, 0, false), 2);
+}
+
+static void TestWordBoundaries()
+{
+	const FView Text = View("foo.bar  baz");
+
+	int32_t Start = -1, End = -1;
+	CHECK(FCore::GetAbsWordBoundaries(Text, 5, Start, End));
+	CHECK_EQ(Start, 4);
+	CHECK_EQ(End, 7);
+
+	CHECK(!FCore::GetAbsWordBoundaries(Text, Text.Len, Start, End));
+
+	CHECK(FCore::IsWholeWord(Text, 4, 7));
+	CHECK(!FCore::IsWholeWord(Text, 4, 6));
+	CHECK(FCore::IsWholeWord(Text, 9, 12));
+}
+
+//							~ Line Positions ~
+//
+static void TestPositions()
+{
+	const FView Text = View("ab\ncde\n\nf");
+
+	const FVimTextPosition Position = FCore::AbsoluteOffsetToPosition(Text, 5);
+	CHECK_EQ(Position.Line, 1);
+	CHECK_EQ(Position.Offset, 2);
+
+	CHECK_EQ(FCore::PositionToAbsoluteOffset(Text, { 0, 1 }), 1);
+	CHECK_EQ(FCore::PositionToAbsoluteOffset(Text, { 1, 2 }), 5);
+	CHECK_EQ(FCore::PositionToAbsoluteOffset(Text, { 3, 0 }), 8);
+
+	for (int32_t Offset = 0; Offset < Text.Len; ++Offset)
+		CHECK_EQ(FCore::PositionToAbsoluteOffset(
+					 Text, FCore::AbsoluteOffsetToPosition(Text, Offset)),
+			Offset);
+}
+
+//							~ Text Objects ~
+//
+static void CheckObject(const char* InText, const int32_t Pos,
+	const EUMTextObjectType Type, const bool bAround, const char Delimiter,
+	const int32_t ExpectedStart, const int32_t ExpectedEnd, const int32_t Line)
+{
+	int32_t Start = -1, End = -1;
+	const bool bFound = FCore::GetTextObject(View(InText), Pos, Type, bAround, Delimiter, Start, End);
+
+	++NumChecks;
+	const bool bExpected = ExpectedStart >= 0;
+	if (bFound != bExpected || (bFound && (Start != ExpectedStart || End != ExpectedEnd)))
+	{
+		++NumFailures;
+		std::printf("%s:%d: object in \"%s\" at %d is %s[%d, %d), expected %s[%d, %d)\n",
+			__FILE__, Line, InText, Pos, bFound ? "" : "none ", Start, End,
+			bExpected ? "" : "none ", ExpectedStart, ExpectedEnd);
+	}
+}
+
+#define CHECK_OBJECT(Text, Pos, Type, bAround, Delimiter, Start, End) \
+	CheckObject(Text, Pos, EUMTextObjectType::Type, bAround, Delimiter, Start, End, __LINE__)
+
+static void TestTextObjects()
+{
+	// iw / aw: aw takes the trailing blanks, or the leading ones at line end
+	CHECK_OBJECT("foo bar baz", 5, Word, false, 0, 4, 7);
+	CHECK_OBJECT("foo bar baz", 5, Word, true, 0, 4, 8);
+	CHECK_OBJECT("foo bar", 5, Word, true, 0, 3, 7);
+	CHECK_OBJECT("foo.bar", 1, Word, false, 0, 0, 3);
+	CHECK_OBJECT("foo.bar baz", 1, BigWord, false, 0, 0, 7);
+
+	// i" / a"
+	CHECK_OBJECT("x = \"abc\";", 6, Quote, false, '"', 5, 8);
+	CHECK_OBJECT("x = \"abc\";", 6, Quote, true, '"', 3, 9); // No trailing blanks; takes the leading
+	CHECK_OBJECT("x = \"abc\";", 0, Quote, false, '"', 5, 8); // Searches on after
+	CHECK_OBJECT("x = \"a\\\"c\";", 6, Quote, false, '"', 5, 9); // Escaped quote
+	CHECK_OBJECT("no quotes", 2, Quote, false, '"', -1, -1);
+
+	// i( / a(, nested & by either bracket
+	CHECK_OBJECT("f(a, (b), c)", 3, Bracket, false, '(', 2, 11);
+	CHECK_OBJECT("f(a, (b), c)", 3, Bracket, true, ')', 1, 12);
+	CHECK_OBJECT("f(a, (b), c)", 6, Bracket, false, '(', 6, 7);
+	CHECK_OBJECT("f(a, (b), c)", 5, Bracket, true, '(', 5, 8);
+	CHECK_OBJECT("{ [x] }", 3, Bracket, false, '{', 1, 6);
+	CHECK_OBJECT("f(a", 2, Bracket, false, '(', -1, -1); // Unbalanced
+
+	// ip / ap
+	CHECK_OBJECT("a\nb\n\nc", 0, Paragraph, false, 0, 0, 4);
+	CHECK_OBJECT("a\nb\n\nc", 0, Paragraph, true, 0, 0, 5);
+}
+
+//							~ Operator Motions ~
+//
+static void CheckMotion(const char* InText, const int32_t Pos,
+	const EUMTextMotion Motion, const int32_t Count, const char Target,
+	const bool bIsChange, const int32_t ExpectedStart, const int32_t ExpectedEnd,
+	const bool bExpectedLinewise, const int32_t Line)
+{
+	FVimTextRange Range;
+	const bool	  bFound = FCore::GetMotionRange(View(InText), Pos, Motion, Count, Target, bIsChange, Range);
+
+	++NumChecks;
+	const bool bExpected = ExpectedStart >= 0;
+	if (bFound != bExpected
+		|| (bFound
+			&& (Range.Start != ExpectedStart || Range.End != ExpectedEnd
+				|| Range.bLinewise != bExpectedLinewise)))
+	{
+		++NumFailures;
+		std::printf("%s:%d: motion in \"%s\" at %d is %s[%d, %d)%s, expected %s[%d, %d)%s\n",
+			__FILE__, Line, InText, Pos, bFound ? "" : "none ", Range.Start, Range.End,
+			Range.bLinewise ? " linewise" : "", bExpected ? "" : "none ",
+			ExpectedStart, ExpectedEnd, bExpectedLinewise ? " linewise" : "");
+	}
+}
+
+#define CHECK_MOTION(Text, Pos, Motion, Count, Target, bIsChange, Start, End, bLinewise) \
+	CheckMotion(Text, Pos, EUMTextMotion::Motion, Count, Target, bIsChange, Start, End, bLinewise, __LINE__)
+
+static void TestMotionRanges()
+{
+	// Charwise, within the line
+	CHECK_MOTION("hello world", 4, Left, 2, 0, false, 2, 4, false);
+	CHECK_MOTION("hello world", 0, Left, 1, 0, false, -1, -1, false);
+	CHECK_MOTION("hello world", 4, Right, 3, 0, false, 4, 7, false);
+	CHECK_MOTION("ab\ncd", 1, Right, 5, 0, false, 1, 2, false); // Stops at the line break
+	CHECK_MOTION("ab cd\nef", 3, LineStart, 1, 0, false, 0, 3, false);
+	CHECK_MOTION("ab cd\nef", 1, LineEnd, 1, 0, false, 1, 5, false);
+	CHECK_MOTION("ab\ncd\nef", 1, LineEnd, 2, 0, false, 1, 5, false);
+
+	// dw, d2w, cw & dW
+	CHECK_MOTION("foo bar baz", 0, WordStart, 1, 0, false, 0, 4, false);
+	CHECK_MOTION("foo bar baz", 0, WordStart, 2, 0, false, 0, 8, false);
+	CHECK_MOTION("foo bar baz", 0, WordStart, 1, 0, true, 0, 3, false);
+	CHECK_MOTION("foo bar baz", 0, WordStart, 2, 0, true, 0, 7, false);
+	CHECK_MOTION("foo.bar baz", 0, BigWordStart, 1, 0, false, 0, 8, false);
+	CHECK_MOTION("foo\nbar", 0, WordStart, 1, 0, false, 0, 3, false); // Keeps the line break
+
+	// de, db & dge
+	CHECK_MOTION("foo bar", 0, WordEnd, 1, 0, false, 0, 3, false);
+	CHECK_MOTION("foo bar", 4, WordEnd, 1, 0, false, 4, 7, false);
+	CHECK_MOTION("foo bar", 4, WordBack, 1, 0, false, 0, 4, false);
+	CHECK_MOTION("foo bar", 6, PrevWordEnd, 1, 0, false, 2, 7, false);
+
+	// df, dt, dF & dT
+	CHECK_MOTION("a,b,c", 0, FindChar, 1, ',', false, 0, 2, false);
+	CHECK_MOTION("a,b,c", 0, FindChar, 2, ',', false, 0, 4, false);
+	CHECK_MOTION("a,b,c", 0, TillChar, 1, ',', false, 0, 1, false);
+	CHECK_MOTION("a,b,c", 4, FindCharBack, 1, ',', false, 3, 4, false);
+	CHECK_MOTION("a,b,c", 4, TillCharBack, 1, ',', false, -1, -1, false); // Covers nothing
+	CHECK_MOTION("a,b,c", 4, TillCharBack, 2, ',', false, 2, 4, false);
+	CHECK_MOTION("a,b\n,c", 0, FindChar, 2, ',', false, -1, -1, false); // Not past the line
+
+	// Linewise: dd, d2d, dj, dk, dgg & dG
+	CHECK_MOTION("ab\ncd\nef", 4, CurrentLine, 1, 0, false, 3, 5, true);
+	CHECK_MOTION("ab\ncd\nef", 0, CurrentLine, 2, 0, false, 0, 5, true);
+	CHECK_MOTION("ab\ncd\nef", 0, LinesDown, 1, 0, false, 0, 5, true);
+	CHECK_MOTION("ab\ncd\nef", 7, LinesDown, 1, 0, false, -1, -1, true);
+	CHECK_MOTION("ab\ncd\nef", 4, LinesUp, 1, 0, false, 0, 5, true);
+	CHECK_MOTION("ab\ncd\nef", 0, LinesUp, 1, 0, false, -1, -1, true);
+	CHECK_MOTION("ab\ncd\nef", 4, FirstLine, 1, 0, false, 0, 5, true);
+	CHECK_MOTION("ab\ncd\nef", 4, LastLine, 1, 0, false, 3, 8, true);
+
+	CHECK_MOTION("", 0, WordStart, 1, 0, false, -1, -1, false);
+}
+
+//							~ Literal Search ~
+//
+static void TestLiteralSearcher()
+{
+	const FView Text = View("Foo bar foo BAR foo");
+
+	const TVimLiteralSearcher<char> Searcher(View("foo"), false);
+	CHECK_EQ(Searcher.FindNext(Text, 0), 8);
+	CHECK_EQ(Searcher.FindNext(Text, 9), 16);
+	CHECK_EQ(Searcher.FindNext(Text, 17), -1);
+	CHECK(Searcher.MatchesAt(Text, 16));
+	CHECK(!Searcher.MatchesAt(Text, 0));
+
+	const TVimLiteralSearcher<char> IgnoreCaseSearcher(View("bar"), true);
+	CHECK_EQ(IgnoreCaseSearcher.FindNext(Text, 0), 4);
+	CHECK_EQ(IgnoreCaseSearcher.FindNext(Text, 5), 12);
+}
+
+int main()
+{
+	TestClassifyChar();
+	TestWordMotions();
+	TestWordBoundaries();
+	TestPositions();
+	TestTextObjects();
+	TestMotionRanges();
+	TestLiteralSearcher();
+
+	std::printf("%d checks, %d failed\n", NumChecks, NumFailures);
+	return NumFailures == 0 ? 0 : 1;
+}